@@ -0,0 +1,124 @@
+#ifndef SRC_CHANNEL_CHANNELCAPABILITIES_HPP_
+#define SRC_CHANNEL_CHANNELCAPABILITIES_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace stamask {
+
+
+/**
+ * Optional channel features as bit flags.
+ * Peers use only the features that both of them support.
+ */
+enum EChannelFeature : uint32_t {
+	eChannelFeatureNone = 0,
+	/** server takes stream texts and parsed libraries by content hash */
+	eChannelFeatureStoredStreams = 1u << 0,
+	/** server reads stream texts from shared memory objects */
+	eChannelFeatureSharedStreams = 1u << 1
+};
+
+
+/**
+ * Capabilities that channel side publishes for it's counterpart.
+ * Has fixed layout to be placed in shared memory.
+ */
+struct ChannelCapabilities {
+
+	/** max amount of encoders to publish */
+	static constexpr uint32_t cMaxEncodersNum = 8;
+
+	/** current version of layout and feature messages, 2 has SHA-256 content hashes */
+	static constexpr uint32_t cVersion = 2;
+
+	/** layout version */
+	uint32_t mVersion = cVersion;
+
+	/** amount of supported encoders */
+	uint32_t mEncodersNum = 0;
+
+	/** IDs of supported encoders, the most preferred one goes first */
+	uint32_t mEncoderIdsArr[cMaxEncodersNum] = {};
+
+	/** supported channel features, see EChannelFeature */
+	uint32_t mFeatureFlags = eChannelFeatureNone;
+
+public:
+
+	ChannelCapabilities() = default;
+
+	/**
+	 * Fills capabilities with encoders and features.
+	 * Encoders that don't fit in capabilities are skipped.
+	 * @param inEncoderIdsVec encoder IDs in order of preference
+	 * @param inFeatureFlags feature flags
+	 */
+	ChannelCapabilities(
+			const std::vector<uint32_t>& inEncoderIdsVec,
+			uint32_t inFeatureFlags):
+				mFeatureFlags(inFeatureFlags) {
+		for(uint32_t encoderId : inEncoderIdsVec) {
+			if(mEncodersNum == cMaxEncodersNum)
+				break;
+			mEncoderIdsArr[mEncodersNum++] = encoderId;
+		}
+	}
+
+	/**
+	 * Checks that encoder is supported.
+	 * @param inEncoderId encoder ID
+	 * @return support flag
+	 */
+	bool hasEncoder(uint32_t inEncoderId) const {
+		for(uint32_t i = 0; i < mEncodersNum && i < cMaxEncodersNum; i++) {
+			if(mEncoderIdsArr[i] == inEncoderId)
+				return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Checks that capabilities have the current layout.
+	 * @return flag of known layout
+	 */
+	bool hasKnownVersion() const {
+		return mVersion == cVersion;
+	}
+
+	/**
+	 * Chooses the most preferred own encoder that remote side supports,
+	 * and features that are supported by both sides.
+	 * Returns false if remote capabilities have another layout version
+	 * or there's no common encoder.
+	 * @param inRemoteCaps capabilities of the remote side
+	 * @param outEncoderId chosen encoder ID
+	 * @param outFeatureFlags common feature flags
+	 * @return flag that common set was found
+	 */
+	bool negotiate(
+			const ChannelCapabilities& inRemoteCaps,
+			uint32_t& outEncoderId,
+			uint32_t& outFeatureFlags) const {
+		if(!hasKnownVersion() || !inRemoteCaps.hasKnownVersion())
+			return false;
+
+		for(uint32_t i = 0; i < mEncodersNum && i < cMaxEncodersNum; i++) {
+			if(!inRemoteCaps.hasEncoder(mEncoderIdsArr[i]))
+				continue;
+
+			outEncoderId = mEncoderIdsArr[i];
+			outFeatureFlags = mFeatureFlags & inRemoteCaps.mFeatureFlags;
+			return true;
+		}
+
+		return false;
+	}
+
+};
+
+
+}
+
+
+#endif /* SRC_CHANNEL_CHANNELCAPABILITIES_HPP_ */
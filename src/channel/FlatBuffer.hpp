@@ -0,0 +1,498 @@
+#ifndef SRC_CHANNEL_FLATBUFFER_HPP_
+#define SRC_CHANNEL_FLATBUFFER_HPP_
+
+#include "AbsMessageSerdes.hpp"
+#include "MessageFields.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+		"flat buffer layout is little-endian and is copied as is");
+#endif
+
+
+/*
+ * Flat buffer layout.
+ * Buffer consists of 8-byte slots and 8-byte aligned data areas,
+ * all offsets are counted from the buffer start.
+ * First slot is a root slot that points to the message table.
+ *
+ * Slot content depends on the field type:
+ *  - scalar (number, bool, enum): value in low bytes, rest is zero;
+ *  - string: {uint32 offset, uint32 bytes} of characters;
+ *  - vector of records: {uint32 offset, uint32 count} of raw records,
+ *    data is preceded by {uint32 record size, uint32 0} header;
+ *  - vector of other types: {uint32 offset, uint32 count} of element slots;
+ *  - structure: {uint32 offset, uint32 count} of field slots (table).
+ *
+ * Records are numbers and trivially copyable structures, they are stored
+ * contiguously and may be read in place without decoding.
+ * Fields of structures are listed by serialize functions of MessageFields.hpp.
+ * Tables store amount of fields, so reader of newer build
+ * keeps default values of fields that older writer didn't have.
+ */
+
+namespace stamask {
+
+
+/** size of a slot in flat buffer */
+static constexpr std::size_t cFlatSlotSize = 8;
+
+
+/**
+ * Flag that vector element is stored as raw record.
+ */
+template<typename _Type>
+struct IsFlatRecord : std::integral_constant<bool,
+		std::is_arithmetic<_Type>::value ||
+		std::is_enum<_Type>::value ||
+		(std::is_class<_Type>::value &&
+				std::is_trivially_copyable<_Type>::value &&
+				std::is_standard_layout<_Type>::value)> {};
+
+
+/**
+ * Rounds amount of bytes up to the slot size.
+ * @param inBytesNum amount of bytes
+ * @return aligned amount of bytes
+ */
+inline std::size_t alignFlatSize(std::size_t inBytesNum) {
+	return (inBytesNum + cFlatSlotSize - 1) & ~(cFlatSlotSize - 1);
+}
+
+
+/**
+ * Archive that counts fields of a structure.
+ */
+class FlatCountArchive {
+
+	/** amount of visited fields */
+	uint32_t mFieldsNum = 0;
+
+public:
+
+	template<typename _Type>
+	FlatCountArchive& operator&(const _Type&) {
+		mFieldsNum++;
+		return *this;
+	}
+
+	uint32_t getFieldsNum() const {
+		return mFieldsNum;
+	}
+
+};
+
+
+/**
+ * Archive that writes fields of a structure into the slots of it's table.
+ * Nested data is appended to the end of the buffer.
+ * Fails if some offset or amount of items doesn't fit in 32-bit slot.
+ */
+class FlatOArchive {
+
+	/** buffer to write to */
+	std::vector<uint8_t>& mBuffer;
+
+	/** offset of the next slot to fill */
+	std::size_t mSlotOffset;
+
+	/** flag that all data was written correctly, shared with nested archives */
+	bool& mValid;
+
+public:
+
+	FlatOArchive(
+			std::vector<uint8_t>& ioBuffer,
+			std::size_t inSlotOffset,
+			bool& ioValid):
+		mBuffer(ioBuffer),
+		mSlotOffset(inSlotOffset),
+		mValid(ioValid) {}
+
+	/**
+	 * Writes value into the next slot.
+	 * @param inValue value to write
+	 * @return archive
+	 */
+	template<typename _Type>
+	FlatOArchive& operator&(const _Type& inValue) {
+		writeSlot(mSlotOffset, inValue);
+		mSlotOffset += cFlatSlotSize;
+		return *this;
+	}
+
+	/**
+	 * Clears buffer and writes value with root slot.
+	 * Buffer keeps it's capacity.
+	 * Returns false if data is too large for 32-bit offsets.
+	 * @param ioBuffer buffer to fill
+	 * @param inValue value to write
+	 * @return operation success
+	 */
+	template<typename _Type>
+	static bool writeRoot(
+			std::vector<uint8_t>& ioBuffer,
+			const _Type& inValue) {
+		ioBuffer.clear();
+		ioBuffer.resize(cFlatSlotSize, 0);
+
+		bool valid = true;
+		FlatOArchive(ioBuffer, 0, valid).writeSlot(0, inValue);
+		return valid;
+	}
+
+private:
+
+	/**
+	 * Appends zeroed aligned area to the buffer.
+	 * @param inBytesNum amount of bytes
+	 * @return offset of the area
+	 */
+	std::size_t allocate(std::size_t inBytesNum) {
+		std::size_t offset = mBuffer.size();
+		mBuffer.resize(offset + alignFlatSize(inBytesNum), 0);
+		return offset;
+	}
+
+	/**
+	 * Sets offset and amount of items in the slot.
+	 * Marks archive invalid if they don't fit in 32 bits.
+	 */
+	void setSlot(
+			std::size_t inSlotOffset,
+			std::size_t inOffset,
+			std::size_t inItemsNum) {
+		if(inOffset > std::numeric_limits<uint32_t>::max() ||
+				inItemsNum > std::numeric_limits<uint32_t>::max()) {
+			mValid = false;
+			return;
+		}
+
+		uint32_t offset = inOffset;
+		uint32_t itemsNum = inItemsNum;
+		std::memcpy(mBuffer.data() + inSlotOffset, &offset, sizeof(offset));
+		std::memcpy(mBuffer.data() + inSlotOffset + sizeof(offset),
+				&itemsNum, sizeof(itemsNum));
+	}
+
+	/**
+	 * Writes scalar into the slot or structure as a table.
+	 */
+	template<typename _Type>
+	void writeSlot(
+			std::size_t inSlotOffset,
+			const _Type& inValue) {
+		if constexpr(std::is_arithmetic<_Type>::value || std::is_enum<_Type>::value) {
+			static_assert(sizeof(_Type) <= cFlatSlotSize, "scalar doesn't fit in slot");
+			std::memcpy(mBuffer.data() + inSlotOffset, &inValue, sizeof(_Type));
+		} else {
+			//serialize functions take non-const objects, but only read them here
+			_Type& value = const_cast<_Type&>(inValue);
+
+			FlatCountArchive counter;
+			serializeFields(counter, value);
+
+			std::size_t tableOffset = allocate(counter.getFieldsNum()*cFlatSlotSize);
+			setSlot(inSlotOffset, tableOffset, counter.getFieldsNum());
+
+			FlatOArchive tableArch(mBuffer, tableOffset, mValid);
+			serializeFields(tableArch, value);
+		}
+	}
+
+	/**
+	 * Writes characters of the string.
+	 */
+	void writeSlot(
+			std::size_t inSlotOffset,
+			const std::string& inValue) {
+		if(inValue.empty())
+			return;
+
+		std::size_t dataOffset = allocate(inValue.size());
+		std::memcpy(mBuffer.data() + dataOffset, inValue.data(), inValue.size());
+		setSlot(inSlotOffset, dataOffset, inValue.size());
+	}
+
+	/**
+	 * Writes vector as raw records or as slots of elements.
+	 */
+	template<typename _Type>
+	void writeSlot(
+			std::size_t inSlotOffset,
+			const std::vector<_Type>& inValue) {
+		if(inValue.empty())
+			return;
+
+		if constexpr(IsFlatRecord<_Type>::value) {
+			uint32_t recordSize = sizeof(_Type);
+			std::size_t headerOffset = allocate(cFlatSlotSize + inValue.size()*sizeof(_Type));
+			std::size_t dataOffset = headerOffset + cFlatSlotSize;
+
+			std::memcpy(mBuffer.data() + headerOffset, &recordSize, sizeof(recordSize));
+			std::memcpy(mBuffer.data() + dataOffset, inValue.data(), inValue.size()*sizeof(_Type));
+			setSlot(inSlotOffset, dataOffset, inValue.size());
+		} else {
+			std::size_t slotsOffset = allocate(inValue.size()*cFlatSlotSize);
+			setSlot(inSlotOffset, slotsOffset, inValue.size());
+
+			for(std::size_t i = 0; i < inValue.size(); i++)
+				writeSlot(slotsOffset + i*cFlatSlotSize, inValue[i]);
+		}
+	}
+
+};
+
+
+/**
+ * Archive that reads fields of a structure from the slots of it's table.
+ * Checks that all offsets are within data block.
+ */
+class FlatIArchive {
+
+	/** data to read */
+	DataBlock mData;
+
+	/** offset of the next slot to read */
+	std::size_t mSlotOffset;
+
+	/** end offset of the table slots */
+	std::size_t mSlotsEnd;
+
+	/** flag that all data was read correctly */
+	bool mValid;
+
+public:
+
+	FlatIArchive(
+			DataBlock inData,
+			std::size_t inSlotOffset,
+			std::size_t inSlotsEnd):
+		mData(inData),
+		mSlotOffset(inSlotOffset),
+		mSlotsEnd(inSlotsEnd),
+		mValid(true) {}
+
+	/**
+	 * Reads value from the next slot.
+	 * Keeps value as is if table doesn't have such slot.
+	 * @param outValue value to fill
+	 * @return archive
+	 */
+	template<typename _Type>
+	FlatIArchive& operator&(_Type& outValue) {
+		if(mSlotOffset + cFlatSlotSize <= mSlotsEnd)
+			mValid = mValid && readSlot(mSlotOffset, outValue);
+
+		mSlotOffset += cFlatSlotSize;
+		return *this;
+	}
+
+	bool isValid() const {
+		return mValid;
+	}
+
+	/**
+	 * Reads value from the root slot.
+	 * Returns false if data is absent or corrupted.
+	 * @param inData data to read
+	 * @param outValue value to fill
+	 * @return success flag
+	 */
+	template<typename _Type>
+	static bool readRoot(
+			DataBlock inData,
+			_Type& outValue) {
+		if(!inData.mDataPtr || inData.mBytesNum < cFlatSlotSize)
+			return false;
+
+		return FlatIArchive(inData, 0, cFlatSlotSize).readSlot(0, outValue);
+	}
+
+	/**
+	 * Gives in-place access to records of top-level vector field.
+	 * Returns false if field isn't a vector of such records,
+	 * or if records in data block aren't aligned for direct access.
+	 * @param inData data to read
+	 * @param inFieldIdx index of field in message field list
+	 * @param outRecordsPtr pointer to the first record
+	 * @param outRecordsNum amount of records
+	 * @return success flag
+	 */
+	template<typename _RecordType>
+	static bool getRootRecords(
+			DataBlock inData,
+			uint32_t inFieldIdx,
+			const _RecordType*& outRecordsPtr,
+			uint32_t& outRecordsNum) {
+		static_assert(IsFlatRecord<_RecordType>::value, "type isn't a flat record");
+
+		outRecordsPtr = nullptr;
+		outRecordsNum = 0;
+		if(!inData.mDataPtr || inData.mBytesNum < cFlatSlotSize)
+			return false;
+
+		FlatIArchive arch(inData, 0, cFlatSlotSize);
+		uint32_t tableOffset = 0;
+		uint32_t fieldsNum = 0;
+		arch.getSlot(0, tableOffset, fieldsNum);
+		if(inFieldIdx >= fieldsNum ||
+				!arch.hasBytes(tableOffset, uint64_t(fieldsNum)*cFlatSlotSize))
+			return false;
+
+		uint32_t dataOffset = 0;
+		uint32_t recordsNum = 0;
+		arch.getSlot(tableOffset + inFieldIdx*cFlatSlotSize, dataOffset, recordsNum);
+		if(recordsNum == 0)
+			return true;
+
+		if(!arch.hasRecords(dataOffset, recordsNum, sizeof(_RecordType)))
+			return false;
+
+		const uint8_t* dataPtr = inData.mDataPtr + dataOffset;
+		if(reinterpret_cast<std::uintptr_t>(dataPtr) % alignof(_RecordType) != 0)
+			return false;
+
+		outRecordsPtr = reinterpret_cast<const _RecordType*>(dataPtr);
+		outRecordsNum = recordsNum;
+		return true;
+	}
+
+private:
+
+	/**
+	 * Checks that data block has bytes in range.
+	 */
+	bool hasBytes(
+			uint64_t inOffset,
+			uint64_t inBytesNum) const {
+		return inOffset <= mData.mBytesNum &&
+				inBytesNum <= mData.mBytesNum - inOffset;
+	}
+
+	/**
+	 * Checks records header and that all records are within data block.
+	 */
+	bool hasRecords(
+			uint32_t inDataOffset,
+			uint32_t inRecordsNum,
+			uint32_t inRecordSize) const {
+		if(inDataOffset < cFlatSlotSize ||
+				!hasBytes(inDataOffset, uint64_t(inRecordsNum)*inRecordSize))
+			return false;
+
+		uint32_t recordSize = 0;
+		std::memcpy(&recordSize, mData.mDataPtr + inDataOffset - cFlatSlotSize,
+				sizeof(recordSize));
+		return recordSize == inRecordSize;
+	}
+
+	/**
+	 * Gets offset and amount of items from the slot.
+	 */
+	void getSlot(
+			std::size_t inSlotOffset,
+			uint32_t& outOffset,
+			uint32_t& outItemsNum) const {
+		std::memcpy(&outOffset, mData.mDataPtr + inSlotOffset, sizeof(outOffset));
+		std::memcpy(&outItemsNum, mData.mDataPtr + inSlotOffset + sizeof(outOffset),
+				sizeof(outItemsNum));
+	}
+
+	/**
+	 * Reads scalar from the slot or structure from it's table.
+	 */
+	template<typename _Type>
+	bool readSlot(
+			std::size_t inSlotOffset,
+			_Type& outValue) {
+		if constexpr(std::is_arithmetic<_Type>::value || std::is_enum<_Type>::value) {
+			std::memcpy(&outValue, mData.mDataPtr + inSlotOffset, sizeof(_Type));
+			return true;
+		} else {
+			uint32_t tableOffset = 0;
+			uint32_t fieldsNum = 0;
+			getSlot(inSlotOffset, tableOffset, fieldsNum);
+
+			uint64_t tableBytesNum = uint64_t(fieldsNum)*cFlatSlotSize;
+			if(!hasBytes(tableOffset, tableBytesNum))
+				return false;
+
+			FlatIArchive tableArch(mData, tableOffset, tableOffset + tableBytesNum);
+			serializeFields(tableArch, outValue);
+			return tableArch.isValid();
+		}
+	}
+
+	/**
+	 * Reads characters of the string.
+	 */
+	bool readSlot(
+			std::size_t inSlotOffset,
+			std::string& outValue) {
+		uint32_t dataOffset = 0;
+		uint32_t bytesNum = 0;
+		getSlot(inSlotOffset, dataOffset, bytesNum);
+
+		if(!hasBytes(dataOffset, bytesNum))
+			return false;
+
+		outValue.assign(
+				reinterpret_cast<const char*>(mData.mDataPtr + dataOffset),
+				bytesNum);
+		return true;
+	}
+
+	/**
+	 * Reads vector from raw records or from slots of elements.
+	 */
+	template<typename _Type>
+	bool readSlot(
+			std::size_t inSlotOffset,
+			std::vector<_Type>& outValue) {
+		uint32_t dataOffset = 0;
+		uint32_t itemsNum = 0;
+		getSlot(inSlotOffset, dataOffset, itemsNum);
+
+		if(itemsNum == 0) {
+			outValue.clear();
+			return true;
+		}
+
+		if constexpr(IsFlatRecord<_Type>::value) {
+			if(!hasRecords(dataOffset, itemsNum, sizeof(_Type)))
+				return false;
+
+			outValue.resize(itemsNum);
+			std::memcpy(outValue.data(), mData.mDataPtr + dataOffset,
+					itemsNum*sizeof(_Type));
+			return true;
+		} else {
+			if(!hasBytes(dataOffset, uint64_t(itemsNum)*cFlatSlotSize))
+				return false;
+
+			outValue.resize(itemsNum);
+			for(uint32_t i = 0; i < itemsNum; i++) {
+				if(!readSlot(dataOffset + i*cFlatSlotSize, outValue[i]))
+					return false;
+			}
+			return true;
+		}
+	}
+
+};
+
+
+}
+
+
+#endif /* SRC_CHANNEL_FLATBUFFER_HPP_ */
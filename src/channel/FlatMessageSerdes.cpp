@@ -0,0 +1,130 @@
+
+#include "FlatMessageSerdes.hpp"
+
+
+namespace stamask {
+
+
+/**
+ * Constructor with capacity hint of serialization buffer.
+ * @param inBufCapacityHint amount of bytes to reserve
+ */
+FlatMessageSerdes::FlatMessageSerdes(
+		std::size_t inBufCapacityHint):
+		AbsMessageSerdes(),
+		mDataBuf() {
+	mDataBuf.reserve(inBufCapacityHint);
+}
+
+/**
+ * Empty destructor.
+ */
+FlatMessageSerdes::~FlatMessageSerdes() {}
+
+/**
+ * Returns encoder ID.
+ * @return 42
+ */
+uint32_t FlatMessageSerdes::getEncoderId() const {
+	return 42;
+}
+
+/**
+ * Reserves memory in serialization buffer for expected message size.
+ * Buffer isn't shrunk if it already has more capacity.
+ * @param inBytesNum amount of bytes to reserve
+ */
+void FlatMessageSerdes::setBufferCapacityHint(std::size_t inBytesNum) {
+	mDataBuf.reserve(inBytesNum);
+}
+
+/**
+ * Returns current capacity of serialization buffer.
+ * @return amount of bytes
+ */
+std::size_t FlatMessageSerdes::getBufferCapacity() const {
+	return mDataBuf.capacity();
+}
+
+/**
+ * Serializes message and returns block with data pointer.
+ * Uses message type as an index in dispatch table of typed serializers.
+ * Returns data block with nullptr if message type isn't supported.
+ * @param inMesgType type of the message
+ * @param inMessage target message
+ * @return data block
+ */
+DataBlock FlatMessageSerdes::serializeMessage(
+		EMessageType inMesgType,
+		const Message& inMessage) {
+	static constexpr MessageDispatchTable<SerializeFuncPtr> cSerializeTable =
+			makeMessageDispatchTable<SerializeFuncPtr, SerializeThunk>(
+					AllMessagesList());
+
+	if(inMesgType >= cSerializeTable.size() ||
+			!cSerializeTable[inMesgType])
+		return {nullptr, 0};
+
+	return (this->*cSerializeTable[inMesgType])(inMessage);
+}
+
+/**
+ * Deserializes message from data block and sets data in message.
+ * Uses message type as an index in dispatch table of typed deserializers.
+ * Returns false if message type isn't supported or data is corrupted.
+ * @param inMesgType type of the message
+ * @param outMessage message to fill
+ * @param inData data to process
+ * @return operation success
+ */
+bool FlatMessageSerdes::deserializeMessage(
+		EMessageType inMesgType,
+		Message& outMessage,
+		DataBlock inData) {
+	static constexpr MessageDispatchTable<DeserializeFuncPtr> cDeserializeTable =
+			makeMessageDispatchTable<DeserializeFuncPtr, DeserializeThunk>(
+					AllMessagesList());
+
+	if(inMesgType >= cDeserializeTable.size() ||
+			!cDeserializeTable[inMesgType])
+		return false;
+
+	return (this->*cDeserializeTable[inMesgType])(outMessage, inData);
+}
+
+/**
+ * Casts base message to it's real type and writes it into the buffer.
+ * Returns pointer to the buffer data, valid until next serialization.
+ * Returns data block with nullptr if message is too large for 32-bit offsets.
+ * @param inMessage target message
+ * @return data block
+ */
+template <typename _MesgType>
+DataBlock FlatMessageSerdes::serializeThunk(
+			const Message& inMessage) {
+	if(!FlatOArchive::writeRoot(
+			mDataBuf, static_cast<const _MesgType&>(inMessage)))
+		return {nullptr, 0};
+
+	return {
+		mDataBuf.data(),
+		mDataBuf.size()
+	};
+}
+
+/**
+ * Casts base message to it's real type and reads it from the data block.
+ * @param outMessage message to fill
+ * @param inData data to process
+ * @return operation success
+ */
+template <typename _MesgType>
+bool FlatMessageSerdes::deserializeThunk(
+		Message& outMessage,
+		DataBlock inData) {
+	return FlatIArchive::readRoot(
+			inData, static_cast<_MesgType&>(outMessage));
+}
+
+
+}
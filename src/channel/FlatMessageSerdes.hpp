@@ -0,0 +1,106 @@
+#ifndef SRC_CHANNEL_FLATMESSAGESERDES_HPP_
+#define SRC_CHANNEL_FLATMESSAGESERDES_HPP_
+
+
+#include "AbsMessageSerdes.hpp"
+#include "MessageRegistry.hpp"
+#include "FlatBuffer.hpp"
+
+#include <vector>
+#include <cstddef>
+
+
+namespace stamask {
+
+
+/**
+ * Class that packs messages into fixed-layout flat buffer.
+ * Arrays of numbers and POD structures are copied as is,
+ * so big graph and timing arrays cost a single copy in both directions.
+ * Layout is described in FlatBuffer.hpp.
+ */
+class FlatMessageSerdes : public AbsMessageSerdes {
+
+	/** method to serialize message of one type */
+	typedef DataBlock (FlatMessageSerdes::*SerializeFuncPtr)(
+			const Message&);
+
+	/** method to deserialize message of one type */
+	typedef bool (FlatMessageSerdes::*DeserializeFuncPtr)(
+			Message&, DataBlock);
+
+	/** buffer where to put serialized data, reused between messages */
+	std::vector<uint8_t> mDataBuf;
+
+public:
+
+	/** default capacity to reserve in serialization buffer */
+	static constexpr std::size_t cDefaultBufCapacityHint = 20*1024;
+
+	explicit FlatMessageSerdes(
+			std::size_t inBufCapacityHint = cDefaultBufCapacityHint);
+
+	virtual ~FlatMessageSerdes();
+
+	/**
+	 * Returns encoder ID.
+	 * @return 42
+	 */
+	virtual uint32_t getEncoderId() const override;
+
+	void setBufferCapacityHint(std::size_t inBytesNum);
+
+	std::size_t getBufferCapacity() const;
+
+public:
+
+	using AbsMessageSerdes::serializeMessage;
+	using AbsMessageSerdes::deserializeMessage;
+
+	virtual DataBlock serializeMessage(
+			EMessageType inMesgType,
+			const Message& inMessage) override;
+
+	virtual bool deserializeMessage(
+			EMessageType inMesgType,
+			Message& inMessage,
+			DataBlock inData) override;
+
+protected:
+
+	template <typename _MesgType>
+	DataBlock serializeThunk(
+				const Message& inMessage);
+
+	template <typename _MesgType>
+	bool deserializeThunk(
+			Message& inMessage,
+			DataBlock inData);
+
+	/**
+	 * Provides serialization method of message type for dispatch table.
+	 */
+	template <typename _MesgType>
+	struct SerializeThunk {
+		static constexpr SerializeFuncPtr get() {
+			return &FlatMessageSerdes::serializeThunk<_MesgType>;
+		}
+	};
+
+	/**
+	 * Provides deserialization method of message type for dispatch table.
+	 */
+	template <typename _MesgType>
+	struct DeserializeThunk {
+		static constexpr DeserializeFuncPtr get() {
+			return &FlatMessageSerdes::deserializeThunk<_MesgType>;
+		}
+	};
+
+};
+
+
+}
+
+
+#endif /* SRC_CHANNEL_FLATMESSAGESERDES_HPP_ */
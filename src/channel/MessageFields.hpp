@@ -0,0 +1,951 @@
+#ifndef SRC_CHANNEL_MESSAGEFIELDS_HPP_
+#define SRC_CHANNEL_MESSAGEFIELDS_HPP_
+
+#include "Messages.hpp"
+
+
+/**
+ * Field lists of all messages and their data structures.
+ * Any archive with operator& for field types may use them,
+ * YAS reaches them through the forwarder of YasMessageSerdes.cpp.
+ */
+namespace stamask {
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandExit &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandPing &inObj) {
+	outArch & inObj.mStr & inObj.mMsTimeout;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetHierarhySeparator &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadLibertyFile &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadLibertyStream &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadCachedLiberty &inObj) {
+	outArch & inObj.mContentHash &
+		inObj.mBytesNum;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadStoredStream &inObj) {
+	outArch & inObj.mStreamMesgType &
+		inObj.mContentHash &
+		inObj.mBytesNum;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadSharedStream &inObj) {
+	outArch & inObj.mStreamMesgType &
+		inObj.mShmName &
+		inObj.mBytesNum &
+		inObj.mContentHash;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandClearLibs &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadVerilogFile &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadVerilogStream &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandLinkTop &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandClearNetlistBlocks &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		PortData &inObj) {
+	outArch &
+		inObj.mName &
+		inObj.mInput &
+		inObj.mOutput &
+		inObj.mBusFlag &
+		inObj.mRangeFrom &
+		inObj.mRangeTo &
+		inObj.mConnNetIdxsVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		InstanceData &inObj) {
+	outArch &
+		inObj.mName &
+		inObj.mMasterBlockIdx &
+		inObj.mPortDataVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		BlockData &inObj) {
+	outArch &
+		inObj.mName &
+		inObj.mTopFlag &
+		inObj.mLeafFlag &
+		inObj.mPortDataVec &
+		inObj.mInstDataVec &
+		inObj.mNetNamesVec &
+		inObj.mGndNetName &
+		inObj.mVddNetName;
+}
+
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandCreateNetlist &inObj) {
+	outArch &
+		inObj.mBlockDataVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandGetGraphData &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSaveCheckpoint &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandLoadCheckpoint &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReplayCommandLog &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandGetGraphFingerprint &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandGetGraphSlacksData &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandGetPackedGraphSlacks &inObj) {
+	outArch & inObj.mStr;
+}
+
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandConnectContextPinNet &inObj) {
+	outArch &
+		inObj.mInstContextVec &
+		inObj.mInstName &
+		inObj.mPinName &
+		inObj.mNetName;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandDisconnectContextPinNet &inObj) {
+	outArch &
+		inObj.mInstContextVec &
+		inObj.mInstName &
+		inObj.mPinName &
+		inObj.mNetName;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		InstContextData &inObj) {
+	outArch &
+		inObj.mParentIdx &
+		inObj.mInstName;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		NetlistEditData &inObj) {
+	outArch &
+		inObj.mContextIdx &
+		inObj.mEditType &
+		inObj.mInstName &
+		inObj.mMasterName &
+		inObj.mPinName &
+		inObj.mNetName;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandUpdateNetlist &inObj) {
+	outArch &
+		inObj.mInstContextsVec &
+		inObj.mEditsVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadSpefFile &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadSpefStream &inObj) {
+	outArch & inObj.mStr;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ObjectContextNameData &inObj) {
+	outArch &
+	inObj.mInstContextVec &
+	inObj.mObjName;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetGroupNetCap &inObj) {
+	outArch &
+	inObj.mNetAddrsVec &
+	inObj.mValuesVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadSdfFile &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReadSdfStream &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandWriteSdfFile &inObj) {
+	outArch & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetArcsDelays &inObj) {
+	outArch &
+		inObj.mDelayValuesVec &
+		inObj.mEdgeIdsVec &
+		inObj.mMin &
+		inObj.mMax;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ArcDelayData &inObj) {
+	outArch & inObj.mEdgeId &
+		inObj.mMinDelay &
+		inObj.mMaxDelay;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetArcsMinMaxDelays &inObj) {
+	outArch &
+		inObj.mArcDelaysVec &
+		inObj.mMin &
+		inObj.mMax;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandReportTiming &inObj) {
+	outArch &
+		inObj.mUniquePaths &
+		inObj.mMin &
+		inObj.mMax &
+		inObj.mUnconstrained &
+		inObj.mEndPointsNum &
+		inObj.mGroupsNum;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandGetTimingPaths &inObj) {
+	outArch &
+		inObj.mUniquePaths &
+		inObj.mMin &
+		inObj.mMax &
+		inObj.mUnconstrained &
+		inObj.mEndPointsNum &
+		inObj.mGroupsNum;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandGetGraphSlacksSubset &inObj) {
+	outArch &
+		inObj.mVertexIdsVec &
+		inObj.mFanInDepth &
+		inObj.mFanOutDepth &
+		inObj.mMin &
+		inObj.mMax &
+		inObj.mMinCritFactor;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandGetCritFactors &inObj) {
+	outArch &
+		inObj.mFactorBits &
+		inObj.mMin &
+		inObj.mMax;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandGetTimingSummary &inObj) {
+	outArch &
+		inObj.mHistMinSlack &
+		inObj.mHistMaxSlack &
+		inObj.mHistBinsNum;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandGetDesignStats &inObj) {
+	outArch & inObj.mStr;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandCreateClock &inObj) {
+	outArch &
+		inObj.mName &
+		inObj.mDescription &
+		inObj.mPinPathsVec &
+		inObj.mAddFlag &
+		inObj.mPeriod &
+		inObj.mWaveformVec;
+}
+
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandCreateGenClock &inObj) {
+	outArch &
+		inObj.mName &
+		inObj.mDescription &
+		inObj.mMasterClockPinPath &
+		inObj.mMasterClockName &
+		inObj.mPinPathsVec &
+		inObj.mAddFlag &
+		inObj.mDivideFactor &
+		inObj.mMultiplyFactor &
+		inObj.mDutyCycle &
+		inObj.mInvert &
+		inObj.mEdgesVec &
+		inObj.mEdgeShiftsVec;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetClockGroups &inObj) {
+	outArch &
+		inObj.mName &
+		inObj.mDescription &
+		inObj.mLogicalExclusive &
+		inObj.mPhysicalExclusive &
+		inObj.mAsynchronous &
+		inObj.mAllowPaths &
+		inObj.mClockGroupsVec;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetClockLatency &inObj) {
+	outArch &
+		inObj.mSource &
+		inObj.mMin &
+		inObj.mMax &
+		inObj.mEarly &
+		inObj.mLate &
+		inObj.mRise &
+		inObj.mFall &
+		inObj.mValue &
+		inObj.mClockName &
+		inObj.mPinPath;
+}
+
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetInterClockUncertainty &inObj) {
+	outArch &
+		inObj.mFromClockName &
+		inObj.mFromRise &
+		inObj.mFromFall &
+		inObj.mToClockName &
+		inObj.mToRise &
+		inObj.mToFall &
+		inObj.mSetup &
+		inObj.mHold &
+		inObj.mValue;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetSingleClockUncertainty &inObj) {
+	outArch &
+		inObj.mClockName &
+		inObj.mSetup &
+		inObj.mHold &
+		inObj.mValue;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetSinglePinUncertainty &inObj) {
+	outArch &
+		inObj.mPinPath &
+		inObj.mSetup &
+		inObj.mHold &
+		inObj.mValue;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetPortDelay &inObj) {
+	outArch &
+		inObj.mIsInput &
+		inObj.mClockName &
+		inObj.mClockPinPath &
+		inObj.mClockFall &
+		inObj.mLevelSensitive &
+		inObj.mDelayRise &
+		inObj.mDelayFall &
+		inObj.mDelayMax &
+		inObj.mDelayMin &
+		inObj.mAdd &
+		inObj.mNetworkLatencyInc &
+		inObj.mSourceLatencyInc &
+		inObj.mDelay &
+		inObj.mTargetPortPin;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetInPortTransition &inObj) {
+	outArch &
+		inObj.mDelayRise &
+		inObj.mDelayFall &
+		inObj.mDelayMax &
+		inObj.mDelayMin &
+		inObj.mValue &
+		inObj.mTargetPortPin;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetPortPinLoad &inObj) {
+	outArch &
+		inObj.mRise &
+		inObj.mFall &
+		inObj.mMax &
+		inObj.mMin &
+		inObj.mCap &
+		inObj.mTargetPortPin;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetFalsePath &inObj) {
+	outArch &
+		inObj.mFromRise &
+		inObj.mFromFall &
+		inObj.mFromPinPathsVec &
+		inObj.mFromClocksVec &
+		inObj.mFromInstPathsVec &
+		inObj.mThroughRise &
+		inObj.mThroughFall &
+		inObj.mThroughPinPathsVec &
+		inObj.mThroughInstPathsVec &
+		inObj.mThroughNetPathsVec &
+		inObj.mToRise &
+		inObj.mToFall &
+		inObj.mToPinPathsVec &
+		inObj.mToClocksVec &
+		inObj.mToInstPathsVec &
+		inObj.mRise &
+		inObj.mFall &
+		inObj.mSetup &
+		inObj.mHold &
+		inObj.mComment;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetMinMaxDelay &inObj) {
+	outArch &
+		inObj.mFromRise &
+		inObj.mFromFall &
+		inObj.mFromPinPathsVec &
+		inObj.mFromClocksVec &
+		inObj.mFromInstPathsVec &
+		inObj.mThroughRise &
+		inObj.mThroughFall &
+		inObj.mThroughPinPathsVec &
+		inObj.mThroughInstPathsVec &
+		inObj.mThroughNetPathsVec &
+		inObj.mToRise &
+		inObj.mToFall &
+		inObj.mToPinPathsVec &
+		inObj.mToClocksVec &
+		inObj.mToInstPathsVec &
+		inObj.mRise &
+		inObj.mFall &
+		inObj.mMinDelayFlag &
+		inObj.mValue &
+		inObj.mComment;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetMulticyclePath &inObj) {
+	outArch &
+		inObj.mFromRise &
+		inObj.mFromFall &
+		inObj.mFromPinPathsVec &
+		inObj.mFromClocksVec &
+		inObj.mFromInstPathsVec &
+		inObj.mThroughRise &
+		inObj.mThroughFall &
+		inObj.mThroughPinPathsVec &
+		inObj.mThroughInstPathsVec &
+		inObj.mThroughNetPathsVec &
+		inObj.mToRise &
+		inObj.mToFall &
+		inObj.mToPinPathsVec &
+		inObj.mToClocksVec &
+		inObj.mToInstPathsVec &
+		inObj.mRise &
+		inObj.mFall &
+		inObj.mSetup &
+		inObj.mHold &
+		inObj.mStart &
+		inObj.mEnd &
+		inObj.mValue &
+		inObj.mComment;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandDisableSinglePinTiming &inObj) {
+	outArch &
+		inObj.mPinPath;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandDisableInstTiming &inObj) {
+	outArch &
+		inObj.mInstContextVec &
+		inObj.mFromPinName &
+		inObj.mToPinName;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CommandSetGlobalTimingDerate &inObj) {
+	outArch &
+		inObj.mCellDelay &
+		inObj.mCellCheck &
+		inObj.mNetDelay &
+		inObj.mData &
+		inObj.mClock &
+		inObj.mEarly &
+		inObj.mLate &
+		inObj.mRise &
+		inObj.mFall &
+		inObj.mValue;
+}
+
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponseCommExecStatus &inObj) {
+	outArch & inObj.mExecStatus & inObj.mStr;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		EdgeIdData &inObj) {
+	outArch & inObj.mEdgeId &
+		inObj.mFromVertexId &
+		inObj.mToVertexId;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		VertexIdData &inObj) {
+	outArch & inObj.mContextInstNamesVec &
+		inObj.mIsDriver &
+		inObj.mPinName &
+		inObj.mVertexId;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponseGraphMap &inObj) {
+	outArch & inObj.mExecStatus &
+		inObj.mStr &
+		inObj.mVertexIdToDataVec &
+		inObj.mEdgeIdToDataVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		GraphFingerprintData &inObj) {
+	outArch & inObj.mGraphGeneration &
+		inObj.mGraphHash &
+		inObj.mVerticesNum &
+		inObj.mEdgesNum;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponseGraphFingerprint &inObj) {
+	outArch & inObj.mExecStatus &
+		inObj.mStr &
+		inObj.mFingerprint;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		GraphChangesData &inObj) {
+	outArch & inObj.mRemovedVertexIdsVec &
+		inObj.mRemovedEdgeIdsVec &
+		inObj.mAddedVerticesVec &
+		inObj.mAddedEdgesVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponseGraphChanges &inObj) {
+	outArch & inObj.mExecStatus &
+		inObj.mStr &
+		inObj.mChanges;
+}
+
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		NodeTimingData &inObj) {
+	outArch &
+		inObj.mClkIdx &
+		inObj.mEndPointIdx &
+		inObj.mHasEndMaxPathRat &
+		inObj.mHasEndMinPathRat &
+		inObj.mHasTiming &
+		inObj.mNonData &
+		inObj.mIsEndPoint &
+		inObj.mMaxPathRat &
+		inObj.mMinPathRat &
+		inObj.mNodeId &
+		inObj.mMaxWorstSlackAat &
+		inObj.mMaxWorstSlackRat &
+		inObj.mMinWorstSlackAat &
+		inObj.mMinWorstSlackRat;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponseGraphSlacks &inObj) {
+	outArch & inObj.mExecStatus &
+		inObj.mStr &
+		inObj.mNodeTimingsVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		PackedNodeData &inObj) {
+	outArch & inObj.mNodeId &
+		inObj.mEndPointIdx &
+		inObj.mClkIdx &
+		inObj.mFlags;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		PackedNodeTimingsData &inObj) {
+	outArch & inObj.mOffset &
+		inObj.mScale &
+		inObj.mNodesVec &
+		inObj.mValuesVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponsePackedGraphSlacks &inObj) {
+	outArch & inObj.mExecStatus &
+		inObj.mStr &
+		inObj.mPackedTimings;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		CritFactorsData &inObj) {
+	outArch & inObj.mFactorBits &
+		inObj.mMinFactors8Vec &
+		inObj.mMaxFactors8Vec &
+		inObj.mMinFactors16Vec &
+		inObj.mMaxFactors16Vec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponseCritFactors &inObj) {
+	outArch & inObj.mExecStatus &
+		inObj.mStr &
+		inObj.mFactors;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		TimingPathStageData &inObj) {
+	outArch & inObj.mVertexId &
+		inObj.mArrival &
+		inObj.mRequired &
+		inObj.mSlack;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		TimingPathData &inObj) {
+	outArch & inObj.mGroupIdx &
+		inObj.mStartVertexId &
+		inObj.mEndVertexId &
+		inObj.mFirstStageIdx &
+		inObj.mStagesNum &
+		inObj.mLaunchClkIdx &
+		inObj.mCaptureClkIdx &
+		inObj.mMin &
+		inObj.mArrival &
+		inObj.mRequired &
+		inObj.mSlack;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		TimingPathsData &inObj) {
+	outArch & inObj.mGroupNamesVec &
+		inObj.mPathsVec &
+		inObj.mStagesVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponseTimingPaths &inObj) {
+	outArch & inObj.mExecStatus &
+		inObj.mStr &
+		inObj.mPaths;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ClockTimingSummaryData &inObj) {
+	outArch & inObj.mClkIdx &
+		inObj.mEndPointsNum &
+		inObj.mMinFailingNum &
+		inObj.mMaxFailingNum &
+		inObj.mMinWNS &
+		inObj.mMaxWNS &
+		inObj.mMinTNS &
+		inObj.mMaxTNS;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		TimingSummaryData &inObj) {
+	outArch & inObj.mDesign &
+		inObj.mClocksVec &
+		inObj.mHistMinSlack &
+		inObj.mHistMaxSlack &
+		inObj.mMinHistogramVec &
+		inObj.mMaxHistogramVec;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponseTimingSummary &inObj) {
+	outArch & inObj.mExecStatus &
+		inObj.mStr &
+		inObj.mSummary;
+}
+
+template<typename _ArchiveType>
+void serializeFields(
+		_ArchiveType& outArch,
+		ResponseDesignStats &inObj) {
+	outArch &
+		inObj.mExecStatus &
+		inObj.mStr &
+		inObj.mMaxTNS &
+		inObj.mMaxWslack &
+		inObj.mMinTNS &
+		inObj.mMinWslack;
+}
+
+
+}
+
+
+#endif /* SRC_CHANNEL_MESSAGEFIELDS_HPP_ */
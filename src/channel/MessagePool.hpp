@@ -0,0 +1,174 @@
+#ifndef SRC_CHANNEL_MESSAGEPOOL_HPP_
+#define SRC_CHANNEL_MESSAGEPOOL_HPP_
+
+#include "MessageRegistry.hpp"
+
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace stamask {
+
+
+//resetting pooled instances in place: strings and vectors are cleared,
+//so they keep their capacity and refilling doesn't reallocate them.
+//Vectors of strings and name structures aren't cleared, since it frees
+//nested buffers: they are refilled with nextPooledElement and trimPooledElements
+
+/**
+ * Returns the next element of pooled vector to fill.
+ * Element kept from the previous use is reused with its capacity.
+ * @param ioVec pooled vector
+ * @param ioUsedNum amount of filled elements, is incremented
+ * @return element to fill
+ */
+template<typename _Type>
+_Type& nextPooledElement(std::vector<_Type>& ioVec, size_t& ioUsedNum) {
+	if(ioUsedNum == ioVec.size())
+		ioVec.emplace_back();
+	return ioVec[ioUsedNum++];
+}
+
+/**
+ * Drops elements of pooled vector that weren't filled in this use.
+ * Only elements over the amount of the previous use are freed.
+ * @param ioVec pooled vector
+ * @param inUsedNum amount of filled elements
+ */
+template<typename _Type>
+void trimPooledElements(std::vector<_Type>& ioVec, size_t inUsedNum) {
+	if(inUsedNum < ioVec.size())
+		ioVec.erase(ioVec.begin() + inUsedNum, ioVec.end());
+}
+
+inline void resetPooledMessage(CommandPing& ioMessage) {
+	ioMessage.mStr.clear();
+	ioMessage.mMsTimeout = 0;
+}
+
+inline void resetPooledMessage(CommandConnectContextPinNet& ioMessage) {
+	ioMessage.mNetName.clear();
+	ioMessage.mInstName.clear();
+	ioMessage.mPinName.clear();
+}
+
+inline void resetPooledMessage(CommandDisconnectContextPinNet& ioMessage) {
+	ioMessage.mNetName.clear();
+	ioMessage.mInstName.clear();
+	ioMessage.mPinName.clear();
+}
+
+inline void resetPooledMessage(CommandSetGroupNetCap& ioMessage) {
+	ioMessage.mValuesVec.clear();
+}
+
+inline void resetPooledMessage(CommandSetArcsDelays& ioMessage) {
+	ioMessage.mEdgeIdsVec.clear();
+	ioMessage.mDelayValuesVec.clear();
+	ioMessage.mMin = false;
+	ioMessage.mMax = false;
+}
+
+inline void resetPooledMessage(CommandSetArcsMinMaxDelays& ioMessage) {
+	ioMessage.mArcDelaysVec.clear();
+	ioMessage.mMin = true;
+	ioMessage.mMax = true;
+}
+
+inline void resetPooledMessage(ResponseCommExecStatus& ioMessage) {
+	ioMessage.mStr.clear();
+	ioMessage.mExecStatus = EMessageStatus::eMessageStatusUnsupported;
+}
+
+
+/**
+ * Keeps one reusable instance of every message type in the list.
+ * Strings and vectors of instances keep their capacity between uses,
+ * so sending and receiving hot messages doesn't touch the heap in steady state.
+ * Isn't thread-safe, instance stays valid until next use of the same type.
+ */
+template<typename _MesgList>
+class MessagePool;
+
+template<typename... _MesgTypes>
+class MessagePool<MessageTypeList<_MesgTypes...>> {
+
+	/** reusable instances */
+	std::tuple<_MesgTypes...> mMessages;
+
+public:
+
+	/**
+	 * Checks that message type is kept in the pool.
+	 * @return flag that type is pooled
+	 */
+	template<typename _MesgType>
+	static constexpr bool holds() {
+		return (std::is_same<_MesgType, _MesgTypes>::value || ...);
+	}
+
+	/**
+	 * Returns pooled instance reset to default state.
+	 * Resets fields in place, so top-level containers keep their capacity.
+	 * Vectors of names keep elements, they must be refilled and trimmed.
+	 * Used to fill outgoing messages.
+	 * @return message instance
+	 */
+	template<typename _MesgType>
+	_MesgType& acquire() {
+		_MesgType& message = std::get<_MesgType>(mMessages);
+		resetPooledMessage(message);
+		return message;
+	}
+
+	/**
+	 * Returns pooled instance as is, keeping even capacity of nested elements.
+	 * Used as deserialization target, that overwrites all message fields.
+	 * @return message instance
+	 */
+	template<typename _MesgType>
+	_MesgType& get() {
+		return std::get<_MesgType>(mMessages);
+	}
+
+	/**
+	 * Returns pooled instance if type is pooled, otherwise given local instance.
+	 * Allows generic code to reuse messages only of hot types.
+	 * @param inLocalMessage instance to use if type isn't pooled
+	 * @return message instance
+	 */
+	template<typename _MesgType>
+	_MesgType& getOr(_MesgType& inLocalMessage) {
+		if constexpr(holds<_MesgType>())
+			return get<_MesgType>();
+		else
+			return inLocalMessage;
+	}
+
+};
+
+
+/**
+ * Messages that are sent often with similar content.
+ * Other messages are rare or large, so aren't worth keeping in memory.
+ */
+typedef MessageTypeList<
+		CommandPing,
+		CommandConnectContextPinNet,
+		CommandDisconnectContextPinNet,
+		CommandSetGroupNetCap,
+		CommandSetArcsDelays,
+		CommandSetArcsMinMaxDelays,
+		ResponseCommExecStatus>
+	HotMessagesList;
+
+/**
+ * Pool of hot messages.
+ */
+typedef MessagePool<HotMessagesList> HotMessagePool;
+
+
+}
+
+
+#endif /* SRC_CHANNEL_MESSAGEPOOL_HPP_ */
@@ -0,0 +1,187 @@
+#ifndef SRC_CHANNEL_MESSAGEREGISTRY_HPP_
+#define SRC_CHANNEL_MESSAGEREGISTRY_HPP_
+
+#include "Messages.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace stamask {
+
+
+/**
+ * Compile-time list of message types.
+ */
+template<typename... _MesgTypes>
+struct MessageTypeList {
+	static constexpr std::size_t cSize = sizeof...(_MesgTypes);
+};
+
+
+/**
+ * Concatenation of two message type lists.
+ */
+template<typename _FirstList, typename _SecondList>
+struct MessageTypeListConcat;
+
+template<typename... _FirstTypes, typename... _SecondTypes>
+struct MessageTypeListConcat<
+			MessageTypeList<_FirstTypes...>,
+			MessageTypeList<_SecondTypes...>> {
+	typedef MessageTypeList<_FirstTypes..., _SecondTypes...> Type;
+};
+
+
+/**
+ * All commands that client sends to the server.
+ */
+typedef MessageTypeList<
+		CommandExit,
+		CommandPing,
+		CommandSetHierarhySeparator,
+
+		CommandReadLibertyFile,
+		CommandReadLibertyStream,
+		CommandClearLibs,
+
+		CommandReadVerilogFile,
+		CommandReadVerilogStream,
+		CommandLinkTop,
+		CommandClearNetlistBlocks,
+
+		CommandCreateNetlist,
+		CommandGetGraphData,
+
+		CommandConnectContextPinNet,
+		CommandDisconnectContextPinNet,
+
+		CommandReadSpefFile,
+		CommandReadSpefStream,
+
+		CommandSetGroupNetCap,
+
+		CommandReadSdfFile,
+		CommandReadSdfStream,
+		CommandWriteSdfFile,
+
+		CommandGetGraphSlacksData,
+		CommandSetArcsDelays,
+		CommandSetArcsMinMaxDelays,
+
+		CommandCreateClock,
+		CommandCreateGenClock,
+		CommandSetClockGroups,
+		CommandSetClockLatency,
+		CommandSetInterClockUncertainty,
+		CommandSetSingleClockUncertainty,
+		CommandSetSinglePinUncertainty,
+		CommandSetPortDelay,
+		CommandSetInPortTransition,
+		CommandSetPortPinLoad,
+		CommandSetFalsePath,
+		CommandSetMinMaxDelay,
+		CommandSetMulticyclePath,
+		CommandDisableSinglePinTiming,
+		CommandDisableInstTiming,
+		CommandSetGlobalTimingDerate,
+
+		CommandReportTiming,
+		CommandGetDesignStats,
+
+		CommandUpdateNetlist,
+		CommandGetGraphFingerprint,
+		CommandSaveCheckpoint,
+		CommandLoadCheckpoint,
+		CommandReplayCommandLog,
+		CommandReadCachedLiberty,
+		CommandReadStoredStream,
+		CommandReadSharedStream,
+		CommandGetTimingPaths,
+		CommandGetTimingSummary,
+		CommandGetGraphSlacksSubset,
+		CommandGetCritFactors,
+		CommandGetPackedGraphSlacks>
+	CommandMessagesList;
+
+
+/**
+ * All responses that server sends back to the client.
+ */
+typedef MessageTypeList<
+		ResponseCommExecStatus,
+		ResponseGraphMap,
+		ResponseGraphSlacks,
+		ResponseDesignStats,
+		ResponseGraphChanges,
+		ResponseGraphFingerprint,
+		ResponseTimingPaths,
+		ResponseTimingSummary,
+		ResponseCritFactors,
+		ResponsePackedGraphSlacks>
+	ResponseMessagesList;
+
+
+/**
+ * All registered messages, commands go first.
+ */
+typedef MessageTypeListConcat<
+			CommandMessagesList,
+			ResponseMessagesList>::Type
+	AllMessagesList;
+
+
+/**
+ * Checks that each message type except no-message appears in the list once.
+ * @return flag that list covers all message types
+ */
+template<typename... _MesgTypes>
+constexpr bool isCompleteMessageList(MessageTypeList<_MesgTypes...>) {
+	const EMessageType typesArr[] = {_MesgTypes::cMesgType...};
+
+	for(std::size_t type = 1; type < EMessageType::EMessageTypesNum; type++) {
+		std::size_t typeCount = 0;
+		for(EMessageType listType : typesArr) {
+			if(listType == type)
+				typeCount++;
+		}
+
+		if(typeCount != 1)
+			return false;
+	}
+
+	return true;
+}
+
+static_assert(
+		AllMessagesList::cSize + 1 == EMessageType::EMessageTypesNum,
+		"every message type must be registered in the message lists");
+static_assert(
+		isCompleteMessageList(AllMessagesList()),
+		"every message type must be registered exactly once");
+
+
+/**
+ * Dispatch table indexed directly by message type.
+ * Thunk template provides function pointer for every listed message type,
+ * slots of unlisted types are left as nullptr.
+ */
+template<typename _FuncPtrType, std::size_t _SlotsNum = EMessageType::EMessageTypesNum>
+using MessageDispatchTable = std::array<_FuncPtrType, _SlotsNum>;
+
+/**
+ * Builds dispatch table from the list of messages and thunk template.
+ * Thunk must have static constexpr method get() that returns function pointer.
+ */
+template<typename _FuncPtrType, template<typename> class _Thunk, typename... _MesgTypes>
+constexpr MessageDispatchTable<_FuncPtrType> makeMessageDispatchTable(
+		MessageTypeList<_MesgTypes...>) {
+	MessageDispatchTable<_FuncPtrType> table{};
+	((table[_MesgTypes::cMesgType] = _Thunk<_MesgTypes>::get()), ...);
+	return table;
+}
+
+
+}
+
+
+#endif /* SRC_CHANNEL_MESSAGEREGISTRY_HPP_ */
@@ -1,942 +1,1554 @@
-#ifndef SRC_NEW_MESSAGES_HPP_
-#define SRC_NEW_MESSAGES_HPP_
-
-#include <cinttypes>
-#include <string>
-#include <vector>
-#include <map>
-
-namespace stamask {
-
-/**
- * Enumeration with message types.
- */
-enum EMessageType : uint16_t {
-
-	EMessageTypeNoMessage,
-
-	//------------------------
-	//COMMANDS HERE
-	//------------------------
-
-	EMessageTypeExit,
-	EMessageTypePing,
-	EMessageTypeSetHierSeparator,
-
-	EMessageTypeReadLibFile,
-	EMessageTypeReadLibStream,
-	EMessageTypeClearLibs,
-
-
-	EMessageTypeReadVerilogFile,
-	EMessageTypeReadVerilogStream,
-	EMessageTypeLinkTop,
-	EMessageTypeClearNetlistBlocks,
-
-	EMessageTypeCreateNetlist,
-	EMessageTypeGetGraphData,
-
-	EMessageTypeConnectContextPinNet,
-	EMessageTypeDisconnectContextPinNet,
-
-	EMessageTypeReadSpefFile,
-	EMessageTypeReadSpefStream,
-
-	EMessageTypeSetGroupNetLumpCap,
-
-	EMessageTypeReadSdfFile,
-	EMessageTypeReadSdfStream,
-	EMessageTypeWriteSdfFile,
-
-	EMessageTypeGetGraphSlacksData,
-	EMessageTypeSetArcsDelay,
-
-	EMessageTypeCreateClock,
-	EMessageTypeCreateGeneratedClock,
-	EMessageTypeSetClockGroups,
-	EMessageTypeSetClockLatency,
-	EMessageTypeSetInterClockUncertainty,
-	EMessageTypeSetSingleClockUncertainty,
-	EMessageTypeSetSinglePinUncertainty,
-	EMessageTypeSetSinglePortDelay,
-	EMessageTypeSetInPortTransition,
-	EMessageTypeSetPortPinLoad,
-	EMessageTypeSetFalsePath,
-	EMessageTypeSetMinMaxDelay,
-	EMessageTypeSetMulticyclePath,
-	EMessageTypeDisableSinglePinTiming,
-	EMessageTypeDisableInstTiming,
-	EMessageTypeSetGlobalTimingDerate,
-
-	EMessageTypeReportTiming,
-	EMessageTypeGetDesignStats,
-
-	//------------------------
-	//RESPONSES HERE
-	//------------------------
-
-	EMessageTypeExecutionStatus,
-	EMessageTypeGraphMap,
-	EMessageTypeGraphSlacks,
-	EMessageTypeDesignStats,
-};
-
-
-
-/**
- * Enumeration with possible statuses of command execution.
- */
-enum EMessageStatus : uint16_t {
-	eMessageStatusTimeout = 0,
-	eMessageStatusOk = 1,
-	eMessageStatusFailed = 2,
-	eMessageStatusUnsupported = 3
-};
-
-
-//---------------------------------------------------------------
-//commands to the STA
-
-/**
- * Message to interchange commands and responses between client and server.
- * Need public data members to access them from serializers.
- */
-class Message {
-public:
-	virtual ~Message() {}
-	virtual EMessageType getMesgType() const = 0;
-};
-
-
-/**
- * Generic command with string data.
- */
-class StringMessage : public Message {
-public:
-	std::string mStr;
-
-public:
-	StringMessage():
-		mStr() {}
-};
-
-
-/**
- * Command for STA to exit.
- */
-class CommandExit : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeExit;
-	}
-};
-
-/**
- * Command to pion STA server.
- */
-class CommandPing : public StringMessage {
-public:
-	unsigned long mMsTimeout = 0;
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypePing;
-	}
-};
-
-/**
- * Command to set hierarchy separator.
- */
-class CommandSetHierarhySeparator : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetHierSeparator;
-	}
-};
-
-/**
- * Command to read liberty file.
- */
-class CommandReadLibertyFile : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeReadLibFile;
-	}
-};
-
-
-/**
- * Command to read liberty stream.
- */
-class CommandReadLibertyStream : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeReadLibStream;
-	}
-};
-
-/**
- * Command to clear liberty libraries.
- */
-class CommandClearLibs : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeClearLibs;
-	}
-};
-
-
-/**
- * Command to read Verilog file.
- */
-class CommandReadVerilogFile : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeReadVerilogFile;
-	}
-};
-
-/**
- * Command to read Verilog stream.
- */
-class CommandReadVerilogStream : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeReadVerilogStream;
-	}
-};
-
-/**
- * Command to link netlist top module.
- */
-class CommandLinkTop : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeLinkTop;
-	}
-};
-
-/**
- * Command to clear netlist blocks.
- */
-class CommandClearNetlistBlocks : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeClearNetlistBlocks;
-	}
-};
-
-
-
-/**
- * Info of a block's/instance's port/pin to transmit.
- */
-struct PortData {
-	std::string mName;
-	bool mInput;
-	bool mOutput;
-	bool mBusFlag;
-	uint32_t mRangeFrom;
-	uint32_t mRangeTo;
-
-	//vector with name indexes of connected nets
-	std::vector<uint32_t> mConnNetIdxsVec;
-};
-
-/**
- * Info of a block's instance to transmit.
- */
-struct InstanceData {
-	std::string mName;
-	uint32_t mMasterBlockIdx;
-	std::vector<PortData> mPortDataVec;
-};
-
-/**
- * Info of a single block.
- * Has info of ports, instances and nets.
- */
-struct BlockData {
-	std::string mName;
-	bool mTopFlag;
-	bool mLeafFlag;
-
-	std::vector<PortData> mPortDataVec;
-	std::vector<InstanceData> mInstDataVec;
-
-	std::vector<std::string> mNetNamesVec;
-	std::string mGndNetName;
-	std::string mVddNetName;
-};
-
-
-/**
- * Command to create and link netlist.
- */
-class CommandCreateNetlist : public Message {
-public:
-	std::vector<BlockData> mBlockDataVec;
-
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeCreateNetlist;
-	}
-};
-
-
-/**
- * Command to connect net and pin in block.
- */
-class CommandConnectContextPinNet : public Message {
-public:
-	//top-down instance context of parent block (empty for top-module)
-	std::vector<std::string> mInstContextVec;
-
-	std::string mNetName;
-	std::string mInstName;
-	std::string mPinName;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeConnectContextPinNet;
-	}
-};
-
-/**
- * Command to disconnect net and pin in block.
- * Isn't a subtype of CommandConnectPinNet not to mix them in interfaces.
- */
-class CommandDisconnectContextPinNet : public Message {
-public:
-	//top-down instance context of parent block (empty for top-module)
-	std::vector<std::string> mInstContextVec;
-	std::string mNetName;
-	std::string mInstName;
-	std::string mPinName;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeDisconnectContextPinNet;
-	}
-};
-
-
-
-
-
-/**
- * Command to read SPEF file.
- */
-class CommandReadSpefFile : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeReadSpefFile;
-	}
-};
-
-/**
- * Command to read SPEF stream.
- */
-class CommandReadSpefStream : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeReadSpefStream;
-	}
-};
-
-
-/**
- * Structure to locate net by it's name in hierarchical context.
- */
-struct ObjectContextNameData {
-	std::vector<std::string> mInstContextVec;
-	std::string mObjName;
-};
-
-
-/**
- * Command to set lump capacitance of group of nets.
- */
-class CommandSetGroupNetCap : public Message {
-public:
-	std::vector<ObjectContextNameData> mNetAddrsVec;
-	std::vector<float> mValuesVec;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetGroupNetLumpCap;
-	}
-};
-
-
-/**
- * Command to read SDF file.
- */
-class CommandReadSdfFile : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeReadSdfFile;
-	}
-};
-
-/**
- * Command to write SDF file.
- */
-class CommandWriteSdfFile : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeWriteSdfFile;
-	}
-};
-
-
-/**
- * Command to read SDF stream.
- */
-class CommandReadSdfStream : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeReadSdfStream;
-	}
-};
-
-
-/**
- * Command to set delays of several graph edges.
- */
-class CommandSetArcsDelays : public Message {
-public:
-	std::vector<uint32_t> mEdgeIdsVec;
-	std::vector<float> mDelayValuesVec; //caution! in seconds!
-	bool mMin;
-	bool mMax;
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetArcsDelay;
-	}
-};
-
-/**
- * Command to get mapping of timing graph IDs to netlist paths.
- */
-class CommandGetGraphData : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeGetGraphData;
-	}
-};
-
-/**
- * Command to get slacks of all vertexes in timing graph.
- */
-class CommandGetGraphSlacksData : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeGetGraphSlacksData;
-	}
-};
-
-
-//==================================
-
-/**
- * Command to create clock source.
- * Empty source pins bucket makes the clock virtual.
- */
-class CommandCreateClock : public Message {
-public:
-	std::string mName;
-	std::string mDescription;
-	std::vector<ObjectContextNameData> mPinPathsVec;
-	bool mAddFlag;
-	float mPeriod;
-	std::vector<float> mWaveformVec;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeCreateClock;
-	}
-};
-
-
-
-/**
- * Command to create generated clock source.
- */
-class CommandCreateGenClock : public Message {
-public:
-	std::string mName;
-	std::string mDescription;
-	ObjectContextNameData mMasterClockPinPath;
-	std::string mMasterClockName;
-	std::vector<ObjectContextNameData> mPinPathsVec;
-	bool mAddFlag;
-    int mDivideFactor;
-	int mMultiplyFactor;
-    float mDutyCycle;
-    bool mInvert;
-    std::vector<int> mEdgesVec;
-	std::vector<float> mEdgeShiftsVec;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeCreateGeneratedClock;
-	}
-};
-
-
-
-
-/**
- * Command to set relations between clock groups.
- */
-class CommandSetClockGroups : public Message {
-public:
-	std::string mName;
-	std::string mDescription;
-	bool mLogicalExclusive;
-	bool mPhysicalExclusive;
-	bool mAsynchronous;
-	bool mAllowPaths;
-	std::vector<std::vector<std::string>> mClockGroupsVec;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetClockGroups;
-	}
-};
-
-
-
-/**
- * Command to set clock latency.
- */
-class CommandSetClockLatency : public Message {
-public:
-	bool mSource;
-	bool mMin;
-	bool mMax;
-	bool mEarly;
-	bool mLate;
-	bool mRise;
-	bool mFall;
-	float mValue;
-	std::string mClockName;
-	ObjectContextNameData mPinPath;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetClockLatency;
-	}
-};
-
-
-/**
- * Command to set clock uncertainty between two clocks.
- */
-class CommandSetInterClockUncertainty : public Message {
-public:
-	std::string mFromClockName;
-	bool mFromRise;
-	bool mFromFall;
-	std::string mToClockName;
-	bool mToRise;
-	bool mToFall;
-	bool mSetup;
-	bool mHold;
-	float mValue;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetInterClockUncertainty;
-	}
-};
-
-
-/**
- * Command to set clock uncertainty of single clock.
- */
-class CommandSetSingleClockUncertainty : public Message {
-public:
-	std::string mClockName;
-	bool mSetup;
-	bool mHold;
-	float mValue;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetSingleClockUncertainty;
-	}
-};
-
-
-/**
- * Command to set clock uncertainty of single pin.
- */
-class CommandSetSinglePinUncertainty : public Message {
-public:
-	ObjectContextNameData mPinPath;
-	bool mSetup;
-	bool mHold;
-	float mValue;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetSinglePinUncertainty;
-	}
-};
-
-
-/**
- * Command to set delay of single port.
- */
-class CommandSetPortDelay : public Message {
-public:
-	bool mIsInput;
-	std::string mClockName;
-	ObjectContextNameData mClockPinPath;
-	bool mClockFall;
-	bool mLevelSensitive;
-	bool mDelayRise;
-	bool mDelayFall;
-	bool mDelayMax;
-	bool mDelayMin;
-	bool mAdd;
-	bool mNetworkLatencyInc;
-	bool mSourceLatencyInc;
-	float mDelay;
-	ObjectContextNameData mTargetPortPin;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetSinglePortDelay;
-	}
-};
-
-
-/**
- * Command to set delay of single port.
- */
-class CommandSetInPortTransition : public Message {
-public:
-	bool mDelayRise;
-	bool mDelayFall;
-	bool mDelayMax;
-	bool mDelayMin;
-	float mValue;
-	ObjectContextNameData mTargetPortPin;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetInPortTransition;
-	}
-};
-
-
-/**
- * Command to set pin load of single port.
- */
-class CommandSetPortPinLoad : public Message {
-public:
-	bool mRise;
-	bool mFall;
-	bool mMax;
-	bool mMin;
-	float mCap;
-	ObjectContextNameData mTargetPortPin;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetPortPinLoad;
-	}
-};
-
-
-/**
- * Basic message to transmit relations of timing paths.
- */
-class TimingPathMessageBase : public Message {
-public:
-	bool mFromRise;
-	bool mFromFall;
-	std::vector<ObjectContextNameData> mFromPinPathsVec;
-	std::vector<std::string> mFromClocksVec;
-	std::vector<ObjectContextNameData> mFromInstPathsVec;
-
-	bool mThroughRise;
-	bool mThroughFall;
-	std::vector<ObjectContextNameData> mThroughPinPathsVec;
-	std::vector<ObjectContextNameData> mThroughInstPathsVec;
-	std::vector<ObjectContextNameData> mThroughNetPathsVec;
-
-	bool mToRise;
-	bool mToFall;
-	std::vector<ObjectContextNameData> mToPinPathsVec;
-	std::vector<std::string> mToClocksVec;
-	std::vector<ObjectContextNameData> mToInstPathsVec;
-
-	bool mRise;
-	bool mFall;
-};
-
-
-/**
- * Command to set false path.
- */
-class CommandSetFalsePath : public TimingPathMessageBase {
-public:
-	bool mSetup;
-	bool mHold;
-	std::string mComment;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetFalsePath;
-	}
-};
-
-
-/**
- * Command to set min/max delay of paths.
- */
-class CommandSetMinMaxDelay : public TimingPathMessageBase {
-public:
-	bool mMinDelayFlag;
-	float mValue;
-	std::string mComment;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetMinMaxDelay;
-	}
-};
-
-/**
- * Command to set multicycle paths.
- */
-class CommandSetMulticyclePath : public TimingPathMessageBase {
-public:
-	bool mSetup;
-	bool mHold;
-	bool mStart;
-	bool mEnd;
-	int mValue;
-	std::string mComment;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetMulticyclePath;
-	}
-};
-
-/**
- * Command to disable timing of single pin.
- */
-class CommandDisableSinglePinTiming : public Message {
-public:
-	ObjectContextNameData mPinPath;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeDisableSinglePinTiming;
-	}
-};
-
-/**
- * Command to disable timing between two pins of an instance.
- */
-class CommandDisableInstTiming : public Message {
-public:
-	std::vector<std::string> mInstContextVec;
-	std::string mFromPinName;
-	std::string mToPinName;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeDisableInstTiming;
-	}
-};
-
-
-
-/**
- * Command to disable timing between two pins of an instance.
- */
-class CommandSetGlobalTimingDerate : public Message {
-public:
-	bool mCellDelay;
-	bool mCellCheck;
-	bool mNetDelay;
-	bool mData;
-	bool mClock;
-	bool mEarly;
-	bool mLate;
-	bool mRise;
-	bool mFall;
-	float mValue;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeSetGlobalTimingDerate;
-	}
-};
-
-//========================================
-
-
-/**
- * Command to report timing.
- */
-class CommandReportTiming : public Message {
-public:
-	bool mUniquePaths = true;
-	bool mMin = false;
-	bool mMax = true;
-	bool mUnconstrained = false;
-	uint32_t mEndPointsNum = 1;
-	uint32_t mGroupsNum = 1;
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeReportTiming;
-	}
-};
-
-
-/**
- * Command to report main design statistics.
- */
-class CommandGetDesignStats : public StringMessage {
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeGetDesignStats;
-	}
-};
-
-
-//---------------------------------------------------------------
-//responses to commands execution
-
-
-
-/**
- * Response with status of execution.
- * Also string can contain timing report as a successful response.
- */
-class ResponseCommExecStatus : public StringMessage {
-public:
-	EMessageStatus mExecStatus =
-			EMessageStatus::eMessageStatusUnsupported;
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeExecutionStatus;
-	}
-};
-
-
-
-/**
- * Data of the vertex in timing graph.
- */
-struct VertexIdData {
-	std::vector<std::string> mContextInstNamesVec;
-	std::string mPinName;
-	bool mIsDriver;
-	uint32_t mVertexId;
-};
-
-/**
- * Data of the edge in timing graph.
- */
-struct EdgeIdData {
-	uint32_t mFromVertexId;
-	uint32_t mToVertexId;
-	uint32_t mEdgeId;
-};
-
-/**
- * Response message with mapping of vertexes and edges of timing graph.
- */
-class ResponseGraphMap : public ResponseCommExecStatus {
-public:
-	//index is also a vertex ID, if ID != index, then there's no such vertex
-	std::vector<VertexIdData> mVertexIdToDataVec;
-
-	//same indexing applies for the edges
-	std::vector<EdgeIdData> mEdgeIdToDataVec;
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeGraphMap;
-	}
-};
-
-
-
-/**
- * Timing data of graph's node.
- * Edge timing may be derived from data of two vertices.
- */
-struct NodeTimingData {
-	uint32_t mNodeId = -1;
-	bool mIsEndPoint = false;
-
-	//flag to mark nodes that have no constraints
-	bool mHasTiming = false;
-
-	/** flag that path belongs to non-data paths */
-	bool mNonData = false;
-
-	//for min-max slacks of both setup and hold analysis, rise/fall doesn't matter
-	float mMinWorstSlackRat = -1e30;
-	float mMinWorstSlackAat = 1e30;
-	float mMaxWorstSlackRat = 1e30;
-	float mMaxWorstSlackAat = -1e30;
-
-	//flag to mark RAT of path endpoint, useful to calculate criticalness
-	bool mHasEndMaxPathRat = false;
-	float mMaxPathRat = 0;
-
-	bool mHasEndMinPathRat = false;
-	float mMinPathRat = 0;
-
-	//need this to convert slacks into critical factors based on RATs of their own endpoints
-	uint32_t mEndPointIdx = -1;
-
-	int mClkIdx = 0;
-};
-
-
-/**
- * Response message with timing of graph entities.
- */
-class ResponseGraphSlacks : public ResponseCommExecStatus {
-public:
-	std::vector<NodeTimingData> mNodeTimingsVec;
-
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeGraphSlacks;
-	}
-};
-
-/**
- * Response with main design statistics.
- */
-class ResponseDesignStats : public ResponseCommExecStatus {
-public:
-	float mMinWslack = 0;
-	float mMaxWslack = 0;
-	float mMinTNS = 0;
-	float mMaxTNS = 0;
-public:
-	virtual EMessageType getMesgType() const {
-		return EMessageType::EMessageTypeDesignStats;
-	}
-};
-
-
-
-
-
-}
-
-
-
-#endif /* SRC_NEW_MESSAGES_HPP_ */
+#ifndef SRC_NEW_MESSAGES_HPP_
+#define SRC_NEW_MESSAGES_HPP_
+
+#include "common/TimingData.hpp"
+
+#include <cinttypes>
+#include <string>
+#include <vector>
+#include <map>
+
+namespace stamask {
+
+/**
+ * Enumeration with message types.
+ */
+enum EMessageType : uint16_t {
+
+	EMessageTypeNoMessage,
+
+	//------------------------
+	//COMMANDS HERE
+	//------------------------
+
+	EMessageTypeExit,
+	EMessageTypePing,
+	EMessageTypeSetHierSeparator,
+
+	EMessageTypeReadLibFile,
+	EMessageTypeReadLibStream,
+	EMessageTypeClearLibs,
+
+
+	EMessageTypeReadVerilogFile,
+	EMessageTypeReadVerilogStream,
+	EMessageTypeLinkTop,
+	EMessageTypeClearNetlistBlocks,
+
+	EMessageTypeCreateNetlist,
+	EMessageTypeGetGraphData,
+
+	EMessageTypeConnectContextPinNet,
+	EMessageTypeDisconnectContextPinNet,
+
+	EMessageTypeReadSpefFile,
+	EMessageTypeReadSpefStream,
+
+	EMessageTypeSetGroupNetLumpCap,
+
+	EMessageTypeReadSdfFile,
+	EMessageTypeReadSdfStream,
+	EMessageTypeWriteSdfFile,
+
+	EMessageTypeGetGraphSlacksData,
+	EMessageTypeSetArcsDelay,
+
+	EMessageTypeCreateClock,
+	EMessageTypeCreateGeneratedClock,
+	EMessageTypeSetClockGroups,
+	EMessageTypeSetClockLatency,
+	EMessageTypeSetInterClockUncertainty,
+	EMessageTypeSetSingleClockUncertainty,
+	EMessageTypeSetSinglePinUncertainty,
+	EMessageTypeSetSinglePortDelay,
+	EMessageTypeSetInPortTransition,
+	EMessageTypeSetPortPinLoad,
+	EMessageTypeSetFalsePath,
+	EMessageTypeSetMinMaxDelay,
+	EMessageTypeSetMulticyclePath,
+	EMessageTypeDisableSinglePinTiming,
+	EMessageTypeDisableInstTiming,
+	EMessageTypeSetGlobalTimingDerate,
+
+	EMessageTypeReportTiming,
+	EMessageTypeGetDesignStats,
+
+	//------------------------
+	//RESPONSES HERE
+	//------------------------
+
+	EMessageTypeExecutionStatus,
+	EMessageTypeGraphMap,
+	EMessageTypeGraphSlacks,
+	EMessageTypeDesignStats,
+
+	//------------------------
+	//NEWER MESSAGES HERE
+	//appended to keep numbers of older ones
+	//------------------------
+
+	EMessageTypeUpdateNetlist,
+	EMessageTypeGraphChanges,
+	EMessageTypeGetGraphFingerprint,
+	EMessageTypeGraphFingerprint,
+	EMessageTypeSaveCheckpoint,
+	EMessageTypeLoadCheckpoint,
+	EMessageTypeReplayCommandLog,
+	EMessageTypeReadCachedLib,
+	EMessageTypeReadStoredStream,
+	EMessageTypeReadSharedStream,
+	EMessageTypeGetTimingPaths,
+	EMessageTypeTimingPaths,
+	EMessageTypeGetTimingSummary,
+	EMessageTypeTimingSummary,
+	EMessageTypeGetGraphSlacksSubset,
+	EMessageTypeGetCritFactors,
+	EMessageTypeCritFactors,
+	EMessageTypeGetPackedGraphSlacks,
+	EMessageTypePackedGraphSlacks,
+	EMessageTypeSetArcsMinMaxDelays,
+
+	//amount of message types, must stay the last one
+	EMessageTypesNum
+};
+
+
+
+/**
+ * Enumeration with possible statuses of command execution.
+ */
+enum EMessageStatus : uint16_t {
+	eMessageStatusTimeout = 0,
+	eMessageStatusOk = 1,
+	eMessageStatusFailed = 2,
+	eMessageStatusUnsupported = 3,
+	eMessageStatusNotFound = 4
+};
+
+
+//---------------------------------------------------------------
+//commands to the STA
+
+/**
+ * Message to interchange commands and responses between client and server.
+ * Need public data members to access them from serializers.
+ */
+class Message {
+public:
+	virtual ~Message() {}
+	virtual EMessageType getMesgType() const = 0;
+};
+
+
+/**
+ * Generic command with string data.
+ */
+class StringMessage : public Message {
+public:
+	std::string mStr;
+
+public:
+	StringMessage():
+		mStr() {}
+};
+
+
+/**
+ * Command for STA to exit.
+ */
+class CommandExit : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeExit;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to pion STA server.
+ */
+class CommandPing : public StringMessage {
+public:
+	unsigned long mMsTimeout = 0;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypePing;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to set hierarchy separator.
+ */
+class CommandSetHierarhySeparator : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetHierSeparator;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to read liberty file.
+ */
+class CommandReadLibertyFile : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadLibFile;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to read liberty stream.
+ * Non-empty content hash lets executor cache parsed library under it,
+ * hash is SHA-256 of the text in hex digits.
+ * Hash isn't sent, server fills it for the executor.
+ */
+class CommandReadLibertyStream : public StringMessage {
+public:
+	std::string mContentHash;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadLibStream;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to read liberty that was parsed before from executor's cache.
+ * Library is identified by SHA-256 content hash and size of liberty text.
+ * Executor fails the command if library isn't cached.
+ * Server handles it as stored liberty stream, so it isn't logged by hash.
+ */
+class CommandReadCachedLiberty : public Message {
+public:
+	std::string mContentHash;
+	uint64_t mBytesNum = 0;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadCachedLib;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to execute stream command with text that server has stored before.
+ * Text is identified by SHA-256 content hash and size.
+ * Server responds with not-found status if it doesn't have the text.
+ */
+class CommandReadStoredStream : public Message {
+public:
+	EMessageType mStreamMesgType = EMessageType::EMessageTypeNoMessage;
+	std::string mContentHash;
+	uint64_t mBytesNum = 0;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadStoredStream;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to execute stream command with text in shared memory object.
+ * Client creates the object, server maps it read-only,
+ * client removes it after the response.
+ */
+class CommandReadSharedStream : public Message {
+public:
+	EMessageType mStreamMesgType = EMessageType::EMessageTypeNoMessage;
+	std::string mShmName;
+	uint64_t mBytesNum = 0;
+	std::string mContentHash;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadSharedStream;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to clear liberty libraries.
+ */
+class CommandClearLibs : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeClearLibs;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to read Verilog file.
+ */
+class CommandReadVerilogFile : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadVerilogFile;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to read Verilog stream.
+ */
+class CommandReadVerilogStream : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadVerilogStream;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to link netlist top module.
+ */
+class CommandLinkTop : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeLinkTop;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to clear netlist blocks.
+ */
+class CommandClearNetlistBlocks : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeClearNetlistBlocks;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+/**
+ * Info of a block's/instance's port/pin to transmit.
+ */
+struct PortData {
+	std::string mName;
+	bool mInput;
+	bool mOutput;
+	bool mBusFlag;
+	uint32_t mRangeFrom;
+	uint32_t mRangeTo;
+
+	//vector with name indexes of connected nets
+	std::vector<uint32_t> mConnNetIdxsVec;
+};
+
+/**
+ * Info of a block's instance to transmit.
+ */
+struct InstanceData {
+	std::string mName;
+	uint32_t mMasterBlockIdx;
+	std::vector<PortData> mPortDataVec;
+};
+
+/**
+ * Info of a single block.
+ * Has info of ports, instances and nets.
+ */
+struct BlockData {
+	std::string mName;
+	bool mTopFlag;
+	bool mLeafFlag;
+
+	std::vector<PortData> mPortDataVec;
+	std::vector<InstanceData> mInstDataVec;
+
+	std::vector<std::string> mNetNamesVec;
+	std::string mGndNetName;
+	std::string mVddNetName;
+};
+
+
+/**
+ * Command to create and link netlist.
+ */
+class CommandCreateNetlist : public Message {
+public:
+	std::vector<BlockData> mBlockDataVec;
+
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeCreateNetlist;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to connect net and pin in block.
+ */
+class CommandConnectContextPinNet : public Message {
+public:
+	//top-down instance context of parent block (empty for top-module)
+	std::vector<std::string> mInstContextVec;
+
+	std::string mNetName;
+	std::string mInstName;
+	std::string mPinName;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeConnectContextPinNet;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to disconnect net and pin in block.
+ * Isn't a subtype of CommandConnectPinNet not to mix them in interfaces.
+ */
+class CommandDisconnectContextPinNet : public Message {
+public:
+	//top-down instance context of parent block (empty for top-module)
+	std::vector<std::string> mInstContextVec;
+	std::string mNetName;
+	std::string mInstName;
+	std::string mPinName;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeDisconnectContextPinNet;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Types of netlist edits.
+ */
+enum ENetlistEditType : uint32_t {
+	eNetlistEditAddInst = 0,
+	eNetlistEditRemoveInst = 1,
+	eNetlistEditAddNet = 2,
+	eNetlistEditRemoveNet = 3,
+	eNetlistEditConnect = 4,
+	eNetlistEditDisconnect = 5
+};
+
+/**
+ * Node of instance contexts prefix tree.
+ * Context of the node is the context of parent node plus the instance,
+ * so contexts with common top part share their nodes.
+ */
+struct InstContextData {
+	//index of parent node, root node is the top-block context
+	uint32_t mParentIdx = 0;
+	//instance name in parent context, empty for root node
+	std::string mInstName;
+};
+
+/**
+ * Single edit of the netlist inside of instance context.
+ * Names that edit type doesn't need stay empty.
+ */
+struct NetlistEditData {
+	//index of instance context node in the command
+	uint32_t mContextIdx = 0;
+	ENetlistEditType mEditType = ENetlistEditType::eNetlistEditConnect;
+
+	std::string mInstName;
+	//master block name of added instance
+	std::string mMasterName;
+	std::string mPinName;
+	std::string mNetName;
+};
+
+/**
+ * Command to apply batch of netlist edits in given order.
+ * Edits share instance contexts, that are interned as prefix tree
+ * so every instance name is sent once.
+ */
+class CommandUpdateNetlist : public Message {
+public:
+	//prefix tree of edited instance contexts, parents go before children
+	std::vector<InstContextData> mInstContextsVec;
+
+	std::vector<NetlistEditData> mEditsVec;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeUpdateNetlist;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+
+
+/**
+ * Command to read SPEF file.
+ */
+class CommandReadSpefFile : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadSpefFile;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to read SPEF stream.
+ */
+class CommandReadSpefStream : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadSpefStream;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Structure to locate net by it's name in hierarchical context.
+ */
+struct ObjectContextNameData {
+	std::vector<std::string> mInstContextVec;
+	std::string mObjName;
+};
+
+
+/**
+ * Command to set lump capacitance of group of nets.
+ */
+class CommandSetGroupNetCap : public Message {
+public:
+	std::vector<ObjectContextNameData> mNetAddrsVec;
+	std::vector<float> mValuesVec;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetGroupNetLumpCap;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to read SDF file.
+ */
+class CommandReadSdfFile : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadSdfFile;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to write SDF file.
+ */
+class CommandWriteSdfFile : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeWriteSdfFile;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to read SDF stream.
+ */
+class CommandReadSdfStream : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReadSdfStream;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to set delays of several graph edges.
+ */
+class CommandSetArcsDelays : public Message {
+public:
+	std::vector<uint32_t> mEdgeIdsVec;
+	std::vector<float> mDelayValuesVec; //caution! in seconds!
+	bool mMin;
+	bool mMax;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetArcsDelay;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to set min and max delays of several graph edges at once.
+ * Flags select which of the delays are applied.
+ */
+class CommandSetArcsMinMaxDelays : public Message {
+public:
+	std::vector<ArcDelayData> mArcDelaysVec;
+	bool mMin = true;
+	bool mMax = true;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetArcsMinMaxDelays;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to get mapping of timing graph IDs to netlist paths.
+ */
+class CommandGetGraphData : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGetGraphData;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to save state of STA engine in checkpoint.
+ * String is a path prefix of checkpoint files.
+ */
+class CommandSaveCheckpoint : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSaveCheckpoint;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to restore state of STA engine from checkpoint.
+ * String is a path prefix of checkpoint files.
+ */
+class CommandLoadCheckpoint : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeLoadCheckpoint;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to execute batch of logged commands at once.
+ * String is a command log data, see \link CommandLog::saveToString
+ */
+class CommandReplayCommandLog : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReplayCommandLog;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to get fingerprint of current timing graph.
+ */
+class CommandGetGraphFingerprint : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGetGraphFingerprint;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to get slacks of all vertexes in timing graph.
+ */
+class CommandGetGraphSlacksData : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGetGraphSlacksData;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to get timing data of all graph nodes
+ * with RATs and AATs reduced to 16-bit fixed-point numbers.
+ */
+class CommandGetPackedGraphSlacks : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGetPackedGraphSlacks;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+//==================================
+
+/**
+ * Command to create clock source.
+ * Empty source pins bucket makes the clock virtual.
+ */
+class CommandCreateClock : public Message {
+public:
+	std::string mName;
+	std::string mDescription;
+	std::vector<ObjectContextNameData> mPinPathsVec;
+	bool mAddFlag;
+	float mPeriod;
+	std::vector<float> mWaveformVec;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeCreateClock;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+/**
+ * Command to create generated clock source.
+ */
+class CommandCreateGenClock : public Message {
+public:
+	std::string mName;
+	std::string mDescription;
+	ObjectContextNameData mMasterClockPinPath;
+	std::string mMasterClockName;
+	std::vector<ObjectContextNameData> mPinPathsVec;
+	bool mAddFlag;
+    int mDivideFactor;
+	int mMultiplyFactor;
+    float mDutyCycle;
+    bool mInvert;
+    std::vector<int> mEdgesVec;
+	std::vector<float> mEdgeShiftsVec;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeCreateGeneratedClock;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+
+/**
+ * Command to set relations between clock groups.
+ */
+class CommandSetClockGroups : public Message {
+public:
+	std::string mName;
+	std::string mDescription;
+	bool mLogicalExclusive;
+	bool mPhysicalExclusive;
+	bool mAsynchronous;
+	bool mAllowPaths;
+	std::vector<std::vector<std::string>> mClockGroupsVec;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetClockGroups;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+/**
+ * Command to set clock latency.
+ */
+class CommandSetClockLatency : public Message {
+public:
+	bool mSource;
+	bool mMin;
+	bool mMax;
+	bool mEarly;
+	bool mLate;
+	bool mRise;
+	bool mFall;
+	float mValue;
+	std::string mClockName;
+	ObjectContextNameData mPinPath;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetClockLatency;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to set clock uncertainty between two clocks.
+ */
+class CommandSetInterClockUncertainty : public Message {
+public:
+	std::string mFromClockName;
+	bool mFromRise;
+	bool mFromFall;
+	std::string mToClockName;
+	bool mToRise;
+	bool mToFall;
+	bool mSetup;
+	bool mHold;
+	float mValue;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetInterClockUncertainty;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to set clock uncertainty of single clock.
+ */
+class CommandSetSingleClockUncertainty : public Message {
+public:
+	std::string mClockName;
+	bool mSetup;
+	bool mHold;
+	float mValue;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetSingleClockUncertainty;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to set clock uncertainty of single pin.
+ */
+class CommandSetSinglePinUncertainty : public Message {
+public:
+	ObjectContextNameData mPinPath;
+	bool mSetup;
+	bool mHold;
+	float mValue;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetSinglePinUncertainty;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to set delay of single port.
+ */
+class CommandSetPortDelay : public Message {
+public:
+	bool mIsInput;
+	std::string mClockName;
+	ObjectContextNameData mClockPinPath;
+	bool mClockFall;
+	bool mLevelSensitive;
+	bool mDelayRise;
+	bool mDelayFall;
+	bool mDelayMax;
+	bool mDelayMin;
+	bool mAdd;
+	bool mNetworkLatencyInc;
+	bool mSourceLatencyInc;
+	float mDelay;
+	ObjectContextNameData mTargetPortPin;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetSinglePortDelay;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to set delay of single port.
+ */
+class CommandSetInPortTransition : public Message {
+public:
+	bool mDelayRise;
+	bool mDelayFall;
+	bool mDelayMax;
+	bool mDelayMin;
+	float mValue;
+	ObjectContextNameData mTargetPortPin;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetInPortTransition;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to set pin load of single port.
+ */
+class CommandSetPortPinLoad : public Message {
+public:
+	bool mRise;
+	bool mFall;
+	bool mMax;
+	bool mMin;
+	float mCap;
+	ObjectContextNameData mTargetPortPin;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetPortPinLoad;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Basic message to transmit relations of timing paths.
+ */
+class TimingPathMessageBase : public Message {
+public:
+	bool mFromRise;
+	bool mFromFall;
+	std::vector<ObjectContextNameData> mFromPinPathsVec;
+	std::vector<std::string> mFromClocksVec;
+	std::vector<ObjectContextNameData> mFromInstPathsVec;
+
+	bool mThroughRise;
+	bool mThroughFall;
+	std::vector<ObjectContextNameData> mThroughPinPathsVec;
+	std::vector<ObjectContextNameData> mThroughInstPathsVec;
+	std::vector<ObjectContextNameData> mThroughNetPathsVec;
+
+	bool mToRise;
+	bool mToFall;
+	std::vector<ObjectContextNameData> mToPinPathsVec;
+	std::vector<std::string> mToClocksVec;
+	std::vector<ObjectContextNameData> mToInstPathsVec;
+
+	bool mRise;
+	bool mFall;
+};
+
+
+/**
+ * Command to set false path.
+ */
+class CommandSetFalsePath : public TimingPathMessageBase {
+public:
+	bool mSetup;
+	bool mHold;
+	std::string mComment;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetFalsePath;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to set min/max delay of paths.
+ */
+class CommandSetMinMaxDelay : public TimingPathMessageBase {
+public:
+	bool mMinDelayFlag;
+	float mValue;
+	std::string mComment;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetMinMaxDelay;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to set multicycle paths.
+ */
+class CommandSetMulticyclePath : public TimingPathMessageBase {
+public:
+	bool mSetup;
+	bool mHold;
+	bool mStart;
+	bool mEnd;
+	int mValue;
+	std::string mComment;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetMulticyclePath;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to disable timing of single pin.
+ */
+class CommandDisableSinglePinTiming : public Message {
+public:
+	ObjectContextNameData mPinPath;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeDisableSinglePinTiming;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to disable timing between two pins of an instance.
+ */
+class CommandDisableInstTiming : public Message {
+public:
+	std::vector<std::string> mInstContextVec;
+	std::string mFromPinName;
+	std::string mToPinName;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeDisableInstTiming;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+/**
+ * Command to disable timing between two pins of an instance.
+ */
+class CommandSetGlobalTimingDerate : public Message {
+public:
+	bool mCellDelay;
+	bool mCellCheck;
+	bool mNetDelay;
+	bool mData;
+	bool mClock;
+	bool mEarly;
+	bool mLate;
+	bool mRise;
+	bool mFall;
+	float mValue;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeSetGlobalTimingDerate;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+//========================================
+
+
+/**
+ * Command to report timing.
+ */
+class CommandReportTiming : public Message {
+public:
+	bool mUniquePaths = true;
+	bool mMin = false;
+	bool mMax = true;
+	bool mUnconstrained = false;
+	uint32_t mEndPointsNum = 1;
+	uint32_t mGroupsNum = 1;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeReportTiming;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+/**
+ * Command to get critical timing paths as arrays of graph IDs and numbers.
+ * Options are the same as for timing report.
+ */
+class CommandGetTimingPaths : public Message {
+public:
+	bool mUniquePaths = true;
+	bool mMin = false;
+	bool mMax = true;
+	bool mUnconstrained = false;
+	uint32_t mEndPointsNum = 1;
+	uint32_t mGroupsNum = 1;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGetTimingPaths;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to get timing data of a subset of graph nodes.
+ * Subset has given vertices with their fan-in/fan-out cones up to given depth,
+ * all vertices are taken if none are given.
+ * Positive criticality threshold keeps only nodes with min or max
+ * criticality not less than it.
+ */
+class CommandGetGraphSlacksSubset : public Message {
+public:
+	std::vector<uint32_t> mVertexIdsVec;
+	uint32_t mFanInDepth = 0;
+	uint32_t mFanOutDepth = 0;
+	bool mMin = true;
+	bool mMax = true;
+	float mMinCritFactor = 0;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGetGraphSlacksSubset;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to get criticality factors of all graph nodes computed on server side.
+ * Factors are quantized to fixed-point numbers of 8 or 16 bits.
+ */
+class CommandGetCritFactors : public Message {
+public:
+	uint8_t mFactorBits = 8;
+	bool mMin = true;
+	bool mMax = true;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGetCritFactors;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to get endpoint slack summary of the design and of each clock.
+ * Histogram range is split in equal bins,
+ * slacks out of the range go to the first and the last bins.
+ * Zero amount of bins skips histograms.
+ */
+class CommandGetTimingSummary : public Message {
+public:
+	float mHistMinSlack = -1e-9;
+	float mHistMaxSlack = 1e-9;
+	uint32_t mHistBinsNum = 32;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGetTimingSummary;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Command to report main design statistics.
+ */
+class CommandGetDesignStats : public StringMessage {
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGetDesignStats;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+//---------------------------------------------------------------
+//responses to commands execution
+
+
+
+/**
+ * Response with status of execution.
+ * Also string can contain timing report as a successful response.
+ */
+class ResponseCommExecStatus : public StringMessage {
+public:
+	EMessageStatus mExecStatus =
+			EMessageStatus::eMessageStatusUnsupported;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeExecutionStatus;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+/**
+ * Data of the vertex in timing graph.
+ */
+struct VertexIdData {
+	std::vector<std::string> mContextInstNamesVec;
+	std::string mPinName;
+	bool mIsDriver;
+	uint32_t mVertexId;
+};
+
+/**
+ * Data of the edge in timing graph.
+ */
+struct EdgeIdData {
+	uint32_t mFromVertexId;
+	uint32_t mToVertexId;
+	uint32_t mEdgeId;
+};
+
+/**
+ * Response message with mapping of vertexes and edges of timing graph.
+ */
+class ResponseGraphMap : public ResponseCommExecStatus {
+public:
+	//index is also a vertex ID, if ID != index, then there's no such vertex
+	std::vector<VertexIdData> mVertexIdToDataVec;
+
+	//same indexing applies for the edges
+	std::vector<EdgeIdData> mEdgeIdToDataVec;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGraphMap;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+/**
+ * Changes of timing graph made by netlist edits.
+ * Removed IDs may be recycled for added entities of the same batch,
+ * so removals must be applied before additions.
+ */
+struct GraphChangesData {
+	std::vector<uint32_t> mRemovedVertexIdsVec;
+	std::vector<uint32_t> mRemovedEdgeIdsVec;
+
+	//vertex ID is taken from the data, not the index in vector
+	std::vector<VertexIdData> mAddedVerticesVec;
+	std::vector<EdgeIdData> mAddedEdgesVec;
+};
+
+/**
+ * Response message with graph changes after netlist update.
+ */
+class ResponseGraphChanges : public ResponseCommExecStatus {
+public:
+	GraphChangesData mChanges;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGraphChanges;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+/**
+ * Response message with timing of graph entities.
+ */
+class ResponseGraphSlacks : public ResponseCommExecStatus {
+public:
+	std::vector<NodeTimingData> mNodeTimingsVec;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGraphSlacks;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Flags of node timing data in packed form.
+ */
+enum EPackedNodeFlag : uint8_t {
+	ePackedNodeEndPoint = 1,
+	ePackedNodeHasTiming = 2,
+	ePackedNodeNonData = 4,
+	ePackedNodeHasEndMaxPathRat = 8,
+	ePackedNodeHasEndMinPathRat = 16
+};
+
+/**
+ * Timing values of node timing data in packed form,
+ * in order of value columns.
+ */
+enum EPackedNodeValue : uint8_t {
+	ePackedNodeMinWorstSlackRat = 0,
+	ePackedNodeMinWorstSlackAat,
+	ePackedNodeMaxWorstSlackRat,
+	ePackedNodeMaxWorstSlackAat,
+	ePackedNodeMaxPathRat,
+	ePackedNodeMinPathRat,
+
+	//amount of value columns, must stay the last one
+	ePackedNodeValuesNum
+};
+
+/**
+ * Non-timing fields of node timing data in packed form.
+ */
+struct PackedNodeData {
+	uint32_t mNodeId = -1;
+	uint32_t mEndPointIdx = -1;
+	int mClkIdx = 0;
+	uint8_t mFlags = 0;
+};
+
+/**
+ * Node timing data with timing values as 16-bit fixed-point numbers.
+ * Value is offset + code * scale, the min and the max codes
+ * stand for unset -1e30 and 1e30 values.
+ * Values go in columns of nodes amount, one column per value kind.
+ */
+struct PackedNodeTimingsData {
+	float mOffset = 0;
+	float mScale = 1;
+	std::vector<PackedNodeData> mNodesVec;
+	std::vector<int16_t> mValuesVec;
+};
+
+/**
+ * Response with packed timing data of graph nodes.
+ */
+class ResponsePackedGraphSlacks : public ResponseCommExecStatus {
+public:
+	PackedNodeTimingsData mPackedTimings;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypePackedGraphSlacks;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Quantized criticality factors indexed by vertex ID.
+ * Only vectors of requested modes and bits are filled,
+ * factor 1 is the max value of fixed-point type.
+ */
+struct CritFactorsData {
+	uint8_t mFactorBits = 8;
+	std::vector<uint8_t> mMinFactors8Vec;
+	std::vector<uint8_t> mMaxFactors8Vec;
+	std::vector<uint16_t> mMinFactors16Vec;
+	std::vector<uint16_t> mMaxFactors16Vec;
+};
+
+/**
+ * Response with quantized criticality factors.
+ */
+class ResponseCritFactors : public ResponseCommExecStatus {
+public:
+	CritFactorsData mFactors;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeCritFactors;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Response with critical timing paths.
+ */
+class ResponseTimingPaths : public ResponseCommExecStatus {
+public:
+	TimingPathsData mPaths;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeTimingPaths;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Response with endpoint slack summary.
+ */
+class ResponseTimingSummary : public ResponseCommExecStatus {
+public:
+	TimingSummaryData mSummary;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeTimingSummary;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Identity of timing graph state.
+ * Generation changes with every modification of the graph,
+ * hash covers vertex paths and edges, so it survives server restarts.
+ */
+struct GraphFingerprintData {
+	uint64_t mGraphGeneration = 0;
+	uint64_t mGraphHash = 0;
+	uint32_t mVerticesNum = 0;
+	uint32_t mEdgesNum = 0;
+};
+
+/**
+ * Response with fingerprint of timing graph.
+ */
+class ResponseGraphFingerprint : public ResponseCommExecStatus {
+public:
+	GraphFingerprintData mFingerprint;
+
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeGraphFingerprint;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+/**
+ * Response with main design statistics.
+ */
+class ResponseDesignStats : public ResponseCommExecStatus {
+public:
+	float mMinWslack = 0;
+	float mMaxWslack = 0;
+	float mMinTNS = 0;
+	float mMaxTNS = 0;
+public:
+	static constexpr EMessageType cMesgType =
+			EMessageType::EMessageTypeDesignStats;
+
+	virtual EMessageType getMesgType() const {
+		return cMesgType;
+	}
+};
+
+
+
+
+
+}
+
+
+
+#endif /* SRC_NEW_MESSAGES_HPP_ */
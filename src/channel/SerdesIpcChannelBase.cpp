@@ -1,91 +1,148 @@
-
-#include "SerdesIpcChannelBase.hpp"
-
-#include <string>
-
-namespace stamask {
-
-/**
- * Constructor that sets serdes to use.
- * Doesn't throw anything if serdes pointer is null.
- * @param inSerDesPtr serdes pointer
- */
-SerdesIpcChannelBase::SerdesIpcChannelBase(
-		AbsMessageSerdes* inSerDesPtr):
-				IpcChannel(),
-				mSerdesPtr(inSerDesPtr) {}
-
-/**
- * Deletes serdes if is was set.
- */
-SerdesIpcChannelBase::~SerdesIpcChannelBase() {
-	//cleaning up serdes
-	if(mSerdesPtr)
-		delete mSerdesPtr;
-}
-
-
-/**
- * Returns encoder ID of serdes.
- * If serdes is null, then returns -1 = max(uint32).
- * @return encoder ID
- */
-uint32_t SerdesIpcChannelBase::getEncoderId() const {
-	if(!mSerdesPtr)
-		return -1;
-
-	return mSerdesPtr->getEncoderId();
-}
-
-/**
- * Uses serdes to pack message and send the data block.
- * Returns failed status if serdes is null or send failed.
- * Otherwise returns OK status.
- * @param inMessage message to send
- * @return send status
- */
-EMessageStatus SerdesIpcChannelBase::send(
-						const Message& inMessage)  {
-	if(!mSerdesPtr)
-		return EMessageStatus::eMessageStatusFailed;
-
-	try {
-		if(!sendDataBlock(
-				inMessage.getMesgType(),
-				mSerdesPtr->serializeMessage(inMessage)))
-			return EMessageStatus::eMessageStatusFailed;
-	} catch(...) {
-		return EMessageStatus::eMessageStatusFailed;
-	}
-
-	return EMessageStatus::eMessageStatusOk;
-}
-
-/**
- * Picks data block of received message and fills message with it.
- * Returns failed status if serdes is null or send failed.
- * Returns failed status if data block is null or failed to fill data.
- * Otherwise returns OK status.
- * @param outResponse message where to fill data
- * @return receive status
- */
-EMessageStatus SerdesIpcChannelBase::popMessage(
-						Message& outResponse) {
-	if(!mSerdesPtr)
-		return EMessageStatus::eMessageStatusFailed;
-
-	DataBlock blk = getMessageDataBlock();
-	if(!blk.mDataPtr)
-		return EMessageStatus::eMessageStatusFailed;
-
-	if(!mSerdesPtr->deserializeMessage(outResponse, blk))
-		return EMessageStatus::eMessageStatusFailed;
-
-	return EMessageStatus::eMessageStatusOk;
-}
-
-
-
-}
-
-
+
+#include "SerdesIpcChannelBase.hpp"
+
+#include <string>
+
+namespace stamask {
+
+/**
+ * Constructor that sets serdes to use.
+ * Doesn't throw anything if serdes pointer is null.
+ * @param inSerDesPtr serdes pointer
+ */
+SerdesIpcChannelBase::SerdesIpcChannelBase(
+		AbsMessageSerdes* inSerDesPtr):
+				IpcChannel(),
+				mSerdesVec(),
+				mSerdesPtr(inSerDesPtr) {
+	if(inSerDesPtr)
+		mSerdesVec.push_back(inSerDesPtr);
+}
+
+/**
+ * Constructor that sets several serdes to choose from.
+ * Serdes go in order of preference, the first one is active.
+ * Skips null pointers, doesn't throw anything if there's no serdes at all.
+ * @param inSerdesVec serdes pointers
+ */
+SerdesIpcChannelBase::SerdesIpcChannelBase(
+		const std::vector<AbsMessageSerdes*>& inSerdesVec):
+				IpcChannel(),
+				mSerdesVec(),
+				mSerdesPtr(nullptr) {
+	for(AbsMessageSerdes* serdesPtr : inSerdesVec) {
+		if(serdesPtr)
+			mSerdesVec.push_back(serdesPtr);
+	}
+
+	if(!mSerdesVec.empty())
+		mSerdesPtr = mSerdesVec.front();
+}
+
+/**
+ * Deletes all set serdes.
+ */
+SerdesIpcChannelBase::~SerdesIpcChannelBase() {
+	//cleaning up serdes
+	for(AbsMessageSerdes* serdesPtr : mSerdesVec)
+		delete serdesPtr;
+}
+
+
+/**
+ * Returns encoder ID of serdes.
+ * If serdes is null, then returns -1 = max(uint32).
+ * @return encoder ID
+ */
+uint32_t SerdesIpcChannelBase::getEncoderId() const {
+	if(!mSerdesPtr)
+		return -1;
+
+	return mSerdesPtr->getEncoderId();
+}
+
+/**
+ * Returns encoder IDs of all serdes in order of preference.
+ * @return encoder IDs
+ */
+std::vector<uint32_t> SerdesIpcChannelBase::getSupportedEncoderIds() const {
+	std::vector<uint32_t> encoderIdsVec;
+	for(const AbsMessageSerdes* serdesPtr : mSerdesVec)
+		encoderIdsVec.push_back(serdesPtr->getEncoderId());
+
+	return encoderIdsVec;
+}
+
+/**
+ * Makes serdes with given encoder ID active.
+ * Keeps active serdes and returns false if there's no such encoder.
+ * @param inEncoderId encoder ID
+ * @return success flag
+ */
+bool SerdesIpcChannelBase::selectEncoder(uint32_t inEncoderId) {
+	for(AbsMessageSerdes* serdesPtr : mSerdesVec) {
+		if(serdesPtr->getEncoderId() != inEncoderId)
+			continue;
+
+		mSerdesPtr = serdesPtr;
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * Uses serdes to pack message and send the data block.
+ * Returns failed status if serdes is null or send failed.
+ * Otherwise returns OK status.
+ * @param inMessage message to send
+ * @return send status
+ */
+EMessageStatus SerdesIpcChannelBase::send(
+						const Message& inMessage)  {
+	if(!mSerdesPtr)
+		return EMessageStatus::eMessageStatusFailed;
+
+	//message type is resolved once and passed to serdes dispatch
+	EMessageType mesgType = inMessage.getMesgType();
+
+	try {
+		if(!sendDataBlock(
+				mesgType,
+				mSerdesPtr->serializeMessage(mesgType, inMessage)))
+			return EMessageStatus::eMessageStatusFailed;
+	} catch(...) {
+		return EMessageStatus::eMessageStatusFailed;
+	}
+
+	return EMessageStatus::eMessageStatusOk;
+}
+
+/**
+ * Picks data block of received message and fills message with it.
+ * Returns failed status if serdes is null or send failed.
+ * Returns failed status if data block is null or failed to fill data.
+ * Otherwise returns OK status.
+ * @param outResponse message where to fill data
+ * @return receive status
+ */
+EMessageStatus SerdesIpcChannelBase::popMessage(
+						Message& outResponse) {
+	if(!mSerdesPtr)
+		return EMessageStatus::eMessageStatusFailed;
+
+	DataBlock blk = getMessageDataBlock();
+	if(!blk.mDataPtr)
+		return EMessageStatus::eMessageStatusFailed;
+
+	if(!mSerdesPtr->deserializeMessage(outResponse, blk))
+		return EMessageStatus::eMessageStatusFailed;
+
+	return EMessageStatus::eMessageStatusOk;
+}
+
+
+
+}
+
+
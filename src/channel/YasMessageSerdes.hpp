@@ -1,126 +1,210 @@
-#ifndef SRC_CHANNEL_YASMESSAGESERDES_HPP_
-#define SRC_CHANNEL_YASMESSAGESERDES_HPP_
-
-
-#include "AbsMessageSerdes.hpp"
-
-#include "yas/mem_streams.hpp"
-#include "yas/binary_iarchive.hpp"
-#include "yas/binary_oarchive.hpp"
-#include "yas/types/std/vector.hpp"
-#include "yas/types/std/string.hpp"
-#include "yas/types/std/map.hpp"
-#include "yas/types/std/pair.hpp"
-
-#include <iostream>
-
-
-namespace stamask {
-
-
-/**
- * Class that uses YAS serializer to target messages
- */
-class YasMessageSerdes : public AbsMessageSerdes {
-
-	/** buffer where to put serialized data */
-    yas::shared_buffer mDataBuf;
-
-public:
-
-    /**
-     * Default constructor.
-     */
-    YasMessageSerdes();
-
-    /**
-     * Empty destructor.
-     */
-	virtual ~YasMessageSerdes();
-
-	/**
-	 * Returns encoder ID.
-	 * @return 41
-	 */
-	virtual uint32_t getEncoderId() const override;
-
-public:
-
-	virtual DataBlock serializeMessage(
-			const Message& inMessage) override;
-
-	virtual bool deserializeMessage(
-			Message& inMessage,
-			DataBlock inData) override;
-
-protected:
-
-	template <typename _MesgType>
-	DataBlock serialize(
-				const _MesgType& inMessage);
-
-	template <typename _MesgType>
-	bool deserialize(
-			_MesgType& inMessage,
-			DataBlock inData);
-
-};
-
-
-/**
- * Creates output stream and adds there data.
- * Returns pointer to the streams data buffer.
- * @param inMessage target message
- * @return data block
- */
-template <typename _MesgType>
-DataBlock YasMessageSerdes::serialize(
-			const _MesgType& inMessage) {
-	yas::mem_ostream oStream;
-	yas::binary_oarchive<yas::mem_ostream, yas::binary | yas::no_header> oArch(oStream);
-	oArch & inMessage;
-	mDataBuf = oStream.get_shared_buffer();
-
-	//std::cout << "Sent #bytes" << mDataBuf.size << std::endl;
-	//print_bytes(mDataBuf.data.get(), mDataBuf.size);
-
-	return {
-		reinterpret_cast<const uint8_t *>(mDataBuf.data.get()),
-		mDataBuf.size
-	};
-}
-
-
-/**
- * Initializes stream with the data pointer and fills message data.
- * Does nothing and returns false if input data pointer is null.
- * @param inMessage target message
- * @param inData data block
- * @return success flag
- */
-template <typename _MesgType>
-bool YasMessageSerdes::deserialize(
-		_MesgType& inMessage,
-		DataBlock inData) {
-	if(!inData.mDataPtr)
-		return false;
-
-	//std::cout << "Recieved #bytes" << inData.mBytesNum << std::endl;
-	//print_bytes(inData.mDataPtr, inData.mBytesNum);
-
-    yas::mem_istream iStream(
-    		inData.mDataPtr,
-			inData.mBytesNum);
-    yas::binary_iarchive<yas::mem_istream, yas::binary | yas::no_header> iArch(iStream);
-    iArch & inMessage;
-
-    return true;
-}
-
-
-
-
-}
-
-
-#endif /* SRC_CHANNEL_YASMESSAGESERDES_HPP_ */
+#ifndef SRC_CHANNEL_YASMESSAGESERDES_HPP_
+#define SRC_CHANNEL_YASMESSAGESERDES_HPP_
+
+
+#include "AbsMessageSerdes.hpp"
+#include "MessageRegistry.hpp"
+
+#include "yas/mem_streams.hpp"
+#include "yas/binary_iarchive.hpp"
+#include "yas/binary_oarchive.hpp"
+#include "yas/types/std/vector.hpp"
+#include "yas/types/std/string.hpp"
+#include "yas/types/std/map.hpp"
+#include "yas/types/std/pair.hpp"
+
+#include <iostream>
+#include <vector>
+#include <cstddef>
+
+
+namespace stamask {
+
+
+/**
+ * Output stream for YAS archives that appends data to external byte buffer.
+ * Stream doesn't clear or shrink the buffer, so buffer keeps it's capacity.
+ */
+class YasBufferOStream {
+
+	/** buffer to append data to */
+	std::vector<uint8_t>& mBuffer;
+
+public:
+
+	explicit YasBufferOStream(std::vector<uint8_t>& ioBuffer):
+		mBuffer(ioBuffer) {}
+
+	/**
+	 * Appends bytes to the buffer.
+	 * @param inDataPtr data pointer
+	 * @param inBytesNum amount of bytes
+	 * @return amount of written bytes
+	 */
+	template<typename _DataType>
+	std::size_t write(
+			const _DataType* inDataPtr,
+			std::size_t inBytesNum) {
+		const uint8_t* bytesPtr = reinterpret_cast<const uint8_t*>(inDataPtr);
+		mBuffer.insert(mBuffer.end(), bytesPtr, bytesPtr + inBytesNum);
+		return inBytesNum;
+	}
+
+};
+
+
+/**
+ * Class that uses YAS serializer to target messages
+ */
+class YasMessageSerdes : public AbsMessageSerdes {
+
+	/** method to serialize message of one type */
+	typedef DataBlock (YasMessageSerdes::*SerializeFuncPtr)(
+			const Message&);
+
+	/** method to deserialize message of one type */
+	typedef bool (YasMessageSerdes::*DeserializeFuncPtr)(
+			Message&, DataBlock);
+
+	/** buffer where to put serialized data, reused between messages */
+	std::vector<uint8_t> mDataBuf;
+
+public:
+
+	/** default capacity to reserve in serialization buffer */
+	static constexpr std::size_t cDefaultBufCapacityHint = 20*1024;
+
+	explicit YasMessageSerdes(
+			std::size_t inBufCapacityHint = cDefaultBufCapacityHint);
+
+    /**
+     * Empty destructor.
+     */
+	virtual ~YasMessageSerdes();
+
+	/**
+	 * Returns encoder ID.
+	 * @return 41
+	 */
+	virtual uint32_t getEncoderId() const override;
+
+	void setBufferCapacityHint(std::size_t inBytesNum);
+
+	std::size_t getBufferCapacity() const;
+
+public:
+
+	using AbsMessageSerdes::serializeMessage;
+	using AbsMessageSerdes::deserializeMessage;
+
+	virtual DataBlock serializeMessage(
+			EMessageType inMesgType,
+			const Message& inMessage) override;
+
+	virtual bool deserializeMessage(
+			EMessageType inMesgType,
+			Message& inMessage,
+			DataBlock inData) override;
+
+protected:
+
+	template <typename _MesgType>
+	DataBlock serializeThunk(
+				const Message& inMessage);
+
+	template <typename _MesgType>
+	bool deserializeThunk(
+			Message& inMessage,
+			DataBlock inData);
+
+	/**
+	 * Provides serialization method of message type for dispatch table.
+	 */
+	template <typename _MesgType>
+	struct SerializeThunk {
+		static constexpr SerializeFuncPtr get() {
+			return &YasMessageSerdes::serializeThunk<_MesgType>;
+		}
+	};
+
+	/**
+	 * Provides deserialization method of message type for dispatch table.
+	 */
+	template <typename _MesgType>
+	struct DeserializeThunk {
+		static constexpr DeserializeFuncPtr get() {
+			return &YasMessageSerdes::deserializeThunk<_MesgType>;
+		}
+	};
+
+	template <typename _MesgType>
+	DataBlock serialize(
+				const _MesgType& inMessage);
+
+	template <typename _MesgType>
+	bool deserialize(
+			_MesgType& inMessage,
+			DataBlock inData);
+
+};
+
+
+/**
+ * Resets serialization buffer and adds there data.
+ * Buffer keeps it's capacity, so it isn't reallocated for similar messages.
+ * Returns pointer to the buffer data, valid until next serialization.
+ * @param inMessage target message
+ * @return data block
+ */
+template <typename _MesgType>
+DataBlock YasMessageSerdes::serialize(
+			const _MesgType& inMessage) {
+	mDataBuf.clear();
+
+	YasBufferOStream oStream(mDataBuf);
+	yas::binary_oarchive<YasBufferOStream, yas::binary | yas::no_header> oArch(oStream);
+	oArch & inMessage;
+
+	//std::cout << "Sent #bytes" << mDataBuf.size() << std::endl;
+	//print_bytes(mDataBuf.data(), mDataBuf.size());
+
+	return {
+		mDataBuf.data(),
+		mDataBuf.size()
+	};
+}
+
+
+/**
+ * Initializes stream with the data pointer and fills message data.
+ * Does nothing and returns false if input data pointer is null.
+ * @param inMessage target message
+ * @param inData data block
+ * @return success flag
+ */
+template <typename _MesgType>
+bool YasMessageSerdes::deserialize(
+		_MesgType& inMessage,
+		DataBlock inData) {
+	if(!inData.mDataPtr)
+		return false;
+
+	//std::cout << "Recieved #bytes" << inData.mBytesNum << std::endl;
+	//print_bytes(inData.mDataPtr, inData.mBytesNum);
+
+    yas::mem_istream iStream(
+    		inData.mDataPtr,
+			inData.mBytesNum);
+    yas::binary_iarchive<yas::mem_istream, yas::binary | yas::no_header> iArch(iStream);
+    iArch & inMessage;
+
+    return true;
+}
+
+
+
+
+}
+
+
+#endif /* SRC_CHANNEL_YASMESSAGESERDES_HPP_ */
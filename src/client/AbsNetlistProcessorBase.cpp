@@ -1,182 +1,364 @@
-#include "AbsNetlistProcessorBase.hpp"
-
-#include <unordered_map>
-#include <map>
-
-namespace stamask {
-
-
-/**
- * Empty constructor.
- */
-AbsNetlistProcessorBase::AbsNetlistProcessorBase() {}
-
-
-/**
- * Empty destructor.
- */
-AbsNetlistProcessorBase::~AbsNetlistProcessorBase() {}
-
-
-/**
- * Recursively fills block's content data in command's vector.
- */
-bool AbsNetlistProcessorBase::fillBlockData(
-						const GenericBlock* inBlockPtr,
-						std::vector<BlockData>& ioBlockDataVec,
-						BlockPtrToIdUMap& ioBlockToIdxUMap,
-						bool inTopFlag) {
-	if(!inBlockPtr)
-		return false;
-
-	//ignoring block if it was already registered
-	auto blockNameIt = ioBlockToIdxUMap.find(inBlockPtr);
-	if(blockNameIt != ioBlockToIdxUMap.end())
-		return true;
-
-	BlockData realData;
-
-	uint32_t blockId = ioBlockDataVec.size();
-	ioBlockToIdxUMap.emplace(inBlockPtr, blockId);
-	//adding an initial dummy
-	ioBlockDataVec.push_back(BlockData());
-
-	realData.mName = getName(inBlockPtr);
-	realData.mTopFlag = inTopFlag;
-	realData.mLeafFlag = isLeafBlock(inBlockPtr);
-
-
-	StringToIdMap netNameToIdxMap;
-	//filling the nets, mapping their names to vector indexes
-	if(!fillBlockNets(
-		nullptr, inBlockPtr,
-		realData, netNameToIdxMap))
-	return false;
-
-	//filling the ports (without bits, only single and busses)
-	if(!fillObjectPorts<const GenericBlock, BlockData, GenericPort>(
-			inBlockPtr,
-			realData,
-			netNameToIdxMap,
-			true))
-		return false;
-
-	if(realData.mLeafFlag) {
-		ioBlockDataVec[blockId] = realData;
-		return true;
-	}
-
-	//filling the instances (without hierarchy, only the children on the block)
-	if(!fillBlockInsts(
-			nullptr, inBlockPtr,
-			ioBlockDataVec,ioBlockToIdxUMap,
-			netNameToIdxMap, realData))
-		return false;
-
-	ioBlockDataVec[blockId] = realData;
-	return true;
-}
-
-/**
- * Fills net names in block data, maps them to indexes.
- */
-bool AbsNetlistProcessorBase::fillBlockNets(
-						const GenericInst* inParentInstPtr,
-						const GenericBlock* inBlockPtr,
-						BlockData& ioBlockData,
-						StringToIdMap& outNetNameToIdxMap) {
-	if(!inBlockPtr)
-		return false;
-
-	//getting nets and adding all net indexes
-	std::vector<GenericNet*> netsVec;
-	getBlockNets(inParentInstPtr, inBlockPtr, netsVec);
-
-	uint32_t netId = 0;
-	std::string netName;
-	auto netIt = outNetNameToIdxMap.begin();
-	for(GenericNet* netPtr : netsVec) {
-		if(!netPtr)
-			continue;
-
-		if(isBus(netPtr))
-			continue;
-
-		netName = getName(netPtr);
-		netIt = outNetNameToIdxMap.find(netName);
-		if(netIt != outNetNameToIdxMap.end())
-			continue;
-
-		netId = ioBlockData.mNetNamesVec.size();
-		ioBlockData.mNetNamesVec.push_back(netName);
-		outNetNameToIdxMap.emplace(netName, netId);
-
-		if(hasGndSource(netPtr))
-			ioBlockData.mGndNetName = netName;
-		if(hasVddSource(netPtr))
-			ioBlockData.mVddNetName = netName;
-
-	}
-
-	return true;
-}
-
-/**
- * Adds data for all instance children of the block.
- * If master of the instance wasn't registered, then fills data for the master.
- * Returns false on null object,
- * failed master registration or failed ports data collection.
- */
-bool AbsNetlistProcessorBase::fillBlockInsts(
-						const GenericInst* inParentInstPtr,
-						const GenericBlock* inBlockPtr,
-						std::vector<BlockData>& ioBlockDataVec,
-						BlockPtrToIdUMap& ioBlockToIdxUMap,
-						const StringToIdMap& inNetNameToIdxMap,
-						BlockData& ioBlockData) {
-	if(!inBlockPtr)
-		return false;
-
-	//adding info of all ports
-	std::vector<GenericInst*> instsVec;
-	GenericBlock* masterPtr = nullptr;
-	auto masterIdxIt = ioBlockToIdxUMap.begin();
-
-	getBlockInsts(inParentInstPtr, inBlockPtr, instsVec);
-	for(auto instPtr : instsVec) {
-		if(!instPtr)
-			continue;
-
-		masterPtr = getMasterBlock(instPtr);
-		masterIdxIt = ioBlockToIdxUMap.find(masterPtr);
-		//have to dive into a unregistered block
-		if(masterIdxIt == ioBlockToIdxUMap.end()) {
-			fillBlockData(
-					masterPtr, ioBlockDataVec,
-					ioBlockToIdxUMap, false);
-		}
-
-		masterIdxIt = ioBlockToIdxUMap.find(masterPtr);
-		//nothing will help if it didn't appear
-		if(masterIdxIt == ioBlockToIdxUMap.end())
-			return false;
-
-		InstanceData data;
-		data.mName = getName(instPtr);
-		data.mMasterBlockIdx = masterIdxIt->second;
-
-		if(!fillObjectPorts<GenericInst, InstanceData, GenericPin>(
-				instPtr, data, inNetNameToIdxMap, true))
-			return false;
-
-		ioBlockData.mInstDataVec.push_back(data);
-	}
-
-	return true;
-}
-
-
-}
-
-
-
+#include "AbsNetlistProcessorBase.hpp"
+
+#include <unordered_map>
+#include <map>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <exception>
+#include <system_error>
+
+namespace stamask {
+
+
+/**
+ * Constructor, fills blocks data in the calling thread by default.
+ */
+AbsNetlistProcessorBase::AbsNetlistProcessorBase():
+		mFillThreadsNum(1),
+		mNameCacheMutex(),
+		mBlockNamesUMap(),
+		mInstNamesUMap(),
+		mNetNamesUMap(),
+		mPinNamesUMap(),
+		mPortNamesUMap() {}
+
+
+/**
+ * Empty destructor.
+ */
+AbsNetlistProcessorBase::~AbsNetlistProcessorBase() {}
+
+
+/**
+ * Sets amount of threads to fill data of blocks.
+ * With more than one thread netlist accessors are called concurrently
+ * for different blocks, so subclass must allow parallel reads of the netlist.
+ * Zero is treated as one.
+ * @param inThreadsNum amount of threads
+ */
+void AbsNetlistProcessorBase::setFillThreadsNum(uint32_t inThreadsNum) {
+	mFillThreadsNum = std::max<uint32_t>(inThreadsNum, 1);
+}
+
+/**
+ * Returns amount of threads to fill data of blocks.
+ * @return amount of threads
+ */
+uint32_t AbsNetlistProcessorBase::getFillThreadsNum() const {
+	return mFillThreadsNum;
+}
+
+
+/**
+ * Drops all cached names.
+ * Must be called when netlist objects are renamed or deleted,
+ * otherwise new object at the same address gets name of the old one.
+ */
+void AbsNetlistProcessorBase::clearNameCache() {
+	std::unique_lock<std::shared_mutex> writeLock(mNameCacheMutex);
+	mBlockNamesUMap.clear();
+	mInstNamesUMap.clear();
+	mNetNamesUMap.clear();
+	mPinNamesUMap.clear();
+	mPortNamesUMap.clear();
+}
+
+/**
+ * Returns cached name of the block.
+ * See \link internName
+ */
+std::string_view AbsNetlistProcessorBase::getNameView(
+						const GenericBlock* inBlockPtr) const {
+	return internName(inBlockPtr, mBlockNamesUMap);
+}
+
+/**
+ * Returns cached name of the instance.
+ * See \link internName
+ */
+std::string_view AbsNetlistProcessorBase::getNameView(
+						const GenericInst* inInstPtr) const {
+	return internName(inInstPtr, mInstNamesUMap);
+}
+
+/**
+ * Returns cached name of the net.
+ * See \link internName
+ */
+std::string_view AbsNetlistProcessorBase::getNameView(
+						const GenericNet* inNetPtr) const {
+	return internName(inNetPtr, mNetNamesUMap);
+}
+
+/**
+ * Returns cached name of the pin.
+ * See \link internName
+ */
+std::string_view AbsNetlistProcessorBase::getNameView(
+						const GenericPin* inPinPtr) const {
+	return internName(inPinPtr, mPinNamesUMap);
+}
+
+/**
+ * Returns cached name of the port.
+ * See \link internName
+ */
+std::string_view AbsNetlistProcessorBase::getNameView(
+						const GenericPort* inPortPtr) const {
+	return internName(inPortPtr, mPortNamesUMap);
+}
+
+
+/**
+ * Fills data of the block and all unique masters under it in command's vector.
+ * First collects unregistered masters and assigns their indexes in DFS order,
+ * then fills blocks independently of each other.
+ * With several fill threads blocks are processed by a pool of workers.
+ * The first exception thrown in a worker stops the others
+ * and is rethrown in the calling thread after they are joined.
+ * Returns false if some block is null or fails to fill it's data.
+ */
+bool AbsNetlistProcessorBase::fillBlockData(
+						const GenericBlock* inBlockPtr,
+						std::vector<BlockData>& ioBlockDataVec,
+						BlockPtrToIdUMap& ioBlockToIdxUMap,
+						bool inTopFlag) {
+	if(!inBlockPtr)
+		return false;
+
+	//ignoring block if it was already registered
+	if(ioBlockToIdxUMap.count(inBlockPtr))
+		return true;
+
+	std::size_t firstBlockId = ioBlockDataVec.size();
+	std::vector<const GenericBlock*> blocksVec;
+	if(!collectBlocks(
+			inBlockPtr, firstBlockId,
+			ioBlockToIdxUMap, blocksVec))
+		return false;
+
+	ioBlockDataVec.resize(firstBlockId + blocksVec.size());
+
+	//indexes are assigned, so blocks are independent now
+	std::atomic<std::size_t> nextBlockIdx(0);
+	std::atomic<bool> allOk(true);
+	std::mutex errorMutex;
+	std::exception_ptr errorPtr;
+	auto fillBlocks = [&]() {
+		try {
+			for(std::size_t blockIdx = nextBlockIdx++;
+					blockIdx < blocksVec.size() && allOk;
+					blockIdx = nextBlockIdx++) {
+				if(!fillSingleBlockData(
+						blocksVec[blockIdx],
+						inTopFlag && blockIdx == 0,
+						ioBlockToIdxUMap,
+						ioBlockDataVec[firstBlockId + blockIdx]))
+					allOk = false;
+			}
+		} catch(...) {
+			std::lock_guard<std::mutex> lock(errorMutex);
+			if(!errorPtr)
+				errorPtr = std::current_exception();
+			allOk = false;
+		}
+	};
+
+	std::size_t threadsNum = std::min<std::size_t>(
+			mFillThreadsNum, blocksVec.size());
+	std::vector<std::thread> workersVec;
+	for(std::size_t threadIdx = 1; threadIdx < threadsNum; threadIdx++) {
+		//remaining blocks are taken by workers that did start
+		try {
+			workersVec.emplace_back(fillBlocks);
+		} catch(const std::system_error&) {
+			break;
+		}
+	}
+
+	fillBlocks();
+	for(std::thread& worker : workersVec)
+		worker.join();
+
+	if(errorPtr)
+		std::rethrow_exception(errorPtr);
+
+	return allOk;
+}
+
+/**
+ * Registers the block and recursively all unregistered masters of it's instances.
+ * Block IDs go in DFS order starting from the given one.
+ * Returns false if block or master of some instance is null.
+ */
+bool AbsNetlistProcessorBase::collectBlocks(
+						const GenericBlock* inBlockPtr,
+						uint32_t inFirstBlockId,
+						BlockPtrToIdUMap& ioBlockToIdxUMap,
+						std::vector<const GenericBlock*>& ioBlocksVec) {
+	if(!inBlockPtr)
+		return false;
+
+	if(!ioBlockToIdxUMap.emplace(
+			inBlockPtr, inFirstBlockId + ioBlocksVec.size()).second)
+		return true;
+
+	ioBlocksVec.push_back(inBlockPtr);
+	if(isLeafBlock(inBlockPtr))
+		return true;
+
+	std::vector<GenericInst*> instsVec;
+	getBlockInsts(nullptr, inBlockPtr, instsVec);
+	for(GenericInst* instPtr : instsVec) {
+		if(!instPtr)
+			continue;
+
+		if(!collectBlocks(
+				getMasterBlock(instPtr), inFirstBlockId,
+				ioBlockToIdxUMap, ioBlocksVec))
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * Fills content data of single block.
+ * Masters of block's instances must be already registered.
+ * Returns false if fails to fill nets, ports or instances.
+ */
+bool AbsNetlistProcessorBase::fillSingleBlockData(
+						const GenericBlock* inBlockPtr,
+						bool inTopFlag,
+						const BlockPtrToIdUMap& inBlockToIdxUMap,
+						BlockData& outBlockData) {
+	if(!inBlockPtr)
+		return false;
+
+	outBlockData.mName = getName(inBlockPtr);
+	outBlockData.mTopFlag = inTopFlag;
+	outBlockData.mLeafFlag = isLeafBlock(inBlockPtr);
+
+
+	StringToIdMap netNameToIdxMap;
+	//filling the nets, mapping their names to vector indexes
+	if(!fillBlockNets(
+		nullptr, inBlockPtr,
+		outBlockData, netNameToIdxMap))
+	return false;
+
+	//filling the ports (without bits, only single and busses)
+	if(!fillObjectPorts<const GenericBlock, BlockData, GenericPort>(
+			inBlockPtr,
+			outBlockData,
+			netNameToIdxMap,
+			true))
+		return false;
+
+	if(outBlockData.mLeafFlag)
+		return true;
+
+	//filling the instances (without hierarchy, only the children on the block)
+	return fillBlockInsts(
+			nullptr, inBlockPtr,
+			inBlockToIdxUMap,
+			netNameToIdxMap, outBlockData);
+}
+
+/**
+ * Fills net names in block data, maps them to indexes.
+ */
+bool AbsNetlistProcessorBase::fillBlockNets(
+						const GenericInst* inParentInstPtr,
+						const GenericBlock* inBlockPtr,
+						BlockData& ioBlockData,
+						StringToIdMap& outNetNameToIdxMap) {
+	if(!inBlockPtr)
+		return false;
+
+	//getting nets and adding all net indexes
+	std::vector<GenericNet*> netsVec;
+	getBlockNets(inParentInstPtr, inBlockPtr, netsVec);
+	outNetNameToIdxMap.reserve(netsVec.size());
+	ioBlockData.mNetNamesVec.reserve(netsVec.size());
+
+	uint32_t netId = 0;
+	std::string_view netName;
+	auto netIt = outNetNameToIdxMap.begin();
+	for(GenericNet* netPtr : netsVec) {
+		if(!netPtr)
+			continue;
+
+		if(isBus(netPtr))
+			continue;
+
+		netName = getNameView(netPtr);
+		netIt = outNetNameToIdxMap.find(netName);
+		if(netIt != outNetNameToIdxMap.end())
+			continue;
+
+		netId = ioBlockData.mNetNamesVec.size();
+		ioBlockData.mNetNamesVec.emplace_back(netName);
+		outNetNameToIdxMap.emplace(netName, netId);
+
+		if(hasGndSource(netPtr))
+			ioBlockData.mGndNetName = netName;
+		if(hasVddSource(netPtr))
+			ioBlockData.mVddNetName = netName;
+
+	}
+
+	return true;
+}
+
+/**
+ * Adds data for all instance children of the block.
+ * Masters of the instances must be already registered.
+ * Returns false on null object,
+ * unregistered master or failed ports data collection.
+ */
+bool AbsNetlistProcessorBase::fillBlockInsts(
+						const GenericInst* inParentInstPtr,
+						const GenericBlock* inBlockPtr,
+						const BlockPtrToIdUMap& inBlockToIdxUMap,
+						const StringToIdMap& inNetNameToIdxMap,
+						BlockData& ioBlockData) {
+	if(!inBlockPtr)
+		return false;
+
+	//adding info of all ports
+	std::vector<GenericInst*> instsVec;
+	auto masterIdxIt = inBlockToIdxUMap.begin();
+
+	getBlockInsts(inParentInstPtr, inBlockPtr, instsVec);
+	ioBlockData.mInstDataVec.reserve(instsVec.size());
+	for(auto instPtr : instsVec) {
+		if(!instPtr)
+			continue;
+
+		masterIdxIt = inBlockToIdxUMap.find(getMasterBlock(instPtr));
+		//nothing will help if it wasn't registered
+		if(masterIdxIt == inBlockToIdxUMap.end())
+			return false;
+
+		InstanceData data;
+		data.mName = getName(instPtr);
+		data.mMasterBlockIdx = masterIdxIt->second;
+
+		if(!fillObjectPorts<GenericInst, InstanceData, GenericPin>(
+				instPtr, data, inNetNameToIdxMap, true))
+			return false;
+
+		ioBlockData.mInstDataVec.push_back(std::move(data));
+	}
+
+	return true;
+}
+
+
+}
+
+
+
@@ -1,24 +1,24 @@
-#ifndef SRC_NEW_GENERICNETLISTENTITIES_HPP_
-#define SRC_NEW_GENERICNETLISTENTITIES_HPP_
-
-namespace stamask {
-
-/** generic block marker class */
-class GenericBlock {};
-
-/** generic instance marker class */
-class GenericInst {};
-
-/** generic pin marker class */
-class GenericPin {};
-
-/** generic port marker class */
-class GenericPort {};
-
-/** generic net marker class */
-class GenericNet {};
-
-}
-
-
-#endif /* SRC_NEW_GENERICNETLISTENTITIES_HPP_ */
+#ifndef SRC_NEW_GENERICNETLISTENTITIES_HPP_
+#define SRC_NEW_GENERICNETLISTENTITIES_HPP_
+
+namespace stamask {
+
+/** generic block marker class */
+class GenericBlock {};
+
+/** generic instance marker class */
+class GenericInst {};
+
+/** generic pin marker class */
+class GenericPin {};
+
+/** generic port marker class */
+class GenericPort {};
+
+/** generic net marker class */
+class GenericNet {};
+
+}
+
+
+#endif /* SRC_NEW_GENERICNETLISTENTITIES_HPP_ */
@@ -0,0 +1,201 @@
+
+#include "GraphMappingSnapshot.hpp"
+
+#include <boost/interprocess/exceptions.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+
+namespace bi = boost::interprocess;
+
+namespace stamask {
+
+
+constexpr char GraphMappingSnapshot::cMagic[8];
+
+
+/**
+ * Constructor of snapshot without mapped file.
+ */
+GraphMappingSnapshot::GraphMappingSnapshot():
+		mFileMapping(),
+		mRegion(),
+		mHeaderPtr(nullptr),
+		mVerticesPtr(nullptr),
+		mEdgesPtr(nullptr),
+		mPathsPtr(nullptr) {}
+
+/**
+ * Maps snapshot file in memory and checks it's layout.
+ * Checks magic, version and that all sections fit in the file,
+ * paths of vertices must fit in the paths pool.
+ * Returns false and leaves nothing mapped if file can't be mapped or is invalid.
+ * @param inFileName snapshot file name
+ * @return operation success
+ */
+bool GraphMappingSnapshot::open(const std::string& inFileName) {
+	close();
+
+	try {
+		mFileMapping = bi::file_mapping(inFileName.c_str(), bi::read_only);
+		mRegion = bi::mapped_region(mFileMapping, bi::read_only);
+	} catch(const bi::interprocess_exception&) {
+		close();
+		return false;
+	}
+
+	const char* dataPtr = static_cast<const char*>(mRegion.get_address());
+	std::size_t bytesNum = mRegion.get_size();
+	if(!dataPtr || bytesNum < sizeof(GraphSnapshotHeader)) {
+		close();
+		return false;
+	}
+
+	const GraphSnapshotHeader* headerPtr =
+			reinterpret_cast<const GraphSnapshotHeader*>(dataPtr);
+	if(std::memcmp(headerPtr->mMagic, cMagic, sizeof(cMagic)) != 0 ||
+			headerPtr->mVersion != cVersion) {
+		close();
+		return false;
+	}
+
+	uint64_t verticesOffset = sizeof(GraphSnapshotHeader);
+	uint64_t edgesOffset = verticesOffset +
+			uint64_t(headerPtr->mVerticesNum)*sizeof(GraphSnapshotVertex);
+	uint64_t pathsOffset = edgesOffset +
+			uint64_t(headerPtr->mEdgesNum)*sizeof(GraphSnapshotEdge);
+	if(pathsOffset > bytesNum ||
+			headerPtr->mPathsBytes > bytesNum - pathsOffset) {
+		close();
+		return false;
+	}
+
+	const GraphSnapshotVertex* verticesPtr =
+			reinterpret_cast<const GraphSnapshotVertex*>(dataPtr + verticesOffset);
+	for(uint32_t vertexIdx = 0; vertexIdx < headerPtr->mVerticesNum; vertexIdx++) {
+		const GraphSnapshotVertex& vertex = verticesPtr[vertexIdx];
+		if(vertex.mPathOffset > headerPtr->mPathsBytes ||
+				vertex.mPathBytes > headerPtr->mPathsBytes - vertex.mPathOffset) {
+			close();
+			return false;
+		}
+	}
+
+	mHeaderPtr = headerPtr;
+	mVerticesPtr = verticesPtr;
+	mEdgesPtr = reinterpret_cast<const GraphSnapshotEdge*>(dataPtr + edgesOffset);
+	mPathsPtr = dataPtr + pathsOffset;
+	return true;
+}
+
+/**
+ * Unmaps snapshot file.
+ */
+void GraphMappingSnapshot::close() {
+	mRegion = bi::mapped_region();
+	mFileMapping = bi::file_mapping();
+	mHeaderPtr = nullptr;
+	mVerticesPtr = nullptr;
+	mEdgesPtr = nullptr;
+	mPathsPtr = nullptr;
+}
+
+/**
+ * Checks that valid snapshot file is mapped.
+ * @return flag that snapshot is open
+ */
+bool GraphMappingSnapshot::isOpen() const {
+	return mHeaderPtr;
+}
+
+/**
+ * Returns header of mapped snapshot, snapshot must be open.
+ * @return header
+ */
+const GraphSnapshotHeader& GraphMappingSnapshot::getHeader() const {
+	return *mHeaderPtr;
+}
+
+/**
+ * Returns vertex records of mapped snapshot.
+ * @return pointer to the first of header's amount of vertices
+ */
+const GraphSnapshotVertex* GraphMappingSnapshot::getVertices() const {
+	return mVerticesPtr;
+}
+
+/**
+ * Returns edge records of mapped snapshot.
+ * @return pointer to the first of header's amount of edges
+ */
+const GraphSnapshotEdge* GraphMappingSnapshot::getEdges() const {
+	return mEdgesPtr;
+}
+
+/**
+ * Returns pin path of the vertex from paths pool.
+ * Path stays valid while snapshot is open.
+ * @param inVertex vertex record of this snapshot
+ * @return pin path
+ */
+std::string_view GraphMappingSnapshot::getPath(
+		const GraphSnapshotVertex& inVertex) const {
+	return std::string_view(
+			mPathsPtr + inVertex.mPathOffset,
+			inVertex.mPathBytes);
+}
+
+/**
+ * Writes snapshot file, replaces existing one.
+ * Data is written in temporary file that is renamed after,
+ * so existing snapshot stays intact if write fails.
+ * Sets magic and version in written header, sizes must be already set.
+ * Returns false if sizes in header don't match data or fails to write file.
+ * @param inFileName snapshot file name
+ * @param inHeader header data
+ * @param inVerticesVec vertex records
+ * @param inEdgesVec edge records
+ * @param inPathsPool concatenated pin paths
+ * @return operation success
+ */
+bool GraphMappingSnapshot::write(
+		const std::string& inFileName,
+		const GraphSnapshotHeader& inHeader,
+		const std::vector<GraphSnapshotVertex>& inVerticesVec,
+		const std::vector<GraphSnapshotEdge>& inEdgesVec,
+		const std::string& inPathsPool) {
+	if(inHeader.mVerticesNum != inVerticesVec.size() ||
+			inHeader.mEdgesNum != inEdgesVec.size() ||
+			inHeader.mPathsBytes != inPathsPool.size())
+		return false;
+
+	GraphSnapshotHeader header = inHeader;
+	std::memcpy(header.mMagic, cMagic, sizeof(cMagic));
+	header.mVersion = cVersion;
+
+	std::string tmpFileName = inFileName + ".tmp";
+	std::ofstream file(tmpFileName, std::ios::binary | std::ios::trunc);
+	if(!file)
+		return false;
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(inVerticesVec.data()),
+			inVerticesVec.size()*sizeof(GraphSnapshotVertex));
+	file.write(reinterpret_cast<const char*>(inEdgesVec.data()),
+			inEdgesVec.size()*sizeof(GraphSnapshotEdge));
+	file.write(inPathsPool.data(), inPathsPool.size());
+	file.close();
+
+	if(!file ||
+			std::rename(tmpFileName.c_str(), inFileName.c_str()) != 0) {
+		std::remove(tmpFileName.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+
+}
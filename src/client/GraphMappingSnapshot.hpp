@@ -0,0 +1,131 @@
+#ifndef SRC_CLIENT_GRAPHMAPPINGSNAPSHOT_HPP_
+#define SRC_CLIENT_GRAPHMAPPINGSNAPSHOT_HPP_
+
+#include "channel/Messages.hpp"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <type_traits>
+
+
+/*
+ * Snapshot file layout, native byte order.
+ *  - header;
+ *  - vertex records, sorted by vertex ID;
+ *  - edge records, sorted by edge ID;
+ *  - pool of vertex pin paths without terminating zeroes.
+ * Pin paths are built with client's hierarchy divider,
+ * so the file is attached only by the client with the same divider.
+ */
+
+
+namespace stamask {
+
+
+/**
+ * Header of snapshot file.
+ */
+struct GraphSnapshotHeader {
+	char mMagic[8];
+	uint32_t mVersion;
+	uint32_t mDivider;
+	uint64_t mDesignHash;
+	uint64_t mGraphGeneration;
+	uint64_t mGraphHash;
+	uint32_t mVerticesNum;
+	uint32_t mEdgesNum;
+	uint64_t mPathsBytes;
+};
+
+/**
+ * Vertex of timing graph with location of it's pin path in paths pool.
+ */
+struct GraphSnapshotVertex {
+	uint32_t mVertexId;
+	uint32_t mIsDriver;
+	uint64_t mPathOffset;
+	uint32_t mPathBytes;
+	uint32_t mReserved;
+};
+
+/**
+ * Edge of timing graph.
+ */
+struct GraphSnapshotEdge {
+	uint32_t mEdgeId;
+	uint32_t mFromVertexId;
+	uint32_t mToVertexId;
+};
+
+static_assert(std::is_trivially_copyable<GraphSnapshotHeader>::value &&
+		std::is_trivially_copyable<GraphSnapshotVertex>::value &&
+		std::is_trivially_copyable<GraphSnapshotEdge>::value,
+		"snapshot records are copied as is");
+static_assert(sizeof(GraphSnapshotHeader) % 8 == 0 &&
+		sizeof(GraphSnapshotVertex) % 8 == 0,
+		"edge records must stay 4-byte aligned after vertex records");
+
+
+/**
+ * Read-only memory-mapped snapshot of client's graph mapping.
+ * Records and paths are read in place without parsing,
+ * attach copies them in client's mapping and then the file is unmapped.
+ */
+class GraphMappingSnapshot {
+
+	/** mapping of the whole file */
+	boost::interprocess::file_mapping mFileMapping;
+
+	/** mapped memory of the file */
+	boost::interprocess::mapped_region mRegion;
+
+	/** header in mapped memory, nullptr if nothing is mapped */
+	const GraphSnapshotHeader* mHeaderPtr;
+	const GraphSnapshotVertex* mVerticesPtr;
+	const GraphSnapshotEdge* mEdgesPtr;
+	const char* mPathsPtr;
+
+public:
+
+	/** magic bytes of snapshot file */
+	static constexpr char cMagic[8] = {'S','T','L','K','G','M','A','P'};
+
+	/** version of file layout */
+	static constexpr uint32_t cVersion = 1;
+
+	GraphMappingSnapshot();
+
+	bool open(const std::string& inFileName);
+
+	void close();
+
+	bool isOpen() const;
+
+	const GraphSnapshotHeader& getHeader() const;
+
+	const GraphSnapshotVertex* getVertices() const;
+
+	const GraphSnapshotEdge* getEdges() const;
+
+	std::string_view getPath(const GraphSnapshotVertex& inVertex) const;
+
+	static bool write(
+			const std::string& inFileName,
+			const GraphSnapshotHeader& inHeader,
+			const std::vector<GraphSnapshotVertex>& inVerticesVec,
+			const std::vector<GraphSnapshotEdge>& inEdgesVec,
+			const std::string& inPathsPool);
+
+};
+
+
+}
+
+
+#endif /* SRC_CLIENT_GRAPHMAPPINGSNAPSHOT_HPP_ */
@@ -1,2090 +1,3926 @@
-#include "StaClientBase.hpp"
-
-#include <iostream>
-#include <iterator>
-
-namespace stamask {
-
-
-/**
- * The constructor, makes protocol without any channel.
- */
-StaClientBase::StaClientBase():
-			IStaClient(),
-			mProtocol(),
-			mDivider('/'),
-			mPathToPinUMap(),
-			mSourcePinToVertexIdUMap(),
-			mSinkPinToVertexIdUMap(),
-			mPinPairToEdgeIdUMap(),
-			mHasGraph(false),
-			mNodeTimingDataVec(),
-			mNodeMinCritFactorsVec(),
-			mNodeMaxCritFactorsVec(),
-			mHasGraphTiming(false) {
-	mProtocol.setCallback(this);
-}
-
-
-/**
- * A destructor.
- */
-StaClientBase::~StaClientBase() {}
-
-/**
- * Sets channel inside the protocol.
- * Accepts even the nullptr.
- * Protocol deletes previously set channel.
- */
-void StaClientBase::setChannel(
-		IpcChannel* inChannelPtr) {
-	mProtocol.setChannel(inChannelPtr);
-}
-
-/**
- * Returns channel that is preset in the protocol.
- * @return channel pointer
- */
-IpcChannel* StaClientBase::getChannel() {
-	return mProtocol.getChannel();
-}
-
-/**
- * Returns internal flag that graph data was set up.
- * @return flag that graph data was set up
- */
-bool StaClientBase::hasGraph() const {
-	return mHasGraph;
-}
-
-
-/**
- * Returns flag that graph&timing data were set up.
- * @return flag that graph&timing data were set up
- */
-bool StaClientBase::hasTimings() const {
-	return mHasGraph && mHasGraphTiming;
-}
-
-/**
- * Writes out calculated criticality of timing pin's node.
- * First tries locate node idx in one mapping, then another.
- * If edge sources has priority, then searches nodes in sources map.
- * Need this flag in case of bidirectional pins.
- * Writes out 0 and returns false if no graph or timing were loaded,
- * no timing node was found for pin or node idx is out of bounds.
- * Also returns false and outs 0 if pin pointer is null.
- * Writes out max-condition criticality if inMin flag is false.
- * @param inPinPtr target pin
- * @param outValue output criticalicty value
- * @param inMin flag to get min-condition criticality.
- * @param inEdgeSourcePriority flag to first search edge sources
- * @return success flag
- */
-bool StaClientBase::getPinCriticality(
-						const GenericPin* inPinPtr,
-						float& outValue,
-						bool inMin,
-						bool inEdgeSourcePriority) const {
-	if(!mHasGraph || !mHasGraphTiming) {
-		//std::cout << "no graph and timing for criticality" << std::endl;
-		outValue = 0;
-		return false;
-	}
-
-	auto nodeIt = mSinkPinToVertexIdUMap.begin();
-	bool hasData = false;
-
-	//don't want to juggle pointers here
-	if(inEdgeSourcePriority) {
-		nodeIt = mSourcePinToVertexIdUMap.find(inPinPtr);
-		hasData = nodeIt != mSourcePinToVertexIdUMap.end();
-	} else {
-		nodeIt = mSinkPinToVertexIdUMap.find(inPinPtr);
-		hasData = nodeIt != mSinkPinToVertexIdUMap.end();
-	}
-
-	if(!hasData) {
-		if(inEdgeSourcePriority) {
-			nodeIt = mSinkPinToVertexIdUMap.find(inPinPtr);
-			hasData = nodeIt != mSinkPinToVertexIdUMap.end();
-		} else {
-			nodeIt = mSourcePinToVertexIdUMap.find(inPinPtr);
-			hasData = nodeIt != mSourcePinToVertexIdUMap.end();
-		}
-	}
-
-	//out 0, return false if pin wasn't registered
-	if(!hasData) {
-		//std::cout << "pin wasn't registered" << std::endl;
-		outValue = 0;
-		return false;
-	}
-
-	//node index must be within bounds
-	if((inMin && nodeIt->second >= mNodeMinCritFactorsVec.size()) ||
-			(!inMin && nodeIt->second >= mNodeMaxCritFactorsVec.size())) {
-		//std::cout << "node index must be within bounds" << std::endl;
-		outValue = 0;
-		return false;
-	}
-
-	if(inMin)
-		outValue = mNodeMinCritFactorsVec[nodeIt->second];
-	else
-		outValue = mNodeMaxCritFactorsVec[nodeIt->second];
-
-	return true;
-}
-
-bool StaClientBase::getPinTimingData(
-		const GenericPin* inPinPtr,
-		NodeTimingData& outValue) const {
-	if(!mHasGraph || !mHasGraphTiming) {
-		//std::cout << "no graph and timing for criticality" << std::endl;
-		return false;
-	}
-
-	auto nodeIt = mSinkPinToVertexIdUMap.begin();
-	bool hasData = false;
-
-	//don't want to juggle pointers here
-	nodeIt = mSourcePinToVertexIdUMap.find(inPinPtr);
-	hasData = nodeIt != mSourcePinToVertexIdUMap.end();
-
-	if(!hasData) {
-		nodeIt = mSinkPinToVertexIdUMap.find(inPinPtr);
-		hasData = nodeIt != mSinkPinToVertexIdUMap.end();
-	}
-
-	//out 0, return false if pin wasn't registered
-	if(!hasData) {
-		//std::cout << "pin wasn't registered" << std::endl;
-		return false;
-	}
-
-	//node index must be within bounds
-	if(nodeIt->second >= mNodeTimingDataVec.size()) {
-		//std::cout << "node index must be within bounds" << std::endl;
-		return false;
-	}
-
-	outValue = mNodeTimingDataVec[nodeIt->second];
-
-	return true;
-}
-
-
-
-
-/**
- * Returns beginning iterator of name-pin map.
- * @return beginning name-pin iterator
- */
-StaClientBase::StrToPinMap::const_iterator
-StaClientBase::beginPathPins() const {
-	//std::cout << "Path->pin mapping has " << mPathToPinUMap.size() << "entries" << std::endl;
-
-	return mPathToPinUMap.begin();
-}
-
-/**
- * Returns ending iterator of name-pin map.
- * @return ending name-pin iterator
- */
-StaClientBase::StrToPinMap::const_iterator
-StaClientBase::endPathPins() const {
-	return mPathToPinUMap.end();
-}
-
-
-
-/**
- * Sends command to set hierarchy separator in STA.
- * @param inSeparator separator
- */
-void StaClientBase::setHierarchySeparator(
-		char inSeparator) {
-	CommandSetHierarhySeparator command;
-	command.mStr = inSeparator;
-	mDivider = inSeparator;
-
-	mProtocol.execute(command);
-}
-
-/**
- * Sends command to exit STA.
- * Deletes the channel if command was successful.
- */
-bool StaClientBase::exit() {
-	CommandExit command;
-
-	if(mProtocol.execute(command)) {
-		//closing the connection channel
-		//no need to delete channel, protocol does it on nullification
-		mProtocol.setChannel(nullptr);
-
-
-		return true;
-	}
-
-	return false;
-}
-
-/**
- * Sends command to check that STA server is alive.
- * Returns false if server returns fail status or timeout is reached.
- * @param inMsTimeout ms to wait
- */
-bool StaClientBase::ping(unsigned long inMsTimeout) {
-	CommandPing command;
-	command.mMsTimeout = inMsTimeout;
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Sends command to read liberty file.
- * @param inFileName file name
- * @return success status
- */
-bool StaClientBase::readLibertyFile(
-						const std::string& inFileName) {
-	CommandReadLibertyFile command;
-	command.mStr = inFileName;
-
-	return mProtocol.execute(command);
-}
-/**
- * Sends command to read liberty from stream.
- * @param inDataStream stream to read
- * @return success status
- */
-bool StaClientBase::readLibertyStream(
-		std::istream& inDataStream) {
-	CommandReadLibertyStream command;
-	command.mStr = std::string(
-			std::istreambuf_iterator<char>(inDataStream), {});
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sends command to clear out all stored liberty libraries from STA.
- * @return success status
- */
-bool StaClientBase::clearLibraries()  {
-	CommandClearLibs command;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sends command to read Verilog file.
- * @param inFileName file name
- * @return success status
- */
-bool StaClientBase::readVerilogFile(
-		const std::string& inFileName) {
-	CommandReadVerilogFile command;
-	command.mStr = inFileName;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sends command to read Verilog from stream.
- * @param inDataStream stream to read
- * @return success status
- */
-bool StaClientBase::readVerilogStream(
-		std::istream& inDataStream) {
-	CommandReadVerilogStream command;
-	command.mStr = std::string(
-			std::istreambuf_iterator<char>(inDataStream), {});
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Method to build netlist structures from verilog data with given top-block.
- * All modules must be pre-read from Verilog files.
- * @param inTopBlockName top block name
- * @return success status
- */
-bool StaClientBase::linkVerilogTopBlockNetlist(
-						const std::string& inTopBlockName) {
-	CommandLinkTop command;
-	command.mStr = inTopBlockName;
-
-	//have to reset status of graph and timing data
-	clearGraphMapping();
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Method to build anew netlist structures with given top-block in STA.
- * Fills all data in a top-down manner and sends it to STA to create netlist.
- * Must do so because STA may have parent-tracking to handle instance contexts.
- * @param inBlockPtr top block
- * @return success status
- */
-bool StaClientBase::linkCreateTopBlockNetlist(
-						const GenericBlock* inBlockPtr) {
-	if(!inBlockPtr)
-		return false;
-
-	//have to reset status of graph and timing data
-	//because previous top-level was destroyed either way
-	clearGraphMapping();
-
-	CommandCreateNetlist command;
-	BlockPtrToIdUMap blockToIdxUMap;
-	if(!fillBlockData(inBlockPtr, command.mBlockDataVec, blockToIdxUMap, true))
-		return false;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Method to connect pin and net from top-block in STA.
- * @param inPinPtr pin pointer
- * @param inNetPtr net pointer
- * @return success status
- */
-bool StaClientBase::connectTopContextPinNet(
-						const GenericPin* inPinPtr,
-						const GenericNet* inNetPtr) {
-	if(!inPinPtr || !inNetPtr)
-		return false;
-
-	CommandConnectContextPinNet command;
-	if(!fillPinNetCommand(command, {}, inPinPtr, inNetPtr))
-		return false;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Method to disconnect pin and net from top-block in STA.
- * @param inPinPtr pin pointer
- * @param inNetPtr net pointer
- * @return success status
- */
-bool StaClientBase::disconnectTopContextPinNet(
-						const GenericPin* inPinPtr,
-						const GenericNet* inNetPtr) {
-	if(!inPinPtr || !inNetPtr)
-		return false;
-
-	CommandDisconnectContextPinNet command;
-	if(!fillPinNetCommand(command, {}, inPinPtr, inNetPtr))
-		return false;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Method to connect pin and net from inst-context in STA.
- * @param inInstContextVec top-bottom sequence of instances
- * @param inPinPtr pin pointer
- * @param inNetPtr net pointer
- * @return success status
- */
-bool StaClientBase::connectContextPinNet(
-						const std::vector<GenericInst*>& inInstContextVec,
-						const GenericPin* inPinPtr,
-						const GenericNet* inNetPtr) {
-	if(!inPinPtr || !inNetPtr)
-		return false;
-
-	//graph data becomes invalid when netlist changes
-	clearGraphMapping();
-
-	CommandConnectContextPinNet command;
-	if(!fillPinNetCommand(command, inInstContextVec, inPinPtr, inNetPtr))
-		return false;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Method to disconnect pin and net from inst-context in STA.
- * @param inInstContextVec top-bottom sequence of instances
- * @param inPinPtr pin pointer
- * @param inNetPtr net pointer
- * @return success status
- */
-bool StaClientBase::disconnectContextPinNet(
-						const std::vector<GenericInst*>& inInstContextVec,
-						const GenericPin* inPinPtr,
-						const GenericNet* inNetPtr)  {
-	if(!inPinPtr || !inNetPtr)
-		return false;
-
-	//graph data becomes invalid when netlist changes
-	clearGraphMapping();
-
-	CommandDisconnectContextPinNet command;
-	if(!fillPinNetCommand(command, inInstContextVec, inPinPtr, inNetPtr))
-		return false;
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Sends command to clear current netlist from STA.
- * @return success status
- */
-bool StaClientBase::clearNetlistBlocks() {
-	CommandClearNetlistBlocks command;
-
-	clearGraphMapping();
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Adds clock creation constraint.
- * Returns false if one of source has null pin pointer or creation failed.
- * @param inName clock name
- * @param inDescription clock comment
- * @param inPinPathsVec source pin paths
- * @param inAddFlag add flag
- * @param inPeriod clock period
- * @param inWaveformVec clock waveform
- * @return operation success
- */
-bool StaClientBase::createClock(
-		const std::string& inName,
-		const std::string& inDescription,
-		const std::vector<PinContextPath>& inPinPathsVec,
-		bool inAddFlag,
-		float inPeriod,
-		const std::vector<float>& inWaveformVec) {
-	CommandCreateClock command;
-	command.mName = inName;
-	command.mDescription = inDescription;
-	command.mAddFlag = inAddFlag;
-	command.mPeriod = inPeriod;
-	command.mWaveformVec = inWaveformVec;
-
-	if(!convertContextNameDataVec(
-			inPinPathsVec, command.mPinPathsVec))
-		return false;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Adds generate clock creation constraint.
- * Allows null pin for master clock.
- * Returns false if one of source has null pin pointer or creation failed.
- * @param inName clock name
- * @param inDescription clock comment
- * @param inMasterClockPinPath path to master clock pin
- * @param inMasterClockName master clock name
- * @param inPinPathsVec source pin paths
- * @param inAddFlag add flag
- * @param inDivideFactor divide_by factor
- * @param inMultiplyFactor multiply_by factor
- * @param inDutyCycle duty cycle
- * @param inInvert inversion flag
- * @param inEdgesVec vector with edge timings
- * @param inEdgeShiftsVec vector with shifts in edge timings
- * @return operations success
- */
-bool StaClientBase::createGeneratedClock(
-		const std::string& inName,
-		const std::string& inDescription,
-		const PinContextPath& inMasterClockPinPath,
-		const std::string& inMasterClockName,
-		const std::vector<PinContextPath>& inPinPathsVec,
-		bool inAddFlag,
-	    int inDivideFactor,
-		int inMultiplyFactor,
-	    float inDutyCycle,
-	    bool inInvert,
-	    const std::vector<int>& inEdgesVec,
-		const std::vector<float>& inEdgeShiftsVec) {
-	CommandCreateGenClock command;
-	command.mName = inName;
-	command.mDescription = inDescription;
-	command.mMasterClockName = inMasterClockName;
-	command.mAddFlag = inAddFlag;
-	command.mDivideFactor = inDivideFactor;
-	command.mMultiplyFactor = inMultiplyFactor;
-	command.mDutyCycle = inDutyCycle;
-	command.mInvert = inInvert;
-	command.mEdgesVec = inEdgesVec;
-	command.mEdgeShiftsVec = inEdgeShiftsVec;
-
-	if(inMasterClockPinPath.mObjectPtr)
-		convertContextObjPath(
-				inMasterClockPinPath, command.mMasterClockPinPath);
-	if(!convertContextNameDataVec(
-			inPinPathsVec, command.mPinPathsVec))
-		return false;
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Creates constraint with clock groups.
- * @param inName name of groups constraint
- * @param inDescription constraint description
- * @param inLogicalExclusive flag of logic exclusivity
- * @param inPhysicalExclusive flag of physical exclusivity
- * @param inAsynchronous asynchronous groups flag
- * @param inAllowPaths allow paths flag
- * @param inClockGroupsVec vector of clock name groups
- * @return operations success
- */
-bool StaClientBase::setClockGroups(
-		const std::string& inName,
-		const std::string& inDescription,
-		bool inLogicalExclusive,
-		bool inPhysicalExclusive,
-		bool inAsynchronous,
-		bool inAllowPaths,
-		const std::vector<std::vector<std::string>>& inClockGroupsVec) {
-	CommandSetClockGroups command;
-	command.mName = inName;
-	command.mDescription = inDescription;
-	command.mLogicalExclusive = inLogicalExclusive;
-	command.mPhysicalExclusive = inPhysicalExclusive;
-	command.mAsynchronous = inAsynchronous;
-	command.mAllowPaths = inAllowPaths;
-	command.mClockGroupsVec = inClockGroupsVec;
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Adds constraint with clock source/network latency.
- * Allows null pin for clock.
- * @param inSource source latency flag
- * @param inMin min flag
- * @param inMax max flag
- * @param inEarly early (hold) timing flag
- * @param inLate late (setup) timing flag
- * @param inRise rise flag
- * @param inFall fall flag
- * @param inDelay latency value
- * @param inClockName target clock name
- * @param inPinPath target pin path
- * @return operation success
- */
-bool StaClientBase::setClockLatency(
-						bool inSource,
-						bool inMin,
-						bool inMax,
-						bool inEarly,
-						bool inLate,
-						bool inRise,
-						bool inFall,
-						float inValue,
-						const std::string& inClockName,
-						const PinContextPath& inPinPath) {
-	CommandSetClockLatency command;
-	command.mSource = inSource;
-	command.mMin = inMin;
-	command.mMax = inMax;
-	command.mEarly = inEarly;
-	command.mLate = inLate;
-	command.mRise = inRise;
-	command.mFall = inFall;
-	command.mValue = inValue;
-	command.mClockName = inClockName;
-
-	if(inPinPath.mObjectPtr)
-		convertContextObjPath(
-				inPinPath, command.mPinPath);
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Adds uncertainty constraint between two clocks.
- * @param inFromClockName name of from-clock
- * @param inFromRise rise of from-clock
- * @param inFromRise fall of from-clock
- * @param inToClockName name of to-clock
- * @param inToRise rise of to-clock
- * @param inToFall fall of to-clock
- * @param inSetup setup time flag
- * @param inHold hold time flag
- * @param inValue value to set
- * @return operations success
- */
-bool StaClientBase::setClockToClockUncertainty(
-						const std::string& inFromClockName,
-						bool inFromRise,
-						bool inFromFall,
-						const std::string& inToClockName,
-						bool inToRise,
-						bool inToFall,
-						bool inSetup,
-						bool inHold,
-						float inValue) {
-	CommandSetInterClockUncertainty command;
-	command.mFromClockName = inFromClockName;
-	command.mFromRise = inFromRise;
-	command.mFromFall = inFromFall;
-	command.mToClockName = inToClockName;
-	command.mToRise = inToRise;
-	command.mToFall = inToFall;
-	command.mSetup = inSetup;
-	command.mHold = inHold;
-	command.mValue = inValue;
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Adds uncertainty constraint of single clock.
- * @param inClockName clock name
- * @param inSetup setup time flag
- * @param inHold hold time flag
- * @param inValue value to set
- * @return operations success
- */
-bool StaClientBase::setClockUncertainty(
-						const std::string& inClockName,
-						bool inSetup,
-						bool inHold,
-						float inValue) {
-	CommandSetSingleClockUncertainty command;
-	command.mClockName = inClockName;
-	command.mSetup = inSetup;
-	command.mHold = inHold;
-	command.mValue = inValue;
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Adds clock uncertainty constraint of single pin.
- * Returns false if pin pointer is null.
- * @param inPinPath pin path
- * @param inSetup setup time flag
- * @param inHold hold time flag
- * @param inValue value to set
- * @return operations success
- */
-bool StaClientBase::setPinUncertainty(
-						const PinContextPath& inPinPath,
-						bool inSetup,
-						bool inHold,
-						float inValue) {
-	if(!inPinPath.mObjectPtr)
-		return false;
-
-	CommandSetSinglePinUncertainty command;
-	command.mSetup = inSetup;
-	command.mHold = inHold;
-	command.mValue = inValue;
-
-	convertContextObjPath(inPinPath, command.mPinPath);
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Adds delay of input/output port respective to clock.
- * Returns false if target pin pointer is null.
- * Ignores null pin pointer of the clock.
- * @param inIsInput input direction flag
- * @param inClockName name of reference clock
- * @param inClockPinPath name of source pin of ref clock (may be empty)
- * @param inClockFall flag of falling edge of clock
- * @param inLevelSensitive level sensivity
- * @param inDelayRise apply delay for rising edges
- * @param inDelayFall apply delay for falling edges
- * @param inDelayMax delay is max delay
- * @param inDelayMin delay is max delay
- * @param inAdd add to previous delays
- * @param inNetworkLatencyInc network delay is included in delay
- * @param inSourceLatencyInc source delay is included in delay
- * @param inDelay delay value
- * @param inTargetPortPin target port
- * @return operations success
- */
-bool StaClientBase::setPortDelay(
-						bool inIsInput,
-						const std::string& inClockName,
-						const PinContextPath& inClockPinPath,
-						bool inClockFall,
-						bool inLevelSensitive,
-						bool inDelayRise,
-						bool inDelayFall,
-						bool inDelayMax,
-						bool inDelayMin,
-						bool inAdd,
-						bool inNetworkLatencyInc,
-						bool inSourceLatencyInc,
-						float inDelay,
-						const PinContextPath& inTargetPortPin) {
-	if(!inTargetPortPin.mObjectPtr)
-		return false;
-
-	CommandSetPortDelay command;
-	command.mIsInput = inIsInput;
-	command.mClockName = inClockName;
-	command.mClockFall = inClockFall;
-	command.mLevelSensitive = inLevelSensitive;
-	command.mDelayRise = inDelayRise;
-	command.mDelayFall = inDelayFall;
-	command.mDelayMax = inDelayMax;
-	command.mDelayMin = inDelayMin;
-	command.mAdd = inAdd;
-	command.mNetworkLatencyInc = inNetworkLatencyInc;
-	command.mSourceLatencyInc = inSourceLatencyInc;
-	command.mDelay = inDelay;
-
-	convertContextObjPath(
-			inTargetPortPin, command.mTargetPortPin);
-	convertContextObjPath(
-			inClockPinPath, command.mClockPinPath);
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Adds edge transition time of input port's signal.
- * Returns false if target pin pointer is null.
- * Transition time is in seconds.
- * @param inDelayRise apply transition for rising edges
- * @param inDelayFall apply transition for falling edges
- * @param inDelayMax delay is max delay
- * @param inDelayMin delay is max delay
- * @param inValue transition time value
- * @param inTargetPortPin target port
- * @return operations success
- */
-bool StaClientBase::setInputTransition(
-						bool inDelayRise,
-						bool inDelayFall,
-						bool inDelayMax,
-						bool inDelayMin,
-						float inValue,
-						const PinContextPath& inTargetPortPin) {
-	if(!inTargetPortPin.mObjectPtr)
-		return false;
-
-	CommandSetInPortTransition command;
-	command.mDelayRise = inDelayRise;
-	command.mDelayFall = inDelayFall;
-	command.mDelayMax = inDelayMax;
-	command.mDelayMin = inDelayMin;
-	command.mValue = inValue;
-
-	convertContextObjPath(
-			inTargetPortPin, command.mTargetPortPin);
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sets pin load capacitance for port.
- * Returns false if target pin pointer is null.
- * Transition time is in seconds.
- * @param inRise apply load for rising edges
- * @param inFall apply load  for falling edges
- * @param inMax load for max delay
- * @param inMin load for max delay
- * @param inCap capacitance value
- * @param inTargetPortPin target port
- * @return operations success
- */
-bool StaClientBase::setPortPinLoad(
-						bool inRise,
-						bool inFall,
-						bool inMax,
-						bool inMin,
-						float inCap,
-						const PinContextPath& inTargetPortPin) {
-	if(!inTargetPortPin.mObjectPtr)
-		return false;
-
-	CommandSetPortPinLoad command;
-	command.mRise = inRise;
-	command.mFall = inFall;
-	command.mMax = inMax;
-	command.mMin = inMin;
-	command.mCap = inCap;
-
-	convertContextObjPath(
-			inTargetPortPin, command.mTargetPortPin);
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Adds paths to exclude from timing analysis.
- * @param inSetup apply for setup constraints
- * @param inHold apply for hold constraints
- * @param inComment constraint description
- * @param inFromRise rising edge flag of start points
- * @param inFromFall falling edge flag of start points
- * @param inFromPinPathsVec start point pin paths
- * @param inFromClocksVec start point clock names
- * @param inFromInstPathsVec start point inst paths
- * @param inThroughRise rising edge flag of middle points
- * @param inThroughFall falling edge flag of middle points
- * @param inThroughPinPathsVec middle point pin paths
- * @param inThroughInstPathsVec middle point inst paths
- * @param inThroughNetPathsVec start point net paths
- * @param inToRise rising edge flag of end points
- * @param inToFall falling edge flag of end points
- * @param inToPinPathsVec end point pin paths
- * @param inToClocksVec  end point clock names
- * @param inToInstPathsVec middle point inst paths
- * @param inRise end point rise transition
- * @param inFall end point fall transition
- * @return operation success
- */
-bool StaClientBase::setFalsePath(
-						bool inSetup,
-						bool inHold,
-						const std::string& inComment,
-						bool inFromRise,
-						bool inFromFall,
-						const std::vector<PinContextPath>& inFromPinPathsVec,
-						const std::vector<std::string>& inFromClocksVec,
-						const std::vector<InstContextPath>& inFromInstPathsVec,
-						bool inThroughRise,
-						bool inThroughFall,
-						const std::vector<PinContextPath>& inThroughPinPathsVec,
-						const std::vector<InstContextPath>& inThroughInstPathsVec,
-						const std::vector<NetContextPath>& inThroughNetPathsVec,
-						bool inToRise,
-						bool inToFall,
-						const std::vector<PinContextPath>& inToPinPathsVec,
-						const std::vector<std::string>& inToClocksVec,
-						const std::vector<InstContextPath>& inToInstPathsVec,
-						bool inRise,
-						bool inFall) {
-	CommandSetFalsePath command;
-	command.mSetup = inSetup;
-	command.mHold = inHold;
-	command.mComment = inComment;
-
-	fillPathMesgData(
-			inFromRise, inFromFall, inFromPinPathsVec, inFromClocksVec, inFromInstPathsVec,
-			inThroughRise, inThroughFall, inThroughPinPathsVec, inThroughInstPathsVec, inThroughNetPathsVec,
-			inToRise, inToFall, inToPinPathsVec, inToClocksVec, inToInstPathsVec, inRise, inFall,
-			command);
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sets min/max delay constraint for specified paths.
- * @param inMinDelayFlag flag to add min_delay constraint
- * @param inValue delay value
- * @param inComment constraint description
- * @param inFromRise rising edge flag of start points
- * @param inFromFall falling edge flag of start points
- * @param inFromPinPathsVec start point pin paths
- * @param inFromClocksVec start point clock names
- * @param inFromInstPathsVec start point inst paths
- * @param inThroughRise rising edge flag of middle points
- * @param inThroughFall falling edge flag of middle points
- * @param inThroughPinPathsVec middle point pin paths
- * @param inThroughInstPathsVec middle point inst paths
- * @param inThroughNetPathsVec start point net paths
- * @param inToRise rising edge flag of end points
- * @param inToFall falling edge flag of end points
- * @param inToPinPathsVec end point pin paths
- * @param inToClocksVec  end point clock names
- * @param inToInstPathsVec middle point inst paths
- * @param inRise end point rise transition
- * @param inFall end point fall transition
- * @return operation success
- */
-bool StaClientBase::setMinMaxDelay(
-							bool inMinDelayFlag,
-							float inValue,
-							const std::string& inComment,
-							bool inFromRise,
-							bool inFromFall,
-							const std::vector<PinContextPath>& inFromPinPathsVec,
-							const std::vector<std::string>& inFromClocksVec,
-							const std::vector<InstContextPath>& inFromInstPathsVec,
-							bool inThroughRise,
-							bool inThroughFall,
-							const std::vector<PinContextPath>& inThroughPinPathsVec,
-							const std::vector<InstContextPath>& inThroughInstPathsVec,
-							const std::vector<NetContextPath>& inThroughNetPathsVec,
-							bool inToRise,
-							bool inToFall,
-							const std::vector<PinContextPath>& inToPinPathsVec,
-							const std::vector<std::string>& inToClocksVec,
-							const std::vector<InstContextPath>& inToInstPathsVec,
-							bool inRise,
-							bool inFall) {
-	CommandSetMinMaxDelay command;
-	command.mMinDelayFlag = inMinDelayFlag;
-	command.mValue = inValue;
-	command.mComment = inComment;
-
-	fillPathMesgData(
-			inFromRise, inFromFall, inFromPinPathsVec, inFromClocksVec, inFromInstPathsVec,
-			inThroughRise, inThroughFall, inThroughPinPathsVec, inThroughInstPathsVec, inThroughNetPathsVec,
-			inToRise, inToFall, inToPinPathsVec, inToClocksVec, inToInstPathsVec, inRise, inFall,
-			command);
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sets multicycle clock constraint for specified paths.
- * @param inSetup apply for setup constraints
- * @param inHold apply for hold constraints
- * @param inStart apply multiplier to start clock
- * @param inEnd apply multiplier to end clock
- * @param inValue multiplier
- * @param inComment constraint description
- * @param inFromRise rising edge flag of start points
- * @param inFromFall falling edge flag of start points
- * @param inFromPinPathsVec start point pin paths
- * @param inFromClocksVec start point clock names
- * @param inFromInstPathsVec start point inst paths
- * @param inThroughRise rising edge flag of middle points
- * @param inThroughFall falling edge flag of middle points
- * @param inThroughPinPathsVec middle point pin paths
- * @param inThroughInstPathsVec middle point inst paths
- * @param inThroughNetPathsVec start point net paths
- * @param inToRise rising edge flag of end points
- * @param inToFall falling edge flag of end points
- * @param inToPinPathsVec end point pin paths
- * @param inToClocksVec  end point clock names
- * @param inToInstPathsVec middle point inst paths
- * @param inRise end point rise transition
- * @param inFall end point fall transition
- * @return operation success
- */
-bool StaClientBase::setMulticyclePath(
-						bool inSetup,
-						bool inHold,
-						bool inStart,
-						bool inEnd,
-						int inValue,
-						const std::string& inComment,
-						bool inFromRise,
-						bool inFromFall,
-						const std::vector<PinContextPath>& inFromPinPathsVec,
-						const std::vector<std::string>& inFromClocksVec,
-						const std::vector<InstContextPath>& inFromInstPathsVec,
-						bool inThroughRise,
-						bool inThroughFall,
-						const std::vector<PinContextPath>& inThroughPinPathsVec,
-						const std::vector<InstContextPath>& inThroughInstPathsVec,
-						const std::vector<NetContextPath>& inThroughNetPathsVec,
-						bool inToRise,
-						bool inToFall,
-						const std::vector<PinContextPath>& inToPinPathsVec,
-						const std::vector<std::string>& inToClocksVec,
-						const std::vector<InstContextPath>& inToInstPathsVec,
-						bool inRise,
-						bool inFall) {
-	CommandSetMulticyclePath command;
-	command.mSetup = inSetup;
-	command.mHold = inHold;
-	command.mStart = inStart;
-	command.mEnd = inEnd;
-	command.mValue = inValue;
-	command.mComment = inComment;
-
-	fillPathMesgData(
-			inFromRise, inFromFall, inFromPinPathsVec, inFromClocksVec, inFromInstPathsVec,
-			inThroughRise, inThroughFall, inThroughPinPathsVec, inThroughInstPathsVec, inThroughNetPathsVec,
-			inToRise, inToFall, inToPinPathsVec, inToClocksVec, inToInstPathsVec, inRise, inFall,
-			command);
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Adds constraint to disable timing arcs of portref.
- * Returns false if pin pointer is null.
- * @param inPinPath target pin path
- * @return operation success
- */
-bool StaClientBase::setDisablePinTiming(
-						const PinContextPath& inPinPath) {
-	if(!inPinPath.mObjectPtr)
-		return false;
-
-	CommandDisableSinglePinTiming command;
-	convertContextObjPath(inPinPath, command.mPinPath);
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Adds constraint to disable timing arcs of instance.
- * Returns false if one of pins is null.
- * @param inFromPinName path of from-pin
- * @param inToPinName path of to-pin
- * @return operation success
- */
-bool StaClientBase::setDisableInstTiming(
-						const std::vector<const GenericInst*>& mInstContextVec,
-						const GenericPin* inFromPinPtr,
-						const GenericPin* inToPinPtr) {
-	CommandDisableInstTiming command;
-	for(const GenericInst* instPtr : mInstContextVec)
-		command.mInstContextVec.push_back(getName(instPtr));
-
-	command.mFromPinName = getName(inFromPinPtr);
-	command.mToPinName = getName(inToPinPtr);
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Adds global derate factor.
- * @param inCellDelay derate cell delays
- * @param inCellCheck derate cell check margins
- * @param inNetDelay derate interconnets
- * @param inData derate data paths
- * @param inClock derate clock paths
- * @param inEarly derate min delays
- * @param inLate derate max delays
- * @param inRise derate max transitions
- * @param inFall derate fall transitions
- * @param inValue derate factor
- * @return operations success
- */
-bool StaClientBase::setGlobalTimingDerate(
-						bool inCellDelay,
-						bool inCellCheck,
-						bool inNetDelay,
-						bool inData,
-						bool inClock,
-						bool inEarly,
-						bool inLate,
-						bool inRise,
-						bool inFall,
-						float inValue) {
-	CommandSetGlobalTimingDerate command;
-	command.mCellDelay = inCellDelay;
-	command.mCellCheck = inCellCheck;
-	command.mNetDelay = inNetDelay;
-	command.mData = inData;
-	command.mClock = inClock;
-	command.mEarly = inEarly;
-	command.mLate = inLate;
-	command.mRise = inRise;
-	command.mFall = inFall;
-	command.mValue = inValue;
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Sends command to read SPEF file.
- * @param inFileName file name
- * @return success status
- */
-bool StaClientBase::readSPEFFile(
-		const std::string& inFileName) {
-	CommandReadSpefFile command;
-	command.mStr = inFileName;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sends command to read SPEF stream.
- * @param inDataStream data stream
- * @return success status
- */
-bool StaClientBase::readSPEFStream(
-		std::istream& inDataStream) {
-	CommandReadSpefStream command;
-	command.mStr = std::string(
-			std::istreambuf_iterator<char>(inDataStream), {});
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sets lumped capacity for several nets in specific hierarchical context.
- * Capacitance value must be in farads.
- * @param inNetsDataVec nets and their context
- * @param inNetCapsVec capacitance values
- * @return success status
- */
-bool StaClientBase::setNetsLumpCap(
-		const std::vector<NetContextPath>& inNetsDataVec,
-		const std::vector<float>& inNetCapsVec) {
-	if(inNetsDataVec.empty())
-		return true;
-
-	CommandSetGroupNetCap command;
-
-	//adding info of each net
-	for(size_t i = 0; i < inNetsDataVec.size() && i < inNetCapsVec.size(); i++) {
-		//skipping unexistent nets
-		if(!inNetsDataVec[i].mObjectPtr)
-			continue;
-
-		command.mNetAddrsVec.push_back(ObjectContextNameData());
-		command.mNetAddrsVec.back().mObjName = getName(inNetsDataVec[i].mObjectPtr);
-		//adding names of instances in context
-		for(const GenericInst* instPtr : inNetsDataVec[i].mInstContextVec)
-			command.mNetAddrsVec.back().
-					mInstContextVec.push_back(getName(instPtr));
-
-		command.mValuesVec.push_back(inNetCapsVec[i]);
-	}
-
-	//making timing data invalid if wire load has changed
-	clearTimingMapping();
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Sends command to read SDF file.
- * @param inFileName file name
- * @return success status
- */
-bool StaClientBase::readSdfFile(
-		const std::string& inFileName) {
-	CommandReadSdfFile command;
-	command.mStr = inFileName;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sends command to read SDF stream.
- * @param inDataStream data stream
- * @return success status
- */
-bool StaClientBase::readSdfStream(
-		std::istream& inDataStream) {
-	CommandReadSdfStream command;
-	command.mStr = std::string(
-			std::istreambuf_iterator<char>(inDataStream), {});
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Sends command to write SDF file.
- * @param inFileName file name
- * @return success status
- */
-bool StaClientBase::writeSdfFile(
-		const std::string& inFileName) {
-	CommandWriteSdfFile command;
-	command.mStr = inFileName;
-
-	return mProtocol.execute(command);
-}
-
-/**
- * Method to get mappings of nodes and edges of timing graph from STA engine.
- * First gets graph data, then maps netlist objects by their paths.
- * In the end matches netlist object to graph IDs.
- * Returns false if block pointer is null or fails to get data.
- * Clears all previously stored mappings through the callback mechanism.
- * @param inBlockPtr top block
- * @return success status
- */
-bool StaClientBase::loadNetlistGraph(
-		const GenericBlock* inBlockPtr) {
-	if(!inBlockPtr)
-		return false;
-
-	//remapping the received graph data to pins with callback mechanism
-	std::vector<VertexIdData> vertexIdToDataVec;
-	std::vector<EdgeIdData> edgeIdToDataVec;
-	CommandGetGraphData command;
-
-	if(!mProtocol.execute(
-			command, vertexIdToDataVec, edgeIdToDataVec))
-		return false;
-
-	clearGraphMapping();
-	mHasGraph = addGraphMapping(inBlockPtr,
-			vertexIdToDataVec, edgeIdToDataVec);
-	return mHasGraph;
-}
-
-/**
- * Method to get pin slacks from STA engine.
- * Does nothing and returns false if timing graph wasn't loaded.
- * @return success status
- */
-bool StaClientBase::loadNetlistSlacks() {
-	if(!mHasGraph)
-		return false;
-
-	CommandGetGraphSlacksData command;
-	mNodeTimingDataVec.clear();
-	mHasGraphTiming = mProtocol.execute(command, mNodeTimingDataVec);
-
-//	for(auto& data: mNodeTimingDataVec) {
-//		std::cout << "Node " << data.mNodeId << ": "
-//				<< " mHasTiming =" << data.mHasTiming
-//				<< " mMaxWorstSlackAat =" << data.mMaxWorstSlackAat
-//				<< " mMaxWorstSlackRat =" << data.mMaxWorstSlackRat
-//				<< " mMinWorstSlackAat =" << data.mMinWorstSlackAat
-//				<< " mMinWorstSlackRat =" << data.mMinWorstSlackRat
-//				<< std::endl;
-//	}
-
-
-	//must be virtual to modify it in subclasses
-	if(mHasGraphTiming) {
-		std::vector<float> clockMinWorstRatVec;
-		std::vector<float> clockMaxWorstRatVec;
-		std::vector<float> clockMinWorstSlackVec;
-		std::vector<float> clockMaxWorstSlackVec;
-
-		mHasGraphTiming =
-			collectClockShifts(mNodeTimingDataVec,
-					clockMinWorstRatVec, clockMaxWorstRatVec,
-					clockMinWorstSlackVec, clockMaxWorstSlackVec) &&
-			calcNodeCritFactors(
-				mNodeTimingDataVec, mNodeMinCritFactorsVec,
-				clockMinWorstRatVec, clockMinWorstSlackVec, true) &&
-			calcNodeCritFactors(
-				mNodeTimingDataVec, mNodeMaxCritFactorsVec,
-				clockMaxWorstRatVec, clockMaxWorstSlackVec, false);
-		return mHasGraphTiming;
-	}
-
-	return false;
-}
-
-/**
- * Calculates timing criticalness factor on group's and node's data.
- * @param inData timing data of target node
- * @param inGroupMinSlack min slack of constraint group
- * @param inGroupMaxSlack max slack of constraint group
- * @param inGroupMaxRat max RAT of group's endpoint
- * @param inMinConstraint flag of min-constraint
- * @return criticality factor
- */
-float StaClientBase::calcCritFactor(
-						const NodeTimingData& inData,
-						float inGroupMinSlack,
-						float inGroupMaxSlack,
-						float inGroupMaxRat,
-						bool inMinConstraint) {
-
-	float shiftAdd = inGroupMinSlack;
-
-	//flipping the minimum slack to use it as a shifter of the paths group
-	if(shiftAdd >= 0) {
-		shiftAdd = 0;
-	} else {
-		shiftAdd *= -1;
-	}
-
-	//if max slack(with shift) exceeds divider, then use it instead
-	inGroupMaxRat += shiftAdd;
-	if(inGroupMaxSlack + shiftAdd > inGroupMaxRat)
-		inGroupMaxRat = inGroupMaxSlack + shiftAdd;
-
-	//zero, you shall not pass!
-	if(inGroupMaxRat == 0)
-		inGroupMaxRat += 1;
-
-	//then finally calculating the node critical factor
-	float nodeSlack = getNodeDataSlack(inData, inMinConstraint);
-	return 1 - ( (nodeSlack + shiftAdd) / inGroupMaxRat );
-}
-
-float StaClientBase::getNodeDataSlack(
-		const NodeTimingData& inData,
-		bool inMinConstraint) {
-	if(inMinConstraint)
-		return inData.mMinWorstSlackAat - inData.mMinWorstSlackRat;
-
-	return inData.mMaxWorstSlackRat - inData.mMaxWorstSlackAat;
-}
-
-
-/**
- * Fills worst min/max RATs and slacks for clocks mentioned in node timings.
- * Resizes output vectors depending on clock index.
- * @param inNodeTimingData nodes timing data
- * @param outClockMinWorstRatVec worst min RATs for clocks
- * @param outClockMaxWorstRatVec worst max RATs for clocks
- * @param outClockMaxWorstRatVec worst min slacks for clocks
- * @param outClockMaxWorstRatVec worst max slacks for clocks
- * @return success flag
- */
-bool StaClientBase::collectClockShifts(
-						const std::vector<NodeTimingData>& inNodeTimingData,
-						std::vector<float>& outClockMinWorstRatVec,
-						std::vector<float>& outClockMaxWorstRatVec,
-						std::vector<float>& outClockMinWorstSlackVec,
-						std::vector<float>& outClockMaxWorstSlackVec) {
-	outClockMinWorstRatVec.clear();
-	outClockMaxWorstRatVec.clear();
-	outClockMinWorstSlackVec.clear();
-	outClockMaxWorstSlackVec.clear();
-
-	float minSlack = 0;
-	float maxSlack = 0;
-	float minRat = 0;
-	float maxRat = 0;
-
-	for(const NodeTimingData& data : inNodeTimingData) {
-		if(!data.mHasTiming || data.mClkIdx < 0)
-			continue;
-
-		if(data.mNonData)
-			continue;
-
-		if(data.mClkIdx >= outClockMinWorstRatVec.size()) {
-			outClockMinWorstRatVec.resize(data.mClkIdx+1, 0);
-			outClockMaxWorstRatVec.resize(data.mClkIdx+1, 0);
-			outClockMinWorstSlackVec.resize(data.mClkIdx+1, 0);
-			outClockMaxWorstSlackVec.resize(data.mClkIdx+1, 0);
-		}
-
-		minSlack = getNodeDataSlack(data, true);
-		maxSlack = getNodeDataSlack(data, false);
-		minRat = data.mMinWorstSlackAat;
-		maxRat = data.mMaxWorstSlackRat;
-
-		if(minSlack < outClockMinWorstSlackVec[data.mClkIdx])
-			outClockMinWorstSlackVec[data.mClkIdx] = minSlack;
-		if(maxSlack < outClockMaxWorstSlackVec[data.mClkIdx])
-			outClockMaxWorstSlackVec[data.mClkIdx] = maxSlack;
-
-		if(minRat > outClockMinWorstRatVec[data.mClkIdx])
-			outClockMinWorstRatVec[data.mClkIdx] = minRat;
-		if(maxRat > outClockMaxWorstRatVec[data.mClkIdx])
-			outClockMaxWorstRatVec[data.mClkIdx] = maxRat;
-	}
-
-	return true;
-}
-
-
-/**
- * Calculates criticalness factors for all nodes based on their timing data.
- * Skips nodes that lack constrained path endpoints (i.e. unconstrained directly).
- * @param inNodeTimingData nodes timing data
- * @param outNodeCritFactorsVec nodes criticalness factors to set
- * @param inWorstRatPerClockVec worst RATs for clocks
- * @param inWorstSlackPerClockVec worst slacks for clocks
- * @param inMinConstraint min-constraint flag
- * @return success flag
- */
-bool StaClientBase::calcNodeCritFactors(
-						const std::vector<NodeTimingData>& inNodeTimingData,
-						std::vector<float>& outNodeCritFactorsVec,
-						const std::vector<float>& inWorstRatPerClockVec,
-						const std::vector<float>& inWorstSlackPerClockVec,
-						bool inMinConstraint) {
-//	float undefEndpointMinSlack = std::numeric_limits<float>::max();
-//	float undefEndpointMaxSlack = std::numeric_limits<float>::lowest();
-//	float undefEndpointDivider = std::numeric_limits<float>::lowest();
-
-	std::vector<float> endpointMinSlackVec;
-	std::vector<float> endpointMaxSlackVec;
-	std::vector<float> endpointDividerVec;
-
-	float nodeSlack = 0;
-	float worstRat = 0;
-	float worstSlack = 0;
-	float criticality = 0;
-	int clkIdx = 0;
-
-	outNodeCritFactorsVec.clear();
-	outNodeCritFactorsVec.resize(inNodeTimingData.size(), 0);
-
-	//process timing data of all nodes to find slack intervals and RAT dividers of endpoints
-	//then calculating criticality of each node
-	for(size_t nIdx = 0; nIdx < inNodeTimingData.size(); nIdx++) {
-		if(!inNodeTimingData[nIdx].mHasTiming)
-			continue;
-
-		//clocks and other control signals have max criticality
-		if(inNodeTimingData[nIdx].mNonData) {
-			outNodeCritFactorsVec[nIdx] = 1;
-			continue;
-		}
-
-		clkIdx = inNodeTimingData[nIdx].mClkIdx;
-		if(clkIdx < 0 ||
-				clkIdx >= inWorstRatPerClockVec.size() ||
-				clkIdx >= inWorstSlackPerClockVec.size())
-			continue;
-
-		nodeSlack = getNodeDataSlack(inNodeTimingData[nIdx], inMinConstraint);
-		worstRat = inWorstRatPerClockVec[clkIdx];
-		worstSlack = inWorstSlackPerClockVec[clkIdx];
-
-		if(worstSlack < 0)
-			worstSlack *= -1;
-
-		nodeSlack += worstSlack;
-		worstRat += worstSlack;
-
-		if(nodeSlack > worstRat)
-			worstRat = nodeSlack;
-
-		criticality = 1 - nodeSlack/worstRat;
-		if(criticality < 0)
-			criticality = 0;
-		if(criticality > 1)
-			criticality = 1;
-
-		outNodeCritFactorsVec[nIdx] = criticality;
-	}
-//
-//
-//	//then calculating criticality of each node
-//	outNodeCritFactorsVec.clear();
-//	outNodeCritFactorsVec.resize(inNodeTimingData.size(), 0);
-//
-//
-//	for(size_t nIdx = 0; nIdx < inNodeTimingData.size(); nIdx++) {
-//		if(!inNodeTimingData[nIdx].mHasTiming)
-//			continue;
-//
-//		//NOTE: ignoring now unconstrained nodes and keeping their critical factor as 0
-//		if(inNodeTimingData[nIdx].mEndPointIdx > inNodeTimingData.size())
-//			continue;
-//
-//		//std::cout << "Calc crit factor of node #" << nIdx << std::endl;
-//
-//		//calculating critical factor of the node
-//		outNodeCritFactorsVec[nIdx] = calcCritFactor(
-//				inNodeTimingData[nIdx],
-//				endpointMinSlackVec[inNodeTimingData[nIdx].mEndPointIdx],
-//				endpointMaxSlackVec[inNodeTimingData[nIdx].mEndPointIdx],
-//				endpointDividerVec[inNodeTimingData[nIdx].mEndPointIdx],
-//				inMinConstraint);
-//	}
-
-	return true;
-}
-
-/**
- * Returns critical factor of node of the sink pin.
- * Does nothing and returns false if fails to find edge/node in the graph.
- * Does nothing and returns false if timing/graph data wasn't initialized.
- * Writes out zero if node index is out of bounds.
- * @param inSourcePinPtr beginning pin of the edge
- * @param inSinkPinPtr ending pin of the edge
- * @param inMinConstraint flag to get min-constraint factor
- * @param outCritFactor factor to set
- * @return success flag
- */
-bool StaClientBase::getArcCritFactor(
-						const GenericPin* inSourcePinPtr,
-						const GenericPin* inSinkPinPtr,
-						bool inMinConstraint,
-						float& outCritFactor) {
-	if(!mHasGraph || !mHasGraphTiming)
-		return false;
-
-	auto sourceIt = mSourcePinToVertexIdUMap.find(inSourcePinPtr);
-	auto sinkIt = mSourcePinToVertexIdUMap.find(inSourcePinPtr);
-	if(sourceIt == mSourcePinToVertexIdUMap.end() ||
-			sinkIt == mSourcePinToVertexIdUMap.end())
-		return false;
-
-	auto edgeIt = mPinPairToEdgeIdUMap.find(
-			std::make_pair(inSourcePinPtr, inSinkPinPtr));
-	if(edgeIt == mPinPairToEdgeIdUMap.end())
-		return false;
-
-	uint32_t nodeId = std::numeric_limits<uint32_t>::max();
-	auto it = mSourcePinToVertexIdUMap.begin();
-
-	//if it is intra-instance, then search sink first in sources, then in sinks
-	if(getParentInstance(inSourcePinPtr) == getParentInstance(inSinkPinPtr)) {
-		it = mSourcePinToVertexIdUMap.find(inSinkPinPtr);
-		if(it != mSourcePinToVertexIdUMap.end()) {
-			nodeId = it->second;
-		} else {
-			it = mSinkPinToVertexIdUMap.find(inSinkPinPtr);
-			if(it != mSinkPinToVertexIdUMap.end())
-				nodeId = it->second;
-		}
-	} else {
-		//for inter-instance search in reverse order
-		it = mSinkPinToVertexIdUMap.find(inSinkPinPtr);
-		if(it != mSinkPinToVertexIdUMap.end()) {
-			nodeId = it->second;
-		} else {
-			it = mSourcePinToVertexIdUMap.find(inSinkPinPtr);
-			if(it != mSourcePinToVertexIdUMap.end())
-				nodeId = it->second;
-		}
-	}
-
-	//nothing to do if failed to find node ID
-	if(nodeId >= mNodeMinCritFactorsVec.size() ||
-			nodeId >= mNodeMaxCritFactorsVec.size())
-		return false;
-
-	if(inMinConstraint)
-		outCritFactor = mNodeMinCritFactorsVec[nodeId];
-	else
-		outCritFactor = mNodeMaxCritFactorsVec[nodeId];
-
-	return true;
-}
-
-
-/**
- * Sends command to set inter-pin delay in top-module context.
- * @param inSourcePinPtr source pin pointer
- * @param inSinkPinPtr sink pin pointer
- * @param inMin apply as min delay
- * @param inMax apply as max delay
- * @param inValue delay value
- */
-bool StaClientBase::setInterPinArcDelay(
-		const GenericPin* inSourcePinPtr,
-		const GenericPin* inSinkPinPtr,
-		bool inMin,
-		bool inMax,
-		float inValue) {
-	if(!inSourcePinPtr || !inSinkPinPtr)
-		return false;
-
-	//making timing data invalid if arc delay changed
-	clearTimingMapping();
-
-	InterPinDelayData arcData = {inSourcePinPtr, inSinkPinPtr, inValue};
-	return setInterPinArcDelays(
-			{arcData},
-			inMin, inMax);
-}
-
-/**
- * Method to set inter-pin delays in top-module context.
- * Ignores unexistent edges.
- * Returns false if non-empty input arcs vector becomes empty after filtering out.
- * Delay value is in seconds.
- * @param inArcDelaysVec pin pairs and their delays
- * @param inMin apply as min delay
- * @param inMax apply as max delay
- */
-bool StaClientBase::setInterPinArcDelays(
-						const std::vector<InterPinDelayData>& inArcDelaysVec,
-						bool inMin,
-						bool inMax) {
-	//return true when there's nothing to do
-	if(inArcDelaysVec.empty())
-		return true;
-
-	//nothing to do if graph mapping isn't ready
-	if(!mHasGraph)
-		return false;
-
-	bool allOk = true;
-
-	CommandSetArcsDelays command;
-	command.mMin = inMin;
-	command.mMax = inMax;
-
-	std::string sourceName;
-	std::string sinkName;
-
-	//processing all arc to find vertexes
-	//skipping pin pairs that have no edge ID
-	for(const InterPinDelayData& arcData : inArcDelaysVec) {
-		auto edgePairIt = mPinPairToEdgeIdUMap.equal_range(
-				std::make_pair(arcData.mSourcePinPtr, arcData.mSinkPinPtr));
-
-//		sourceName = getName(getParentInstance(arcData.mSourcePinPtr));
-//		sourceName += "/";
-//		sourceName += getName(arcData.mSourcePinPtr);
-//		sinkName = getName(getParentInstance(arcData.mSinkPinPtr));
-//		sinkName += "/";
-//		sinkName += getName(arcData.mSinkPinPtr);
-
-		if(edgePairIt.first == edgePairIt.second) {
-//			std::cout << "no edge '" << sourceName << "' -> '" << sinkName << "'" << std::endl;
-//
-//			auto sourceVertIt = mSourcePinToVertexIdUMap.find(arcData.mSourcePinPtr);
-//			if(sourceVertIt != mSourcePinToVertexIdUMap.end())
-//				std::cout << "\tsource_vertex: " << sourceVertIt->second << std::endl;
-//			else
-//				std::cout << "\tsource_vertex: undefined" << std::endl;
-//
-//			auto sinkVertIt = mSinkPinToVertexIdUMap.find(arcData.mSinkPinPtr);
-//			if(sinkVertIt != mSinkPinToVertexIdUMap.end())
-//				std::cout << "\tsink_vertex: " << sinkVertIt->second << std::endl;
-//			else
-//				std::cout << "\tsink_vertex: undefined" << std::endl;
-
-			//allOk = false;
-			continue;
-		}
-
-		//setting delay for all edges between two nodes
-		for(; edgePairIt.first != edgePairIt.second; edgePairIt.first++) {
-//			std::cout << "edge '" << edgePairIt.first->second << ": " << sourceName << "' -> '" << sinkName << "'" << std::endl;
-
-			command.mEdgeIdsVec.push_back(edgePairIt.first->second);
-			command.mDelayValuesVec.push_back(arcData.mValue);
-		}
-
-	}
-
-	if(!inArcDelaysVec.empty() && command.mEdgeIdsVec.empty())
-		return false;
-
-	//NOTE: sometimes STA engine may remove net edges on it own
-	//so have to accept this fact and continue as it never happened
-//	//there were unexistent edges
-//	if(!allOk)
-//		return false;
-
-	//return true when there's nothing to do
-	if(command.mDelayValuesVec.empty() ||
-			command.mEdgeIdsVec.empty())
-		return true;
-
-	//making timing data invalid if arc delay changed
-	clearTimingMapping();
-
-	return mProtocol.execute(command);
-}
-
-
-/**
- * Sends command to report timing and gets resulting report.
- * @param inUnique report unique paths(without rise/fall variations)
- * @param inMin report min-constraint paths
- * @param inMax report max-constraint paths
- * @param inUnconstrained report unconstrained paths
- * @param inEndPointsNum amount of endpoints to report
- * @param inGroupsNum amount of groups to report
- * @param outReportStr report string to fill
- * @return success status
- */
-bool StaClientBase::reportTiming(
-		bool inUnique,
-		bool inMin,
-		bool inMax,
-		bool inUnconstrained,
-		uint32_t inEndPointsNum,
-		uint32_t inGroupsNum,
-		std::string& outReportStr) {
-	CommandReportTiming command;
-
-	command.mUniquePaths = inUnique;
-	command.mMin = inMin;
-	command.mMax = inMax;
-	command.mUnconstrained = inUnconstrained;
-	command.mEndPointsNum = inEndPointsNum;
-	command.mGroupsNum = inGroupsNum;
-
-	return mProtocol.execute(command, outReportStr);
-}
-
-/**
- * Method to report basic timing stats of the design.
- * @param inCommand command to execute
- * @param outMinWNS worst slack for min condition
- * @param outMinWNS worst slack for max condition
- * @param outMinWNS total negative slack for min condition
- * @param outMinWNS total negative slack for max condition
- * @success status
- */
-bool StaClientBase::getDesignStats(
-		float& outMinWNS,
-		float& outMaxWNS,
-		float& outMinTNS,
-		float& outMaxTNS) {
-	CommandGetDesignStats command;
-
-	return mProtocol.execute(
-			command,
-			outMinWNS, outMaxWNS,
-			outMinTNS, outMaxTNS);
-}
-
-
-/**
- * Clears all internal mappings of graph IDs and timings.
- */
-void StaClientBase::clearGraphMapping() {
-	//std::cout << "Clearing graph mapping" << std::endl;
-	mPathToPinUMap.clear();
-	mSourcePinToVertexIdUMap.clear();
-	mSinkPinToVertexIdUMap.clear();
-	mPinPairToEdgeIdUMap.clear();
-	mHasGraph = false;
-
-	clearTimingMapping();
-}
-
-/**
- * Clears all internal timing data.
- */
-void StaClientBase::clearTimingMapping() {
-	mNodeTimingDataVec.clear();
-	mNodeMinCritFactorsVec.clear();
-	mNodeMaxCritFactorsVec.clear();
-	mHasGraphTiming = false;
-}
-
-/**
- * First remaps vertexes to pins
- * Then fills driver/sink pins -> vertexIds and pin pairs to edgeIDs.
- * Returns false if fails to fill data on each of steps.
- * @param inBlockPtr top-block
- * @param inVertexIdToDataVec vertexes data
- * @param inEdgeIdToDataVec edges data
- */
-bool StaClientBase::addGraphMapping(
-						const GenericBlock* inBlockPtr,
-						const std::vector<VertexIdData>& inVertexIdToDataVec,
-						const std::vector<EdgeIdData>& inEdgeIdToDataVec) {
-
-	//preparing mapping of the netlist objects by their paths
-	if(!addBlockPinsInNameMap(
-			nullptr, inBlockPtr,
-			mDivider, "", mPathToPinUMap))
-		return false;
-
-	//also have to map pins of top-level ports
-	std::vector<GenericPort*> topPortsVec;
-	getPorts(inBlockPtr, topPortsVec);
-	for(GenericPort* portPtr : topPortsVec) {
-		if(!portPtr || !getPortPin(portPtr))
-			continue;
-
-		mPathToPinUMap.emplace(
-				getName(portPtr), getPortPin(portPtr));
-	}
-
-
-	//first matching vertexes and pins between each other
-	std::vector<GenericPin*> vertexIdToPinVec;
-	if(!matchVertexPins(inVertexIdToDataVec,
-			mPathToPinUMap, vertexIdToPinVec))
-		return false;
-
-	//then fill pin -> vertexId mappings
-	//depending on vertex "driver" flag
-	if(!fillPinToVertexIdMaps(
-			vertexIdToPinVec,
-			inVertexIdToDataVec,
-			mSourcePinToVertexIdUMap,
-			mSinkPinToVertexIdUMap))
-		return false;
-
-	//finally filling the edge mapping
-	if(!fillPinPairsToEdgeIdMap(
-			vertexIdToPinVec,
-			inEdgeIdToDataVec,
-			mPinPairToEdgeIdUMap))
-		return false;
-
-	return true;
-}
-
-/**
- * For each vertex data creates a path.
- * Then by matching path to pin's one creates matching.
- * Returns false if fails to find one of the pins.
- * @param inVertexIdToDataVec data of vertexes
- * @param inPathToPinUMap paths of pins
- * @param outVertexIdToPinVec output vertex-pin mapping
- * @return operation success
- */
-bool StaClientBase::matchVertexPins(
-						const std::vector<VertexIdData>& inVertexIdToDataVec,
-						const std::map<std::string, GenericPin*>& inPathToPinUMap,
-						std::vector<GenericPin*>& outVertexIdToPinVec) {
-	std::string vertexPath;
-	auto pinIt = inPathToPinUMap.begin();
-
-	outVertexIdToPinVec.clear();
-	outVertexIdToPinVec.resize(
-			inVertexIdToDataVec.size(),
-			nullptr);
-
-//	std::cout << "Matching vertex IDX and pins" << std::endl;
-
-	//processing data of all vertexes
-	//vertexId is ignores, because edge references the vector indexes now
-	for(size_t dataIdx = 0; dataIdx < inVertexIdToDataVec.size(); dataIdx++) {
-		//creating path
-		vertexPath = "";
-		for (const auto &instName : inVertexIdToDataVec[dataIdx].mContextInstNamesVec) {
-			vertexPath += instName;
-			vertexPath += mDivider;
-		}
-		vertexPath += inVertexIdToDataVec[dataIdx].mPinName;
-
-		//searching the pin
-		pinIt = inPathToPinUMap.find(vertexPath);
-		if(pinIt == inPathToPinUMap.end()) {
-//			std::cout << "vertex index " << dataIdx << " failed to find pin for: " << vertexPath << std::endl;
-			return false;
-		}
-
-		if(!pinIt->second){
-//			std::cout << "vertex index " << dataIdx << " failed to find pin for: " << vertexPath << std::endl;
-			return false;
-		}
-
-//		std::cout << "vertex index " << dataIdx << " -> " << vertexPath << std::endl;
-
-		outVertexIdToPinVec[dataIdx] = pinIt->second;
-	}
-
-	return true;
-}
-
-/**
- * Maps out vertex IDs of pins.
- * Writes out in driver or sink map depending on driver flag of vertex data.
- * @param inVertexIdToPinVec vertexId->pin mapping
- * @param inVertexIdToDataVec data of vertexes
- * @param inPathToPinUMap paths of pins
- * @param outVertexIdToPinVec output vertex-pin mapping
- * @return operation success
- */
-bool StaClientBase::fillPinToVertexIdMaps(
-						const std::vector<GenericPin*>& inVertexIdToPinVec,
-						const std::vector<VertexIdData>& inVertexIdToDataVec,
-						std::unordered_map<const GenericPin*, uint32_t>& mDriverPinToVertexIdUMap,
-						std::unordered_map<const GenericPin*, uint32_t>& mSinkPinToVertexIdUMap) {
-	GenericPin* pinPtr = nullptr;
-
-	mDriverPinToVertexIdUMap.clear();
-	mSinkPinToVertexIdUMap.clear();
-
-	//processing data of all vertexes
-	//pins are mapped by indexes in the vector
-	for(size_t dataIdx = 0; dataIdx < inVertexIdToDataVec.size(); dataIdx++) {
-		if(dataIdx >= inVertexIdToPinVec.size())
-			return false;
-
-		pinPtr = inVertexIdToPinVec[dataIdx];
-		if(!pinPtr) {
-			return false;
-		}
-
-		std::string pinName;
-		if(getParentInstance(pinPtr)) {
-			pinName = getName(getParentInstance(pinPtr));
-			pinName += "/";
-		}
-		pinName += getName(pinPtr);
-
-		//writing out mapping
-		//mapping into vertex IDs from timing graph, not the vector indexes
-		if(inVertexIdToDataVec[dataIdx].mIsDriver) {
-//			std::cout << "source mapping vertex idx of pin '" << pinName
-//					<< "' -> " << inVertexIdToDataVec[dataIdx].mVertexId  << std::endl;
-			mDriverPinToVertexIdUMap.emplace(pinPtr, dataIdx);
-		} else {
-//			std::cout << "sink mapping vertex idx of pin '" << pinName
-//					<< "' -> " << inVertexIdToDataVec[dataIdx].mVertexId << std::endl;
-			mSinkPinToVertexIdUMap.emplace(pinPtr, dataIdx);
-		}
-	}
-
-	return true;
-}
-
-/**
- * Maps out pin pairs to edge IDs.
- * @param inVertexIdToPinVec vertexId->pin mapping
- * @param inVertexIdToDataVec data of edges
- * @param outPinPairToEdgeIdUMap output mapping
- * @return operation success
- */
-bool StaClientBase::fillPinPairsToEdgeIdMap(
-						const std::vector<GenericPin*>& inVertexIdToPinVec,
-						const std::vector<EdgeIdData>& inEdgeIdToDataVec,
-						PinsPairToEdgeIdUMMap& outPinPairToEdgeIdUMap) {
-	const GenericPin* fromPinPtr = nullptr;
-	const GenericPin* toPinPtr = nullptr;
-
-	outPinPairToEdgeIdUMap.clear();
-
-	//processing data of all edges
-	for(const EdgeIdData& data : inEdgeIdToDataVec) {
-		//have to find pins for both vertex ends
-		if(data.mFromVertexId >= inVertexIdToPinVec.size() ||
-				data.mToVertexId >= inVertexIdToPinVec.size()) {
-//			std::cout << "out of bounds pins for edge " << data.mEdgeId <<
-//					": " << data.mFromVertexId << " -> " << data.mToVertexId << std::endl;
-			return false;
-		}
-		fromPinPtr = inVertexIdToPinVec[data.mFromVertexId];
-		toPinPtr = inVertexIdToPinVec[data.mToVertexId];
-
-		std::string sourceName = getName(getParentInstance(fromPinPtr));
-		sourceName += "/";
-		sourceName += getName(fromPinPtr);
-		std::string sinkName = getName(getParentInstance(toPinPtr));
-		sinkName += "/";
-		sinkName += getName(toPinPtr);
-
-		if(!fromPinPtr || !toPinPtr) {
-//			std::cout << "failed to find pins for edge " << data.mEdgeId <<
-//					": " << data.mFromVertexId << " -> " << data.mToVertexId  << std::endl;
-			return false;
-		}
-
-
-//		std::cout << "registering edge " << data.mEdgeId <<
-//				": '" << sourceName << "' -> '" << sinkName << "'" << std::endl;
-
-		outPinPairToEdgeIdUMap.insert(
-				std::make_pair(
-					std::make_pair(fromPinPtr, toPinPtr),
-					data.mEdgeId));
-	}
-
-	return true;
-}
-
-/**
- * Descends inside the block in DFS manner, maps pins of leaf insts by their paths.
- * For non-leaf masters accumulates inst names in path and descends deeper.
- * Returns false if block pointer is null.
- * @param inParentInstPtr previous parent instance
- * @param inBlockPtr target block
- * @param inDivider hierarchy divider to use
- * @param inPath current path
- * @param outPathToPinUMap output map to fill
- * @return operation success
- */
-bool StaClientBase::addBlockPinsInNameMap(
-						const GenericInst* inParentInstPtr,
-						const GenericBlock* inBlockPtr,
-						char inDivider,
-						const std::string& inPath,
-						std::map<std::string, GenericPin*>& outPathToPinMap) {
-	if(!inBlockPtr)
-		return false;
-
-	//std::cout << "Filling pin paths mapping" << std::endl;
-
-	bool allOk = true;
-
-	std::string nextPath;
-	std::vector<GenericInst*> childrenInstsVec;
-	std::vector<GenericPin*> instPinsVec;
-	GenericBlock* masterPtr = nullptr;
-
-	//processing all children instances
-	getBlockInsts(inParentInstPtr, inBlockPtr, childrenInstsVec);
-	for(GenericInst* instPtr : childrenInstsVec) {
-		if(!instPtr)
-			continue;
-
-		nextPath = inPath;
-		nextPath += getName(instPtr);
-		nextPath += inDivider;
-
-		masterPtr = getMasterBlock(instPtr);
-		if(!masterPtr)
-			continue;
-
-		//diving deeper if it isn't a leaf
-		if(!isLeafBlock(masterPtr)) {
-			allOk &= addBlockPinsInNameMap(
-					instPtr, masterPtr, inDivider,
-					nextPath, outPathToPinMap);
-			continue;
-		}
-
-		//otherwise mapping all pins in the instance
-		instPinsVec.clear();
-		getInstPins(instPtr, instPinsVec);
-		for(GenericPin* pinPtr : instPinsVec) {
-			if(!pinPtr)
-				continue;
-
-			outPathToPinMap.emplace(
-					nextPath+getName(pinPtr), pinPtr);
-		}
-	}
-
-	return allOk;
-}
-
-
-
-/**
- * Sets all data in path message, doesn't check anything.
- */
-bool StaClientBase::fillPathMesgData(
-						bool inFromRise,
-						bool inFromFall,
-						const std::vector<PinContextPath>& inFromPinPathsVec,
-						const std::vector<std::string>& inFromClocksVec,
-						const std::vector<InstContextPath>& inFromInstPathsVec,
-						bool inThroughRise,
-						bool inThroughFall,
-						const std::vector<PinContextPath>& inThroughPinPathsVec,
-						const std::vector<InstContextPath>& inThroughInstPathsVec,
-						const std::vector<NetContextPath>& inThroughNetPathsVec,
-						bool inToRise,
-						bool inToFall,
-						const std::vector<PinContextPath>& inToPinPathsVec,
-						const std::vector<std::string>& inToClocksVec,
-						const std::vector<InstContextPath>& inToInstPathsVec,
-						bool inRise,
-						bool inFall,
-						TimingPathMessageBase& outMessage) {
-	outMessage.mFromRise = inFromRise;
-	outMessage.mFromFall = inFromFall;
-	convertContextNameDataVec(inFromPinPathsVec, outMessage.mFromPinPathsVec);
-	outMessage.mFromClocksVec = inFromClocksVec;
-	convertContextNameDataVec(inFromInstPathsVec, outMessage.mFromInstPathsVec);
-
-	outMessage.mThroughRise = inThroughRise;
-	outMessage.mThroughFall = inThroughFall;
-	convertContextNameDataVec(inThroughPinPathsVec, outMessage.mThroughPinPathsVec);
-	convertContextNameDataVec(inThroughInstPathsVec, outMessage.mThroughInstPathsVec);
-	convertContextNameDataVec(inThroughNetPathsVec, outMessage.mThroughNetPathsVec);
-
-	outMessage.mToRise = inToRise;
-	outMessage.mToFall = inToFall;
-	convertContextNameDataVec(inToPinPathsVec, outMessage.mToPinPathsVec);
-	outMessage.mToClocksVec = inToClocksVec;
-	convertContextNameDataVec(inToInstPathsVec, outMessage.mToInstPathsVec);
-
-	outMessage.mRise = inRise;
-	outMessage.mFall = inFall;
-
-	return true;
-}
-
-
-
-}
-
-
+#include "StaClientBase.hpp"
+#include "common/ContentHash.hpp"
+#include "common/NodeTimingCalc.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <thread>
+
+namespace stamask {
+
+
+/**
+ * The constructor, makes protocol without any channel.
+ */
+StaClientBase::StaClientBase():
+			IStaClient(),
+			mProtocol(),
+			mDivider('/'),
+			mPathToPinUMap(),
+			mPartialPathsBlockPtr(nullptr),
+			mSourcePinToVertexIdUMap(),
+			mSinkPinToVertexIdUMap(),
+			mPinPairToEdgeIdUMap(),
+			mVertexIdToPinVec(),
+			mEdgeIdToVertexIdsVec(),
+			mHasGraph(false),
+			mGraphMappingGeneration(1),
+			mHandleEdgeIdsVec(),
+			mPinPairToHandleEdgeIdxUMap(),
+			mTimingBuffersArr(),
+			mFrontTimingIdx(0),
+			mHasGraphTiming(false),
+			mTimingStale(true),
+			mTimingStaleNum(0),
+			mTimingGeneration(0),
+			mLazyTimingInvalidation(false),
+			mPendingEdits(),
+			mPendingContextToIdxMap(),
+			mPendingAddedPinPathsVec(),
+			mPendingRemovedPinPathsVec(),
+			mSharedStreams(false),
+			mServerCritFactorBits(0),
+			mPackedSlacks(false),
+			mWriteBack(false),
+			mWriteBackArcsUMap(),
+			mWriteBackNetCapsMap(),
+			mWriteBackMutex() {
+	mProtocol.setCallback(this);
+}
+
+
+/**
+ * A destructor.
+ * Sends pending arc delays of write-back mode. Net caps can't be sent,
+ * since names of nets come from already destroyed subclass,
+ * so subclass has to \link flush or \link exit before.
+ */
+StaClientBase::~StaClientBase() {
+	flushArcs();
+}
+
+/**
+ * Writes error to standard error stream.
+ * It's used during destruction, when subclass' method is gone.
+ * @param inErrorStr error message
+ */
+void StaClientBase::printError(const std::string& inErrorStr) {
+	std::cerr << inErrorStr << std::endl;
+}
+
+/**
+ * Sets channel inside the protocol.
+ * Accepts even the nullptr.
+ * Protocol deletes previously set channel.
+ */
+void StaClientBase::setChannel(
+		IpcChannel* inChannelPtr) {
+	mProtocol.setChannel(inChannelPtr);
+}
+
+/**
+ * Returns channel that is preset in the protocol.
+ * @return channel pointer
+ */
+IpcChannel* StaClientBase::getChannel() {
+	return mProtocol.getChannel();
+}
+
+/**
+ * Enables handover of stream readers' data in shared memory objects.
+ * Seekable streams (like file streams) are read right into shared memory,
+ * that STA maps, so the text isn't serialized and copied in messages.
+ * Works only with STA on the same host, other streams are sent as usual.
+ * @param inEnabled flag to use shared memory
+ */
+void StaClientBase::setSharedStreams(bool inEnabled) {
+	mSharedStreams = inEnabled;
+}
+
+/**
+ * Checks that stream readers hand data over in shared memory.
+ * @return flag to use shared memory
+ */
+bool StaClientBase::getSharedStreams() const {
+	return mSharedStreams;
+}
+
+/**
+ * Sets server to compute criticality factors when netlist slacks are loaded.
+ * Server sends them as 8 or 16-bit fixed-point numbers instead of node timings,
+ * so pin timing data isn't available then.
+ * Subclasses' criticality calculation isn't used in this mode.
+ * @param inFactorBits bits of factors: 8, 16, or zero to compute them here
+ * @return false on unsupported amount of bits
+ */
+bool StaClientBase::setServerCritFactorBits(uint8_t inFactorBits) {
+	if(inFactorBits != 0 && inFactorBits != 8 && inFactorBits != 16)
+		return false;
+
+	mServerCritFactorBits = inFactorBits;
+	return true;
+}
+
+/**
+ * Returns bits of criticality factors computed by server.
+ * @return bits of factors, zero if they are computed here
+ */
+uint8_t StaClientBase::getServerCritFactorBits() const {
+	return mServerCritFactorBits;
+}
+
+/**
+ * Sets netlist slacks to be loaded with timing values
+ * reduced to 16-bit fixed-point numbers, unset values are kept.
+ * Precision is the range of design's timing values split in 65533 steps.
+ * @param inEnabled flag to load packed slacks
+ */
+void StaClientBase::setPackedSlacks(bool inEnabled) {
+	mPackedSlacks = inEnabled;
+}
+
+/**
+ * Checks that netlist slacks are loaded in packed form.
+ * @return flag to load packed slacks
+ */
+bool StaClientBase::getPackedSlacks() const {
+	return mPackedSlacks;
+}
+
+/**
+ * Sets arc delays and net caps to be kept here until timing is queried.
+ * The last value of each edge or net is kept, all of them are sent
+ * in one batch before timing queries and any other command that changes
+ * STA state, or on explicit \link flush, so commands aren't reordered.
+ * Pending updates are sent when disabled, on exit and on destruction.
+ * @param inEnabled flag to keep updates
+ * @return success status of sending pending updates
+ */
+bool StaClientBase::setWriteBack(bool inEnabled) {
+	mWriteBack = inEnabled;
+	if(!inEnabled)
+		return flush();
+
+	return true;
+}
+
+/**
+ * Checks that arc delays and net caps are kept until timing is queried.
+ * @return flag of write-back mode
+ */
+bool StaClientBase::getWriteBack() const {
+	return mWriteBack;
+}
+
+/**
+ * Checks that there are arc delays or net caps to send.
+ * @return flag of pending updates
+ */
+bool StaClientBase::hasPendingWriteBack() const {
+	std::unique_lock<std::mutex> lock(mWriteBackMutex);
+	return !mWriteBackArcsUMap.empty() || !mWriteBackNetCapsMap.empty();
+}
+
+/**
+ * Sends pending net caps in one command, then pending arc delays
+ * in one command per combination of min and max flags.
+ * Pending updates are dropped only after they were sent successfully,
+ * so failed flush can be retried. Commands that change STA state
+ * aren't sent while flush fails.
+ * @return success status
+ */
+bool StaClientBase::flush() {
+	bool ok = flushNetCaps();
+	ok = flushArcs() && ok;
+	return ok;
+}
+
+/**
+ * Sets timing to stay readable after changes of arc delays and net caps.
+ * Stale timing is marked, see \link isTimingStale, and replaced
+ * only when the next load succeeds. Slacks are loaded in the back buffer,
+ * so timing getters may be called from another thread during the load,
+ * while no other commands are sent and no other load is started.
+ * In write-back mode setters of arc delays and net caps may be called too,
+ * their updates are kept until the next flush and keep loaded timing stale.
+ * Timing is still dropped with graph mapping.
+ * @param inEnabled flag to keep stale timing
+ */
+void StaClientBase::setLazyTimingInvalidation(bool inEnabled) {
+	mLazyTimingInvalidation = inEnabled;
+}
+
+/**
+ * Checks that stale timing stays readable until the next load.
+ * @return flag of lazy timing invalidation
+ */
+bool StaClientBase::getLazyTimingInvalidation() const {
+	return mLazyTimingInvalidation;
+}
+
+/**
+ * Checks that stream can be handed over in shared memory
+ * and gets amount of bytes left in it.
+ * Stream must be seekable and not empty, stream position is kept.
+ * @param inDataStream stream to check
+ * @param outBytesNum amount of bytes to read
+ * @return flag to hand the stream over
+ */
+bool StaClientBase::getSharedStreamSize(
+		std::istream& inDataStream,
+		uint64_t& outBytesNum) {
+	if(!mSharedStreams)
+		return false;
+
+	std::istream::pos_type startPos = inDataStream.tellg();
+	if(startPos == std::istream::pos_type(-1))
+		return false;
+
+	inDataStream.seekg(0, std::ios::end);
+	std::istream::pos_type endPos = inDataStream.tellg();
+	inDataStream.seekg(startPos);
+	if(!inDataStream ||
+			endPos == std::istream::pos_type(-1) ||
+			endPos <= startPos) {
+		inDataStream.clear();
+		inDataStream.seekg(startPos);
+		return false;
+	}
+
+	outBytesNum = uint64_t(endPos - startPos);
+	return true;
+}
+
+/**
+ * Returns internal flag that graph data was set up.
+ * @return flag that graph data was set up
+ */
+bool StaClientBase::hasGraph() const {
+	return mHasGraph;
+}
+
+
+/**
+ * Returns flag that graph&timing data were set up.
+ * @return flag that graph&timing data were set up
+ */
+bool StaClientBase::hasTimings() const {
+	return mHasGraph && mHasGraphTiming;
+}
+
+/**
+ * Checks that timing wasn't loaded or STA state has changed since the load.
+ * @return flag of stale timing
+ */
+bool StaClientBase::isTimingStale() const {
+	return mTimingStale;
+}
+
+/**
+ * Returns generation of readable timing, it grows with every load.
+ * @return timing generation, zero if timing isn't readable
+ */
+uint64_t StaClientBase::getTimingGeneration() const {
+	FrontTimingReader reader(*this);
+	if(!reader.getTiming())
+		return 0;
+
+	return reader.getTiming()->mGeneration;
+}
+
+/**
+ * Writes out calculated criticality of timing pin's node.
+ * First tries locate node idx in one mapping, then another.
+ * If edge sources has priority, then searches nodes in sources map.
+ * Need this flag in case of bidirectional pins.
+ * Writes out 0 and returns false if no graph or timing were loaded,
+ * no timing node was found for pin or node idx is out of bounds.
+ * Also returns false and outs 0 if pin pointer is null.
+ * Writes out max-condition criticality if inMin flag is false.
+ * @param inPinPtr target pin
+ * @param outValue output criticalicty value
+ * @param inMin flag to get min-condition criticality.
+ * @param inEdgeSourcePriority flag to first search edge sources
+ * @return success flag
+ */
+bool StaClientBase::getPinCriticality(
+						const GenericPin* inPinPtr,
+						float& outValue,
+						bool inMin,
+						bool inEdgeSourcePriority) const {
+	if(!mHasGraph || !mHasGraphTiming) {
+		//std::cout << "no graph and timing for criticality" << std::endl;
+		outValue = 0;
+		return false;
+	}
+
+	auto nodeIt = mSinkPinToVertexIdUMap.begin();
+	bool hasData = false;
+
+	//don't want to juggle pointers here
+	if(inEdgeSourcePriority) {
+		nodeIt = mSourcePinToVertexIdUMap.find(inPinPtr);
+		hasData = nodeIt != mSourcePinToVertexIdUMap.end();
+	} else {
+		nodeIt = mSinkPinToVertexIdUMap.find(inPinPtr);
+		hasData = nodeIt != mSinkPinToVertexIdUMap.end();
+	}
+
+	if(!hasData) {
+		if(inEdgeSourcePriority) {
+			nodeIt = mSinkPinToVertexIdUMap.find(inPinPtr);
+			hasData = nodeIt != mSinkPinToVertexIdUMap.end();
+		} else {
+			nodeIt = mSourcePinToVertexIdUMap.find(inPinPtr);
+			hasData = nodeIt != mSourcePinToVertexIdUMap.end();
+		}
+	}
+
+	//out 0, return false if pin wasn't registered
+	if(!hasData) {
+		//std::cout << "pin wasn't registered" << std::endl;
+		outValue = 0;
+		return false;
+	}
+
+	FrontTimingReader reader(*this);
+	if(!reader.getTiming()) {
+		outValue = 0;
+		return false;
+	}
+	const NodeTimingBuffer& timing = *reader.getTiming();
+
+	//node index must be within bounds
+	if((inMin && nodeIt->second >= timing.mNodeMinCritFactorsVec.size()) ||
+			(!inMin && nodeIt->second >= timing.mNodeMaxCritFactorsVec.size())) {
+		//std::cout << "node index must be within bounds" << std::endl;
+		outValue = 0;
+		return false;
+	}
+
+	if(inMin)
+		outValue = timing.mNodeMinCritFactorsVec[nodeIt->second];
+	else
+		outValue = timing.mNodeMaxCritFactorsVec[nodeIt->second];
+
+	return true;
+}
+
+bool StaClientBase::getPinTimingData(
+		const GenericPin* inPinPtr,
+		NodeTimingData& outValue) const {
+	if(!mHasGraph || !mHasGraphTiming) {
+		//std::cout << "no graph and timing for criticality" << std::endl;
+		return false;
+	}
+
+	auto nodeIt = mSinkPinToVertexIdUMap.begin();
+	bool hasData = false;
+
+	//don't want to juggle pointers here
+	nodeIt = mSourcePinToVertexIdUMap.find(inPinPtr);
+	hasData = nodeIt != mSourcePinToVertexIdUMap.end();
+
+	if(!hasData) {
+		nodeIt = mSinkPinToVertexIdUMap.find(inPinPtr);
+		hasData = nodeIt != mSinkPinToVertexIdUMap.end();
+	}
+
+	//out 0, return false if pin wasn't registered
+	if(!hasData) {
+		//std::cout << "pin wasn't registered" << std::endl;
+		return false;
+	}
+
+	FrontTimingReader reader(*this);
+	if(!reader.getTiming())
+		return false;
+	const NodeTimingBuffer& timing = *reader.getTiming();
+
+	//node index must be within bounds
+	if(nodeIt->second >= timing.mNodeTimingDataVec.size()) {
+		//std::cout << "node index must be within bounds" << std::endl;
+		return false;
+	}
+
+	outValue = timing.mNodeTimingDataVec[nodeIt->second];
+
+	return true;
+}
+
+/**
+ * Returns pin of timing graph vertex.
+ * Returns nullptr if graph isn't mapped or there's no such vertex.
+ * @param inVertexId vertex ID
+ * @return pin pointer
+ */
+GenericPin* StaClientBase::getVertexPin(uint32_t inVertexId) const {
+	if(!mHasGraph || inVertexId >= mVertexIdToPinVec.size())
+		return nullptr;
+
+	return mVertexIdToPinVec[inVertexId];
+}
+
+/**
+ * Returns vertex ID of the pin, searches sink or source vertices first.
+ * Returns false if graph isn't mapped or pin has no vertex.
+ * @param inPinPtr target pin
+ * @param outVertexId vertex ID to set
+ * @param inEdgeSourcePriority flag to first search edge sources
+ * @return success flag
+ */
+bool StaClientBase::getPinVertexId(
+		const GenericPin* inPinPtr,
+		uint32_t& outVertexId,
+		bool inEdgeSourcePriority) const {
+	if(!mHasGraph)
+		return false;
+
+	const auto& firstUMap = inEdgeSourcePriority ?
+			mSourcePinToVertexIdUMap : mSinkPinToVertexIdUMap;
+	const auto& secondUMap = inEdgeSourcePriority ?
+			mSinkPinToVertexIdUMap : mSourcePinToVertexIdUMap;
+
+	auto vertexIt = firstUMap.find(inPinPtr);
+	if(vertexIt == firstUMap.end()) {
+		vertexIt = secondUMap.find(inPinPtr);
+		if(vertexIt == secondUMap.end())
+			return false;
+	}
+
+	outVertexId = vertexIt->second;
+	return true;
+}
+
+/**
+ * Returns IDs of all parallel edges between two pins.
+ * Lets callers keep edge IDs to set arc delays without pin pairs lookup.
+ * @param inSourcePinPtr edge source pin
+ * @param inSinkPinPtr edge sink pin
+ * @param outEdgeIdsVec edge IDs to fill
+ * @return false if graph isn't mapped or there's no such edge
+ */
+bool StaClientBase::getPinPairEdgeIds(
+		const GenericPin* inSourcePinPtr,
+		const GenericPin* inSinkPinPtr,
+		std::vector<uint32_t>& outEdgeIdsVec) const {
+	outEdgeIdsVec.clear();
+	if(!mHasGraph)
+		return false;
+
+	auto edgePairIt = mPinPairToEdgeIdUMap.equal_range(
+			std::make_pair(inSourcePinPtr, inSinkPinPtr));
+	for(; edgePairIt.first != edgePairIt.second; edgePairIt.first++)
+		outEdgeIdsVec.push_back(edgePairIt.first->second);
+
+	return !outEdgeIdsVec.empty();
+}
+
+/**
+ * Returns generation of graph mapping.
+ * It changes when mapping is cleared or edges are removed,
+ * so edge handles of other generations are outdated.
+ * @return mapping generation
+ */
+uint32_t StaClientBase::getGraphMappingGeneration() const {
+	return mGraphMappingGeneration;
+}
+
+/**
+ * Checks that edge handle was resolved with current graph mapping.
+ * @param inHandle edge handle
+ * @return flag of valid handle
+ */
+bool StaClientBase::isEdgeHandleValid(const EdgeHandle& inHandle) const {
+	return mHasGraph && inHandle.mGeneration == mGraphMappingGeneration;
+}
+
+
+
+
+/**
+ * Returns beginning iterator of name-pin map.
+ * After snapshot attach map has only pins of graph vertices
+ * until netlist edits are uploaded.
+ * @return beginning name-pin iterator
+ */
+StaClientBase::StrToPinMap::const_iterator
+StaClientBase::beginPathPins() const {
+	//std::cout << "Path->pin mapping has " << mPathToPinUMap.size() << "entries" << std::endl;
+
+	return mPathToPinUMap.begin();
+}
+
+/**
+ * Returns ending iterator of name-pin map.
+ * @return ending name-pin iterator
+ */
+StaClientBase::StrToPinMap::const_iterator
+StaClientBase::endPathPins() const {
+	return mPathToPinUMap.end();
+}
+
+
+
+/**
+ * Sends command to set hierarchy separator in STA.
+ * Pending net caps are sent before, since their names use the separator.
+ * @param inSeparator separator
+ */
+void StaClientBase::setHierarchySeparator(
+		char inSeparator) {
+	flush();
+
+	CommandSetHierarhySeparator command;
+	command.mStr = inSeparator;
+	mDivider = inSeparator;
+
+	mProtocol.execute(command);
+}
+
+/**
+ * Sends command to exit STA.
+ * Pending updates of write-back mode are sent before,
+ * so they get in the command journal. STA exits even if that failed.
+ * Deletes the channel if command was successful.
+ */
+bool StaClientBase::exit() {
+	bool flushed = flush();
+	CommandExit command;
+
+	if(mProtocol.execute(command)) {
+		//closing the connection channel
+		//no need to delete channel, protocol does it on nullification
+		mProtocol.setChannel(nullptr);
+
+
+		return flushed;
+	}
+
+	return false;
+}
+
+/**
+ * Sends command to check that STA server is alive.
+ * Returns false if server returns fail status or timeout is reached.
+ * @param inMsTimeout ms to wait
+ */
+bool StaClientBase::ping(unsigned long inMsTimeout) {
+	CommandPing& command = mProtocol.acquireCommand<CommandPing>();
+	command.mMsTimeout = inMsTimeout;
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Sends command to read liberty file.
+ * @param inFileName file name
+ * @return success status
+ */
+bool StaClientBase::readLibertyFile(
+						const std::string& inFileName) {
+	if(!flush())
+		return false;
+
+	CommandReadLibertyFile command;
+	command.mStr = inFileName;
+
+	return mProtocol.execute(command);
+}
+/**
+ * Sends command to read liberty from stream.
+ * First asks STA in one lookup to take library parsed before from it's cache
+ * or liberty text it has stored before by content hash,
+ * liberty text is sent only if neither is found.
+ * Seekable stream is handed over in shared memory if it's enabled.
+ * @param inDataStream stream to read
+ * @return success status
+ */
+bool StaClientBase::readLibertyStream(
+		std::istream& inDataStream) {
+	if(!flush())
+		return false;
+
+	uint64_t bytesNum = 0;
+	if(getSharedStreamSize(inDataStream, bytesNum))
+		return mProtocol.executeSharedStream(
+				CommandReadLibertyStream::cMesgType, inDataStream, bytesNum);
+
+	CommandReadLibertyStream command;
+	command.mStr = std::string(
+			std::istreambuf_iterator<char>(inDataStream), {});
+
+	return mProtocol.executeStoredStream(command, hashContent(command.mStr));
+}
+
+/**
+ * Sends command to clear out all stored liberty libraries from STA.
+ * @return success status
+ */
+bool StaClientBase::clearLibraries()  {
+	if(!flush())
+		return false;
+
+	CommandClearLibs command;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Sends command to read Verilog file.
+ * @param inFileName file name
+ * @return success status
+ */
+bool StaClientBase::readVerilogFile(
+		const std::string& inFileName) {
+	if(!flush())
+		return false;
+
+	CommandReadVerilogFile command;
+	command.mStr = inFileName;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Sends command to read Verilog from stream.
+ * Text isn't sent if STA has stored it before.
+ * @param inDataStream stream to read
+ * @return success status
+ */
+bool StaClientBase::readVerilogStream(
+		std::istream& inDataStream) {
+	if(!flush())
+		return false;
+
+	uint64_t bytesNum = 0;
+	if(getSharedStreamSize(inDataStream, bytesNum))
+		return mProtocol.executeSharedStream(
+				CommandReadVerilogStream::cMesgType, inDataStream, bytesNum);
+
+	CommandReadVerilogStream command;
+	command.mStr = std::string(
+			std::istreambuf_iterator<char>(inDataStream), {});
+
+	return mProtocol.executeStoredStream(command, hashContent(command.mStr));
+}
+
+
+/**
+ * Method to build netlist structures from verilog data with given top-block.
+ * All modules must be pre-read from Verilog files.
+ * @param inTopBlockName top block name
+ * @return success status
+ */
+bool StaClientBase::linkVerilogTopBlockNetlist(
+						const std::string& inTopBlockName) {
+	if(!flush())
+		return false;
+
+	CommandLinkTop command;
+	command.mStr = inTopBlockName;
+
+	//have to reset status of graph and timing data
+	clearGraphMapping();
+	clearPendingNetlistEdits();
+	clearNameCache();
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Method to build anew netlist structures with given top-block in STA.
+ * Fills all data in a top-down manner and sends it to STA to create netlist.
+ * Must do so because STA may have parent-tracking to handle instance contexts.
+ * @param inBlockPtr top block
+ * @return success status
+ */
+bool StaClientBase::linkCreateTopBlockNetlist(
+						const GenericBlock* inBlockPtr) {
+	if(!flush())
+		return false;
+
+	if(!inBlockPtr)
+		return false;
+
+	//have to reset status of graph and timing data
+	//because previous top-level was destroyed either way
+	clearGraphMapping();
+	clearPendingNetlistEdits();
+	clearNameCache();
+
+	CommandCreateNetlist command;
+	BlockPtrToIdUMap blockToIdxUMap;
+	if(!fillBlockData(inBlockPtr, command.mBlockDataVec, blockToIdxUMap, true))
+		return false;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Method to connect pin and net from top-block in STA.
+ * @param inPinPtr pin pointer
+ * @param inNetPtr net pointer
+ * @return success status
+ */
+bool StaClientBase::connectTopContextPinNet(
+						const GenericPin* inPinPtr,
+						const GenericNet* inNetPtr) {
+	if(!flush())
+		return false;
+
+	if(!inPinPtr || !inNetPtr)
+		return false;
+
+	CommandConnectContextPinNet& command =
+			mProtocol.acquireCommand<CommandConnectContextPinNet>();
+	if(!fillPinNetCommand(command, {}, inPinPtr, inNetPtr))
+		return false;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Method to disconnect pin and net from top-block in STA.
+ * @param inPinPtr pin pointer
+ * @param inNetPtr net pointer
+ * @return success status
+ */
+bool StaClientBase::disconnectTopContextPinNet(
+						const GenericPin* inPinPtr,
+						const GenericNet* inNetPtr) {
+	if(!flush())
+		return false;
+
+	if(!inPinPtr || !inNetPtr)
+		return false;
+
+	CommandDisconnectContextPinNet& command =
+			mProtocol.acquireCommand<CommandDisconnectContextPinNet>();
+	if(!fillPinNetCommand(command, {}, inPinPtr, inNetPtr))
+		return false;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Method to connect pin and net from inst-context in STA.
+ * @param inInstContextVec top-bottom sequence of instances
+ * @param inPinPtr pin pointer
+ * @param inNetPtr net pointer
+ * @return success status
+ */
+bool StaClientBase::connectContextPinNet(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericPin* inPinPtr,
+						const GenericNet* inNetPtr) {
+	if(!flush())
+		return false;
+
+	if(!inPinPtr || !inNetPtr)
+		return false;
+
+	//graph data becomes invalid when netlist changes
+	clearGraphMapping();
+
+	CommandConnectContextPinNet& command =
+			mProtocol.acquireCommand<CommandConnectContextPinNet>();
+	if(!fillPinNetCommand(command, inInstContextVec, inPinPtr, inNetPtr))
+		return false;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Method to disconnect pin and net from inst-context in STA.
+ * @param inInstContextVec top-bottom sequence of instances
+ * @param inPinPtr pin pointer
+ * @param inNetPtr net pointer
+ * @return success status
+ */
+bool StaClientBase::disconnectContextPinNet(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericPin* inPinPtr,
+						const GenericNet* inNetPtr)  {
+	if(!flush())
+		return false;
+
+	if(!inPinPtr || !inNetPtr)
+		return false;
+
+	//graph data becomes invalid when netlist changes
+	clearGraphMapping();
+
+	CommandDisconnectContextPinNet& command =
+			mProtocol.acquireCommand<CommandDisconnectContextPinNet>();
+	if(!fillPinNetCommand(command, inInstContextVec, inPinPtr, inNetPtr))
+		return false;
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Connects and disconnects pins and nets in one command.
+ * Edits are queued after already pending ones and all of them are uploaded,
+ * so graph mapping is invalidated once for the whole batch.
+ * Returns false without queuing anything if some edit has null pointers.
+ * @param inEditsVec pin-net edits
+ * @return success status
+ */
+bool StaClientBase::editContextPinNets(
+						const std::vector<PinNetEditData>& inEditsVec) {
+	for(const PinNetEditData& edit : inEditsVec) {
+		if(!edit.mPinPtr || !edit.mNetPtr || !getParentInstance(edit.mPinPtr))
+			return false;
+	}
+
+	for(const PinNetEditData& edit : inEditsVec) {
+		queuePinNetEdit(
+				edit.mInstContextVec,
+				edit.mPinPtr,
+				edit.mNetPtr,
+				edit.mConnect ?
+						ENetlistEditType::eNetlistEditConnect :
+						ENetlistEditType::eNetlistEditDisconnect);
+	}
+
+	return uploadNetlistEdits();
+}
+
+
+/**
+ * Sends command to clear current netlist from STA.
+ * @return success status
+ */
+bool StaClientBase::clearNetlistBlocks() {
+	if(!flush())
+		return false;
+
+	CommandClearNetlistBlocks command;
+
+	clearGraphMapping();
+	clearPendingNetlistEdits();
+	clearNameCache();
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Queues addition of instance in inst-context.
+ * Pins of added instance are mapped by their paths after upload.
+ * @param inInstContextVec top-bottom sequence of parent instances
+ * @param inInstPtr added instance
+ * @return success status
+ */
+bool StaClientBase::queueAddContextInst(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericInst* inInstPtr) {
+	if(!inInstPtr || !getMasterBlock(inInstPtr))
+		return false;
+
+	NetlistEditData* editPtr = queueNetlistEdit(
+			inInstContextVec, ENetlistEditType::eNetlistEditAddInst);
+	editPtr->mInstName = getName(inInstPtr);
+	editPtr->mMasterName = getName(getMasterBlock(inInstPtr));
+
+	return queueInstPinPaths(inInstContextVec, inInstPtr, true);
+}
+
+/**
+ * Queues removal of instance from inst-context.
+ * Paths of instance pins are unmapped after upload.
+ * @param inInstContextVec top-bottom sequence of parent instances
+ * @param inInstPtr removed instance
+ * @return success status
+ */
+bool StaClientBase::queueRemoveContextInst(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericInst* inInstPtr) {
+	if(!inInstPtr || !getMasterBlock(inInstPtr))
+		return false;
+
+	NetlistEditData* editPtr = queueNetlistEdit(
+			inInstContextVec, ENetlistEditType::eNetlistEditRemoveInst);
+	editPtr->mInstName = getName(inInstPtr);
+
+	return queueInstPinPaths(inInstContextVec, inInstPtr, false);
+}
+
+/**
+ * Queues addition of net in inst-context.
+ * Net without connections doesn't change graph mapping.
+ * @param inInstContextVec top-bottom sequence of parent instances
+ * @param inNetPtr added net
+ * @return success status
+ */
+bool StaClientBase::queueAddContextNet(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericNet* inNetPtr) {
+	if(!inNetPtr)
+		return false;
+
+	queueNetlistEdit(inInstContextVec, ENetlistEditType::eNetlistEditAddNet)->
+			mNetName = getName(inNetPtr);
+	return true;
+}
+
+/**
+ * Queues removal of net from inst-context.
+ * Connections of the net must be queued as disconnections beforehand,
+ * so net removal by itself doesn't change graph mapping.
+ * @param inInstContextVec top-bottom sequence of parent instances
+ * @param inNetPtr removed net
+ * @return success status
+ */
+bool StaClientBase::queueRemoveContextNet(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericNet* inNetPtr) {
+	if(!inNetPtr)
+		return false;
+
+	queueNetlistEdit(inInstContextVec, ENetlistEditType::eNetlistEditRemoveNet)->
+			mNetName = getName(inNetPtr);
+	return true;
+}
+
+/**
+ * Queues connection of pin and net in inst-context.
+ * See \link queuePinNetEdit
+ */
+bool StaClientBase::queueConnectContextPinNet(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericPin* inPinPtr,
+						const GenericNet* inNetPtr) {
+	return queuePinNetEdit(
+			inInstContextVec, inPinPtr, inNetPtr,
+			ENetlistEditType::eNetlistEditConnect);
+}
+
+/**
+ * Queues disconnection of pin and net in inst-context.
+ * See \link queuePinNetEdit
+ */
+bool StaClientBase::queueDisconnectContextPinNet(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericPin* inPinPtr,
+						const GenericNet* inNetPtr) {
+	return queuePinNetEdit(
+			inInstContextVec, inPinPtr, inNetPtr,
+			ENetlistEditType::eNetlistEditDisconnect);
+}
+
+/**
+ * Sends all queued netlist edits in one command.
+ * On success updates pin paths and patches graph mapping in place
+ * with graph changes returned by STA, so reloading graph isn't needed.
+ * Timing data of unchanged vertexes remains from the last slacks load.
+ * Clears whole graph mapping if command failed or changes don't match netlist.
+ * Pending edits are dropped in any case.
+ * @return success status
+ */
+bool StaClientBase::uploadNetlistEdits() {
+	if(mPendingEdits.mEditsVec.empty())
+		return true;
+
+	if(!flush())
+		return false;
+
+	GraphChangesData changes;
+	bool ok = mProtocol.execute(mPendingEdits, changes);
+
+	if(ok && mHasGraph && !completePathToPinMap()) {
+		printError("Failed to map pin paths, graph mapping is cleared");
+		clearGraphMapping();
+	}
+
+	if(ok && mHasGraph) {
+		for(const std::string& path : mPendingRemovedPinPathsVec)
+			mPathToPinUMap.erase(path);
+		for(const auto& pathPin : mPendingAddedPinPathsVec)
+			mPathToPinUMap[pathPin.first] = pathPin.second;
+
+		if(!applyGraphChanges(changes)) {
+			printError("Graph changes don't match the netlist, graph mapping is cleared");
+			clearGraphMapping();
+		}
+	} else if(!ok) {
+		clearGraphMapping();
+	}
+
+	//removed objects may be deleted, their addresses reused
+	clearPendingNetlistEdits();
+	clearNameCache();
+	return ok;
+}
+
+/**
+ * Checks that there are netlist edits to upload.
+ * @return flag of pending edits
+ */
+bool StaClientBase::hasPendingNetlistEdits() const {
+	return !mPendingEdits.mEditsVec.empty();
+}
+
+/**
+ * Finds or adds nodes of instance context in pending edits prefix tree.
+ * Adds root node of top-block context with the first context.
+ * @param inInstContextVec top-bottom sequence of instances
+ * @return index of context node
+ */
+uint32_t StaClientBase::internInstContext(
+						const std::vector<GenericInst*>& inInstContextVec) {
+	if(mPendingEdits.mInstContextsVec.empty())
+		mPendingEdits.mInstContextsVec.emplace_back();
+
+	uint32_t contextIdx = 0;
+	for(const GenericInst* instPtr : inInstContextVec) {
+		if(!instPtr)
+			continue;
+
+		auto nodeIt = mPendingContextToIdxMap.find({contextIdx, instPtr});
+		if(nodeIt == mPendingContextToIdxMap.end()) {
+			nodeIt = mPendingContextToIdxMap.emplace(
+					std::make_pair(contextIdx, instPtr),
+					mPendingEdits.mInstContextsVec.size()).first;
+
+			mPendingEdits.mInstContextsVec.emplace_back();
+			mPendingEdits.mInstContextsVec.back().mParentIdx = contextIdx;
+			mPendingEdits.mInstContextsVec.back().mInstName = getName(instPtr);
+		}
+
+		contextIdx = nodeIt->second;
+	}
+
+	return contextIdx;
+}
+
+/**
+ * Adds edit of given type in pending edits.
+ * Instance contexts are shared between edits, edits go in the order of calls.
+ * @param inInstContextVec top-bottom sequence of parent instances
+ * @param inEditType edit type
+ * @return pointer to added edit, valid until next edit
+ */
+NetlistEditData* StaClientBase::queueNetlistEdit(
+						const std::vector<GenericInst*>& inInstContextVec,
+						ENetlistEditType inEditType) {
+	uint32_t contextIdx = internInstContext(inInstContextVec);
+
+	mPendingEdits.mEditsVec.emplace_back();
+	mPendingEdits.mEditsVec.back().mContextIdx = contextIdx;
+	mPendingEdits.mEditsVec.back().mEditType = inEditType;
+	return &mPendingEdits.mEditsVec.back();
+}
+
+/**
+ * Queues pin-net edit.
+ * Returns false if pin, net or pin's instance is null.
+ * @param inInstContextVec top-bottom sequence of parent instances
+ * @param inPinPtr pin pointer
+ * @param inNetPtr net pointer
+ * @param inEditType connect or disconnect edit
+ * @return success status
+ */
+bool StaClientBase::queuePinNetEdit(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericPin* inPinPtr,
+						const GenericNet* inNetPtr,
+						ENetlistEditType inEditType) {
+	if(!inPinPtr || !inNetPtr)
+		return false;
+
+	GenericInst* instPtr = getParentInstance(inPinPtr);
+	if(!instPtr)
+		return false;
+
+	NetlistEditData* editPtr = queueNetlistEdit(inInstContextVec, inEditType);
+	editPtr->mInstName = getName(instPtr);
+	editPtr->mPinName = getName(inPinPtr);
+	editPtr->mNetName = getName(inNetPtr);
+	return true;
+}
+
+/**
+ * Queues changes of pin paths for added or removed instance.
+ * For hierarchical instance takes paths of leaf pins inside of it.
+ * @param inInstContextVec top-bottom sequence of parent instances
+ * @param inInstPtr target instance
+ * @param inAdded flag that instance was added
+ * @return success status
+ */
+bool StaClientBase::queueInstPinPaths(
+						const std::vector<GenericInst*>& inInstContextVec,
+						const GenericInst* inInstPtr,
+						bool inAdded) {
+	GenericBlock* masterPtr = getMasterBlock(inInstPtr);
+
+	std::string instPath = getContextPath(inInstContextVec);
+	instPath += getName(inInstPtr);
+	instPath += mDivider;
+
+	StrToPinMap pathToPinMap;
+	if(!isLeafBlock(masterPtr)) {
+		if(!addBlockPinsInNameMap(
+				inInstPtr, masterPtr, mDivider,
+				instPath, pathToPinMap))
+			return false;
+	} else {
+		std::vector<GenericPin*> instPinsVec;
+		getInstPins(inInstPtr, instPinsVec);
+		for(GenericPin* pinPtr : instPinsVec) {
+			if(pinPtr)
+				pathToPinMap.emplace(instPath + getName(pinPtr), pinPtr);
+		}
+	}
+
+	for(const auto& pathPin : pathToPinMap) {
+		if(inAdded)
+			mPendingAddedPinPathsVec.push_back(pathPin);
+		else
+			mPendingRemovedPinPathsVec.push_back(pathPin.first);
+	}
+
+	return true;
+}
+
+/**
+ * Builds path prefix of instance context with hierarchy divider.
+ * @param inInstContextVec top-bottom sequence of instances
+ * @return path prefix, empty for top-block context
+ */
+std::string StaClientBase::getContextPath(
+						const std::vector<GenericInst*>& inInstContextVec) const {
+	std::string path;
+	for(const GenericInst* instPtr : inInstContextVec) {
+		if(!instPtr)
+			continue;
+
+		path += getName(instPtr);
+		path += mDivider;
+	}
+
+	return path;
+}
+
+
+/**
+ * Adds clock creation constraint.
+ * Returns false if one of source has null pin pointer or creation failed.
+ * @param inName clock name
+ * @param inDescription clock comment
+ * @param inPinPathsVec source pin paths
+ * @param inAddFlag add flag
+ * @param inPeriod clock period
+ * @param inWaveformVec clock waveform
+ * @return operation success
+ */
+bool StaClientBase::createClock(
+		const std::string& inName,
+		const std::string& inDescription,
+		const std::vector<PinContextPath>& inPinPathsVec,
+		bool inAddFlag,
+		float inPeriod,
+		const std::vector<float>& inWaveformVec) {
+	if(!flush())
+		return false;
+
+	CommandCreateClock command;
+	command.mName = inName;
+	command.mDescription = inDescription;
+	command.mAddFlag = inAddFlag;
+	command.mPeriod = inPeriod;
+	command.mWaveformVec = inWaveformVec;
+
+	if(!convertContextNameDataVec(
+			inPinPathsVec, command.mPinPathsVec))
+		return false;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Adds generate clock creation constraint.
+ * Allows null pin for master clock.
+ * Returns false if one of source has null pin pointer or creation failed.
+ * @param inName clock name
+ * @param inDescription clock comment
+ * @param inMasterClockPinPath path to master clock pin
+ * @param inMasterClockName master clock name
+ * @param inPinPathsVec source pin paths
+ * @param inAddFlag add flag
+ * @param inDivideFactor divide_by factor
+ * @param inMultiplyFactor multiply_by factor
+ * @param inDutyCycle duty cycle
+ * @param inInvert inversion flag
+ * @param inEdgesVec vector with edge timings
+ * @param inEdgeShiftsVec vector with shifts in edge timings
+ * @return operations success
+ */
+bool StaClientBase::createGeneratedClock(
+		const std::string& inName,
+		const std::string& inDescription,
+		const PinContextPath& inMasterClockPinPath,
+		const std::string& inMasterClockName,
+		const std::vector<PinContextPath>& inPinPathsVec,
+		bool inAddFlag,
+	    int inDivideFactor,
+		int inMultiplyFactor,
+	    float inDutyCycle,
+	    bool inInvert,
+	    const std::vector<int>& inEdgesVec,
+		const std::vector<float>& inEdgeShiftsVec) {
+	if(!flush())
+		return false;
+
+	CommandCreateGenClock command;
+	command.mName = inName;
+	command.mDescription = inDescription;
+	command.mMasterClockName = inMasterClockName;
+	command.mAddFlag = inAddFlag;
+	command.mDivideFactor = inDivideFactor;
+	command.mMultiplyFactor = inMultiplyFactor;
+	command.mDutyCycle = inDutyCycle;
+	command.mInvert = inInvert;
+	command.mEdgesVec = inEdgesVec;
+	command.mEdgeShiftsVec = inEdgeShiftsVec;
+
+	if(inMasterClockPinPath.mObjectPtr)
+		convertContextObjPath(
+				inMasterClockPinPath, command.mMasterClockPinPath);
+	if(!convertContextNameDataVec(
+			inPinPathsVec, command.mPinPathsVec))
+		return false;
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Creates constraint with clock groups.
+ * @param inName name of groups constraint
+ * @param inDescription constraint description
+ * @param inLogicalExclusive flag of logic exclusivity
+ * @param inPhysicalExclusive flag of physical exclusivity
+ * @param inAsynchronous asynchronous groups flag
+ * @param inAllowPaths allow paths flag
+ * @param inClockGroupsVec vector of clock name groups
+ * @return operations success
+ */
+bool StaClientBase::setClockGroups(
+		const std::string& inName,
+		const std::string& inDescription,
+		bool inLogicalExclusive,
+		bool inPhysicalExclusive,
+		bool inAsynchronous,
+		bool inAllowPaths,
+		const std::vector<std::vector<std::string>>& inClockGroupsVec) {
+	if(!flush())
+		return false;
+
+	CommandSetClockGroups command;
+	command.mName = inName;
+	command.mDescription = inDescription;
+	command.mLogicalExclusive = inLogicalExclusive;
+	command.mPhysicalExclusive = inPhysicalExclusive;
+	command.mAsynchronous = inAsynchronous;
+	command.mAllowPaths = inAllowPaths;
+	command.mClockGroupsVec = inClockGroupsVec;
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Adds constraint with clock source/network latency.
+ * Allows null pin for clock.
+ * @param inSource source latency flag
+ * @param inMin min flag
+ * @param inMax max flag
+ * @param inEarly early (hold) timing flag
+ * @param inLate late (setup) timing flag
+ * @param inRise rise flag
+ * @param inFall fall flag
+ * @param inDelay latency value
+ * @param inClockName target clock name
+ * @param inPinPath target pin path
+ * @return operation success
+ */
+bool StaClientBase::setClockLatency(
+						bool inSource,
+						bool inMin,
+						bool inMax,
+						bool inEarly,
+						bool inLate,
+						bool inRise,
+						bool inFall,
+						float inValue,
+						const std::string& inClockName,
+						const PinContextPath& inPinPath) {
+	if(!flush())
+		return false;
+
+	CommandSetClockLatency command;
+	command.mSource = inSource;
+	command.mMin = inMin;
+	command.mMax = inMax;
+	command.mEarly = inEarly;
+	command.mLate = inLate;
+	command.mRise = inRise;
+	command.mFall = inFall;
+	command.mValue = inValue;
+	command.mClockName = inClockName;
+
+	if(inPinPath.mObjectPtr)
+		convertContextObjPath(
+				inPinPath, command.mPinPath);
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Adds uncertainty constraint between two clocks.
+ * @param inFromClockName name of from-clock
+ * @param inFromRise rise of from-clock
+ * @param inFromRise fall of from-clock
+ * @param inToClockName name of to-clock
+ * @param inToRise rise of to-clock
+ * @param inToFall fall of to-clock
+ * @param inSetup setup time flag
+ * @param inHold hold time flag
+ * @param inValue value to set
+ * @return operations success
+ */
+bool StaClientBase::setClockToClockUncertainty(
+						const std::string& inFromClockName,
+						bool inFromRise,
+						bool inFromFall,
+						const std::string& inToClockName,
+						bool inToRise,
+						bool inToFall,
+						bool inSetup,
+						bool inHold,
+						float inValue) {
+	if(!flush())
+		return false;
+
+	CommandSetInterClockUncertainty command;
+	command.mFromClockName = inFromClockName;
+	command.mFromRise = inFromRise;
+	command.mFromFall = inFromFall;
+	command.mToClockName = inToClockName;
+	command.mToRise = inToRise;
+	command.mToFall = inToFall;
+	command.mSetup = inSetup;
+	command.mHold = inHold;
+	command.mValue = inValue;
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Adds uncertainty constraint of single clock.
+ * @param inClockName clock name
+ * @param inSetup setup time flag
+ * @param inHold hold time flag
+ * @param inValue value to set
+ * @return operations success
+ */
+bool StaClientBase::setClockUncertainty(
+						const std::string& inClockName,
+						bool inSetup,
+						bool inHold,
+						float inValue) {
+	if(!flush())
+		return false;
+
+	CommandSetSingleClockUncertainty command;
+	command.mClockName = inClockName;
+	command.mSetup = inSetup;
+	command.mHold = inHold;
+	command.mValue = inValue;
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Adds clock uncertainty constraint of single pin.
+ * Returns false if pin pointer is null.
+ * @param inPinPath pin path
+ * @param inSetup setup time flag
+ * @param inHold hold time flag
+ * @param inValue value to set
+ * @return operations success
+ */
+bool StaClientBase::setPinUncertainty(
+						const PinContextPath& inPinPath,
+						bool inSetup,
+						bool inHold,
+						float inValue) {
+	if(!flush())
+		return false;
+
+	if(!inPinPath.mObjectPtr)
+		return false;
+
+	CommandSetSinglePinUncertainty command;
+	command.mSetup = inSetup;
+	command.mHold = inHold;
+	command.mValue = inValue;
+
+	convertContextObjPath(inPinPath, command.mPinPath);
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Adds delay of input/output port respective to clock.
+ * Returns false if target pin pointer is null.
+ * Ignores null pin pointer of the clock.
+ * @param inIsInput input direction flag
+ * @param inClockName name of reference clock
+ * @param inClockPinPath name of source pin of ref clock (may be empty)
+ * @param inClockFall flag of falling edge of clock
+ * @param inLevelSensitive level sensivity
+ * @param inDelayRise apply delay for rising edges
+ * @param inDelayFall apply delay for falling edges
+ * @param inDelayMax delay is max delay
+ * @param inDelayMin delay is max delay
+ * @param inAdd add to previous delays
+ * @param inNetworkLatencyInc network delay is included in delay
+ * @param inSourceLatencyInc source delay is included in delay
+ * @param inDelay delay value
+ * @param inTargetPortPin target port
+ * @return operations success
+ */
+bool StaClientBase::setPortDelay(
+						bool inIsInput,
+						const std::string& inClockName,
+						const PinContextPath& inClockPinPath,
+						bool inClockFall,
+						bool inLevelSensitive,
+						bool inDelayRise,
+						bool inDelayFall,
+						bool inDelayMax,
+						bool inDelayMin,
+						bool inAdd,
+						bool inNetworkLatencyInc,
+						bool inSourceLatencyInc,
+						float inDelay,
+						const PinContextPath& inTargetPortPin) {
+	if(!flush())
+		return false;
+
+	if(!inTargetPortPin.mObjectPtr)
+		return false;
+
+	CommandSetPortDelay command;
+	command.mIsInput = inIsInput;
+	command.mClockName = inClockName;
+	command.mClockFall = inClockFall;
+	command.mLevelSensitive = inLevelSensitive;
+	command.mDelayRise = inDelayRise;
+	command.mDelayFall = inDelayFall;
+	command.mDelayMax = inDelayMax;
+	command.mDelayMin = inDelayMin;
+	command.mAdd = inAdd;
+	command.mNetworkLatencyInc = inNetworkLatencyInc;
+	command.mSourceLatencyInc = inSourceLatencyInc;
+	command.mDelay = inDelay;
+
+	convertContextObjPath(
+			inTargetPortPin, command.mTargetPortPin);
+	convertContextObjPath(
+			inClockPinPath, command.mClockPinPath);
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Adds edge transition time of input port's signal.
+ * Returns false if target pin pointer is null.
+ * Transition time is in seconds.
+ * @param inDelayRise apply transition for rising edges
+ * @param inDelayFall apply transition for falling edges
+ * @param inDelayMax delay is max delay
+ * @param inDelayMin delay is max delay
+ * @param inValue transition time value
+ * @param inTargetPortPin target port
+ * @return operations success
+ */
+bool StaClientBase::setInputTransition(
+						bool inDelayRise,
+						bool inDelayFall,
+						bool inDelayMax,
+						bool inDelayMin,
+						float inValue,
+						const PinContextPath& inTargetPortPin) {
+	if(!flush())
+		return false;
+
+	if(!inTargetPortPin.mObjectPtr)
+		return false;
+
+	CommandSetInPortTransition command;
+	command.mDelayRise = inDelayRise;
+	command.mDelayFall = inDelayFall;
+	command.mDelayMax = inDelayMax;
+	command.mDelayMin = inDelayMin;
+	command.mValue = inValue;
+
+	convertContextObjPath(
+			inTargetPortPin, command.mTargetPortPin);
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Sets pin load capacitance for port.
+ * Returns false if target pin pointer is null.
+ * Transition time is in seconds.
+ * @param inRise apply load for rising edges
+ * @param inFall apply load  for falling edges
+ * @param inMax load for max delay
+ * @param inMin load for max delay
+ * @param inCap capacitance value
+ * @param inTargetPortPin target port
+ * @return operations success
+ */
+bool StaClientBase::setPortPinLoad(
+						bool inRise,
+						bool inFall,
+						bool inMax,
+						bool inMin,
+						float inCap,
+						const PinContextPath& inTargetPortPin) {
+	if(!flush())
+		return false;
+
+	if(!inTargetPortPin.mObjectPtr)
+		return false;
+
+	CommandSetPortPinLoad command;
+	command.mRise = inRise;
+	command.mFall = inFall;
+	command.mMax = inMax;
+	command.mMin = inMin;
+	command.mCap = inCap;
+
+	convertContextObjPath(
+			inTargetPortPin, command.mTargetPortPin);
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Adds paths to exclude from timing analysis.
+ * @param inSetup apply for setup constraints
+ * @param inHold apply for hold constraints
+ * @param inComment constraint description
+ * @param inFromRise rising edge flag of start points
+ * @param inFromFall falling edge flag of start points
+ * @param inFromPinPathsVec start point pin paths
+ * @param inFromClocksVec start point clock names
+ * @param inFromInstPathsVec start point inst paths
+ * @param inThroughRise rising edge flag of middle points
+ * @param inThroughFall falling edge flag of middle points
+ * @param inThroughPinPathsVec middle point pin paths
+ * @param inThroughInstPathsVec middle point inst paths
+ * @param inThroughNetPathsVec start point net paths
+ * @param inToRise rising edge flag of end points
+ * @param inToFall falling edge flag of end points
+ * @param inToPinPathsVec end point pin paths
+ * @param inToClocksVec  end point clock names
+ * @param inToInstPathsVec middle point inst paths
+ * @param inRise end point rise transition
+ * @param inFall end point fall transition
+ * @return operation success
+ */
+bool StaClientBase::setFalsePath(
+						bool inSetup,
+						bool inHold,
+						const std::string& inComment,
+						bool inFromRise,
+						bool inFromFall,
+						const std::vector<PinContextPath>& inFromPinPathsVec,
+						const std::vector<std::string>& inFromClocksVec,
+						const std::vector<InstContextPath>& inFromInstPathsVec,
+						bool inThroughRise,
+						bool inThroughFall,
+						const std::vector<PinContextPath>& inThroughPinPathsVec,
+						const std::vector<InstContextPath>& inThroughInstPathsVec,
+						const std::vector<NetContextPath>& inThroughNetPathsVec,
+						bool inToRise,
+						bool inToFall,
+						const std::vector<PinContextPath>& inToPinPathsVec,
+						const std::vector<std::string>& inToClocksVec,
+						const std::vector<InstContextPath>& inToInstPathsVec,
+						bool inRise,
+						bool inFall) {
+	if(!flush())
+		return false;
+
+	CommandSetFalsePath command;
+	command.mSetup = inSetup;
+	command.mHold = inHold;
+	command.mComment = inComment;
+
+	fillPathMesgData(
+			inFromRise, inFromFall, inFromPinPathsVec, inFromClocksVec, inFromInstPathsVec,
+			inThroughRise, inThroughFall, inThroughPinPathsVec, inThroughInstPathsVec, inThroughNetPathsVec,
+			inToRise, inToFall, inToPinPathsVec, inToClocksVec, inToInstPathsVec, inRise, inFall,
+			command);
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Sets min/max delay constraint for specified paths.
+ * @param inMinDelayFlag flag to add min_delay constraint
+ * @param inValue delay value
+ * @param inComment constraint description
+ * @param inFromRise rising edge flag of start points
+ * @param inFromFall falling edge flag of start points
+ * @param inFromPinPathsVec start point pin paths
+ * @param inFromClocksVec start point clock names
+ * @param inFromInstPathsVec start point inst paths
+ * @param inThroughRise rising edge flag of middle points
+ * @param inThroughFall falling edge flag of middle points
+ * @param inThroughPinPathsVec middle point pin paths
+ * @param inThroughInstPathsVec middle point inst paths
+ * @param inThroughNetPathsVec start point net paths
+ * @param inToRise rising edge flag of end points
+ * @param inToFall falling edge flag of end points
+ * @param inToPinPathsVec end point pin paths
+ * @param inToClocksVec  end point clock names
+ * @param inToInstPathsVec middle point inst paths
+ * @param inRise end point rise transition
+ * @param inFall end point fall transition
+ * @return operation success
+ */
+bool StaClientBase::setMinMaxDelay(
+							bool inMinDelayFlag,
+							float inValue,
+							const std::string& inComment,
+							bool inFromRise,
+							bool inFromFall,
+							const std::vector<PinContextPath>& inFromPinPathsVec,
+							const std::vector<std::string>& inFromClocksVec,
+							const std::vector<InstContextPath>& inFromInstPathsVec,
+							bool inThroughRise,
+							bool inThroughFall,
+							const std::vector<PinContextPath>& inThroughPinPathsVec,
+							const std::vector<InstContextPath>& inThroughInstPathsVec,
+							const std::vector<NetContextPath>& inThroughNetPathsVec,
+							bool inToRise,
+							bool inToFall,
+							const std::vector<PinContextPath>& inToPinPathsVec,
+							const std::vector<std::string>& inToClocksVec,
+							const std::vector<InstContextPath>& inToInstPathsVec,
+							bool inRise,
+							bool inFall) {
+	if(!flush())
+		return false;
+
+	CommandSetMinMaxDelay command;
+	command.mMinDelayFlag = inMinDelayFlag;
+	command.mValue = inValue;
+	command.mComment = inComment;
+
+	fillPathMesgData(
+			inFromRise, inFromFall, inFromPinPathsVec, inFromClocksVec, inFromInstPathsVec,
+			inThroughRise, inThroughFall, inThroughPinPathsVec, inThroughInstPathsVec, inThroughNetPathsVec,
+			inToRise, inToFall, inToPinPathsVec, inToClocksVec, inToInstPathsVec, inRise, inFall,
+			command);
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Sets multicycle clock constraint for specified paths.
+ * @param inSetup apply for setup constraints
+ * @param inHold apply for hold constraints
+ * @param inStart apply multiplier to start clock
+ * @param inEnd apply multiplier to end clock
+ * @param inValue multiplier
+ * @param inComment constraint description
+ * @param inFromRise rising edge flag of start points
+ * @param inFromFall falling edge flag of start points
+ * @param inFromPinPathsVec start point pin paths
+ * @param inFromClocksVec start point clock names
+ * @param inFromInstPathsVec start point inst paths
+ * @param inThroughRise rising edge flag of middle points
+ * @param inThroughFall falling edge flag of middle points
+ * @param inThroughPinPathsVec middle point pin paths
+ * @param inThroughInstPathsVec middle point inst paths
+ * @param inThroughNetPathsVec start point net paths
+ * @param inToRise rising edge flag of end points
+ * @param inToFall falling edge flag of end points
+ * @param inToPinPathsVec end point pin paths
+ * @param inToClocksVec  end point clock names
+ * @param inToInstPathsVec middle point inst paths
+ * @param inRise end point rise transition
+ * @param inFall end point fall transition
+ * @return operation success
+ */
+bool StaClientBase::setMulticyclePath(
+						bool inSetup,
+						bool inHold,
+						bool inStart,
+						bool inEnd,
+						int inValue,
+						const std::string& inComment,
+						bool inFromRise,
+						bool inFromFall,
+						const std::vector<PinContextPath>& inFromPinPathsVec,
+						const std::vector<std::string>& inFromClocksVec,
+						const std::vector<InstContextPath>& inFromInstPathsVec,
+						bool inThroughRise,
+						bool inThroughFall,
+						const std::vector<PinContextPath>& inThroughPinPathsVec,
+						const std::vector<InstContextPath>& inThroughInstPathsVec,
+						const std::vector<NetContextPath>& inThroughNetPathsVec,
+						bool inToRise,
+						bool inToFall,
+						const std::vector<PinContextPath>& inToPinPathsVec,
+						const std::vector<std::string>& inToClocksVec,
+						const std::vector<InstContextPath>& inToInstPathsVec,
+						bool inRise,
+						bool inFall) {
+	if(!flush())
+		return false;
+
+	CommandSetMulticyclePath command;
+	command.mSetup = inSetup;
+	command.mHold = inHold;
+	command.mStart = inStart;
+	command.mEnd = inEnd;
+	command.mValue = inValue;
+	command.mComment = inComment;
+
+	fillPathMesgData(
+			inFromRise, inFromFall, inFromPinPathsVec, inFromClocksVec, inFromInstPathsVec,
+			inThroughRise, inThroughFall, inThroughPinPathsVec, inThroughInstPathsVec, inThroughNetPathsVec,
+			inToRise, inToFall, inToPinPathsVec, inToClocksVec, inToInstPathsVec, inRise, inFall,
+			command);
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Adds constraint to disable timing arcs of portref.
+ * Returns false if pin pointer is null.
+ * @param inPinPath target pin path
+ * @return operation success
+ */
+bool StaClientBase::setDisablePinTiming(
+						const PinContextPath& inPinPath) {
+	if(!flush())
+		return false;
+
+	if(!inPinPath.mObjectPtr)
+		return false;
+
+	CommandDisableSinglePinTiming command;
+	convertContextObjPath(inPinPath, command.mPinPath);
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Adds constraint to disable timing arcs of instance.
+ * Returns false if one of pins is null.
+ * @param inFromPinName path of from-pin
+ * @param inToPinName path of to-pin
+ * @return operation success
+ */
+bool StaClientBase::setDisableInstTiming(
+						const std::vector<const GenericInst*>& mInstContextVec,
+						const GenericPin* inFromPinPtr,
+						const GenericPin* inToPinPtr) {
+	if(!flush())
+		return false;
+
+	CommandDisableInstTiming command;
+	for(const GenericInst* instPtr : mInstContextVec)
+		command.mInstContextVec.push_back(getName(instPtr));
+
+	command.mFromPinName = getName(inFromPinPtr);
+	command.mToPinName = getName(inToPinPtr);
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Adds global derate factor.
+ * @param inCellDelay derate cell delays
+ * @param inCellCheck derate cell check margins
+ * @param inNetDelay derate interconnets
+ * @param inData derate data paths
+ * @param inClock derate clock paths
+ * @param inEarly derate min delays
+ * @param inLate derate max delays
+ * @param inRise derate max transitions
+ * @param inFall derate fall transitions
+ * @param inValue derate factor
+ * @return operations success
+ */
+bool StaClientBase::setGlobalTimingDerate(
+						bool inCellDelay,
+						bool inCellCheck,
+						bool inNetDelay,
+						bool inData,
+						bool inClock,
+						bool inEarly,
+						bool inLate,
+						bool inRise,
+						bool inFall,
+						float inValue) {
+	if(!flush())
+		return false;
+
+	CommandSetGlobalTimingDerate command;
+	command.mCellDelay = inCellDelay;
+	command.mCellCheck = inCellCheck;
+	command.mNetDelay = inNetDelay;
+	command.mData = inData;
+	command.mClock = inClock;
+	command.mEarly = inEarly;
+	command.mLate = inLate;
+	command.mRise = inRise;
+	command.mFall = inFall;
+	command.mValue = inValue;
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Sends command to read SPEF file.
+ * @param inFileName file name
+ * @return success status
+ */
+bool StaClientBase::readSPEFFile(
+		const std::string& inFileName) {
+	if(!flush())
+		return false;
+
+	CommandReadSpefFile command;
+	command.mStr = inFileName;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Sends command to read SPEF stream.
+ * Text isn't sent if STA has stored it before.
+ * @param inDataStream data stream
+ * @return success status
+ */
+bool StaClientBase::readSPEFStream(
+		std::istream& inDataStream) {
+	if(!flush())
+		return false;
+
+	uint64_t bytesNum = 0;
+	if(getSharedStreamSize(inDataStream, bytesNum))
+		return mProtocol.executeSharedStream(
+				CommandReadSpefStream::cMesgType, inDataStream, bytesNum);
+
+	CommandReadSpefStream command;
+	command.mStr = std::string(
+			std::istreambuf_iterator<char>(inDataStream), {});
+
+	return mProtocol.executeStoredStream(command, hashContent(command.mStr));
+}
+
+/**
+ * Sets lumped capacity for several nets in specific hierarchical context.
+ * Capacitance value must be in farads.
+ * @param inNetsDataVec nets and their context
+ * @param inNetCapsVec capacitance values
+ * @return success status
+ */
+bool StaClientBase::setNetsLumpCap(
+		const std::vector<NetContextPath>& inNetsDataVec,
+		const std::vector<float>& inNetCapsVec) {
+	if(inNetsDataVec.empty())
+		return true;
+
+	//keeping the last cap of each net until timing is queried
+	if(mWriteBack) {
+		std::unique_lock<std::mutex> lock(mWriteBackMutex);
+		for(size_t i = 0; i < inNetsDataVec.size() && i < inNetCapsVec.size(); i++) {
+			if(!inNetsDataVec[i].mObjectPtr)
+				continue;
+
+			mWriteBackNetCapsMap[NetContextKey(
+					inNetsDataVec[i].mInstContextVec,
+					inNetsDataVec[i].mObjectPtr)] = inNetCapsVec[i];
+		}
+
+		lock.unlock();
+		clearTimingMapping();
+		return true;
+	}
+
+	CommandSetGroupNetCap& command =
+			mProtocol.acquireCommand<CommandSetGroupNetCap>();
+
+	//adding info of each net
+	size_t usedNum = 0;
+	for(size_t i = 0; i < inNetsDataVec.size() && i < inNetCapsVec.size(); i++) {
+		//skipping unexistent nets
+		if(!inNetsDataVec[i].mObjectPtr)
+			continue;
+
+		fillNetNameData(
+				inNetsDataVec[i].mInstContextVec,
+				inNetsDataVec[i].mObjectPtr,
+				nextPooledElement(command.mNetAddrsVec, usedNum));
+
+		command.mValuesVec.push_back(inNetCapsVec[i]);
+	}
+	trimPooledElements(command.mNetAddrsVec, usedNum);
+
+	//making timing data invalid if wire load has changed
+	clearTimingMapping();
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Sends command to read SDF file.
+ * @param inFileName file name
+ * @return success status
+ */
+bool StaClientBase::readSdfFile(
+		const std::string& inFileName) {
+	if(!flush())
+		return false;
+
+	CommandReadSdfFile command;
+	command.mStr = inFileName;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Sends command to read SDF stream.
+ * Text isn't sent if STA has stored it before.
+ * @param inDataStream data stream
+ * @return success status
+ */
+bool StaClientBase::readSdfStream(
+		std::istream& inDataStream) {
+	if(!flush())
+		return false;
+
+	uint64_t bytesNum = 0;
+	if(getSharedStreamSize(inDataStream, bytesNum))
+		return mProtocol.executeSharedStream(
+				CommandReadSdfStream::cMesgType, inDataStream, bytesNum);
+
+	CommandReadSdfStream command;
+	command.mStr = std::string(
+			std::istreambuf_iterator<char>(inDataStream), {});
+
+	return mProtocol.executeStoredStream(command, hashContent(command.mStr));
+}
+
+/**
+ * Sends command to write SDF file.
+ * @param inFileName file name
+ * @return success status
+ */
+bool StaClientBase::writeSdfFile(
+		const std::string& inFileName) {
+	if(!flush())
+		return false;
+
+	CommandWriteSdfFile command;
+	command.mStr = inFileName;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Sends command to save checkpoint.
+ * @param inPathPrefix path prefix of checkpoint files
+ * @return success status
+ */
+bool StaClientBase::saveCheckpoint(
+		const std::string& inPathPrefix) {
+	if(!flush())
+		return false;
+
+	CommandSaveCheckpoint command;
+	command.mStr = inPathPrefix;
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Sends command to load checkpoint.
+ * Clears graph mapping, because netlist in STA is replaced.
+ * @param inPathPrefix path prefix of checkpoint files
+ * @return success status
+ */
+bool StaClientBase::loadCheckpoint(
+		const std::string& inPathPrefix) {
+	if(!flush())
+		return false;
+
+	CommandLoadCheckpoint command;
+	command.mStr = inPathPrefix;
+
+	clearGraphMapping();
+	clearPendingNetlistEdits();
+	return mProtocol.execute(command);
+}
+
+/**
+ * Opens journal file to record commands that change STA state.
+ * @param inFileName journal file name
+ * @return success status
+ */
+bool StaClientBase::openCommandJournal(
+		const std::string& inFileName) {
+	if(!mProtocol.openJournal(inFileName)) {
+		printError("failed to open command journal " + inFileName);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Stops recording of commands in journal file.
+ * Pending updates of write-back mode are sent and recorded before.
+ */
+void StaClientBase::closeCommandJournal() {
+	flush();
+	mProtocol.closeJournal();
+}
+
+/**
+ * Sends recorded commands to STA engine in batches of whole commands.
+ * Failed batch leaves STA engine partly restored by earlier batches.
+ * Clears graph mapping, because timing graph in STA is rebuilt.
+ * @return success status
+ */
+bool StaClientBase::replayCommandJournal() {
+	if(!flush())
+		return false;
+
+	clearGraphMapping();
+	clearPendingNetlistEdits();
+	return mProtocol.replayJournal();
+}
+
+/**
+ * Method to get mappings of nodes and edges of timing graph from STA engine.
+ * First gets graph data, then maps netlist objects by their paths.
+ * In the end matches netlist object to graph IDs.
+ * Returns false if block pointer is null or fails to get data.
+ * Clears all previously stored mappings through the callback mechanism.
+ * @param inBlockPtr top block
+ * @return success status
+ */
+bool StaClientBase::loadNetlistGraph(
+		const GenericBlock* inBlockPtr) {
+	if(!inBlockPtr)
+		return false;
+
+	if(!flush())
+		return false;
+
+	//remapping the received graph data to pins with callback mechanism
+	std::vector<VertexIdData> vertexIdToDataVec;
+	std::vector<EdgeIdData> edgeIdToDataVec;
+	CommandGetGraphData command;
+
+	if(!mProtocol.execute(
+			command, vertexIdToDataVec, edgeIdToDataVec))
+		return false;
+
+	clearGraphMapping();
+	mHasGraph = addGraphMapping(inBlockPtr,
+			vertexIdToDataVec, edgeIdToDataVec);
+	return mHasGraph;
+}
+
+/**
+ * Saves current graph mapping in snapshot file.
+ * Vertexes are stored with pin paths, edges with vertex IDs.
+ * Snapshot is stamped with design hash and graph fingerprint from STA engine,
+ * so it's attached only to the same graph.
+ * Returns false if graph isn't loaded or fails to get fingerprint or write file.
+ * @param inFileName snapshot file name
+ * @param inDesignHash hash of the design
+ * @return success status
+ */
+bool StaClientBase::saveGraphSnapshot(
+		const std::string& inFileName,
+		uint64_t inDesignHash) {
+	if(!mHasGraph)
+		return false;
+
+	CommandGetGraphFingerprint command;
+	GraphFingerprintData fingerprint;
+	if(!mProtocol.execute(command, fingerprint))
+		return false;
+
+	std::unordered_map<const GenericPin*, const std::string*> pinToPathUMap;
+	pinToPathUMap.reserve(mPathToPinUMap.size());
+	for(const auto& pathPin : mPathToPinUMap)
+		pinToPathUMap.emplace(pathPin.second, &pathPin.first);
+
+	std::vector<GraphSnapshotVertex> verticesVec;
+	std::string pathsPool;
+	for(uint32_t vertexId = 0; vertexId < mVertexIdToPinVec.size(); vertexId++) {
+		const GenericPin* pinPtr = mVertexIdToPinVec[vertexId];
+		if(!pinPtr)
+			continue;
+
+		auto pathIt = pinToPathUMap.find(pinPtr);
+		if(pathIt == pinToPathUMap.end())
+			return false;
+
+		auto sourceIt = mSourcePinToVertexIdUMap.find(pinPtr);
+
+		GraphSnapshotVertex vertex{};
+		vertex.mVertexId = vertexId;
+		vertex.mIsDriver = sourceIt != mSourcePinToVertexIdUMap.end() &&
+				sourceIt->second == vertexId;
+		vertex.mPathOffset = pathsPool.size();
+		vertex.mPathBytes = pathIt->second->size();
+		pathsPool += *pathIt->second;
+		verticesVec.push_back(vertex);
+	}
+
+	std::vector<GraphSnapshotEdge> edgesVec;
+	for(uint32_t edgeId = 0; edgeId < mEdgeIdToVertexIdsVec.size(); edgeId++) {
+		const VertexIdPair& vertexIds = mEdgeIdToVertexIdsVec[edgeId];
+		if(vertexIds.first == cNoGraphId)
+			continue;
+
+		edgesVec.push_back({edgeId, vertexIds.first, vertexIds.second});
+	}
+
+	GraphSnapshotHeader header{};
+	header.mDivider = mDivider;
+	header.mDesignHash = inDesignHash;
+	header.mGraphGeneration = fingerprint.mGraphGeneration;
+	header.mGraphHash = fingerprint.mGraphHash;
+	header.mVerticesNum = verticesVec.size();
+	header.mEdgesNum = edgesVec.size();
+	header.mPathsBytes = pathsPool.size();
+
+	return GraphMappingSnapshot::write(
+			inFileName, header, verticesVec, edgesVec, pathsPool);
+}
+
+/**
+ * Restores graph mapping from snapshot file instead of loading graph.
+ * Snapshot must have the same design hash, hierarchy divider
+ * and graph fingerprint as STA engine reports now.
+ * Finds pins of vertices by their paths visiting only instances on the paths,
+ * then copies records of the mapped file in the mapping, file isn't kept mapped.
+ * Falls back to mapping paths of all pins if some path isn't found this way.
+ * Path mapping keeps only vertex pins until it's needed complete.
+ * Returns false and leaves graph unloaded if snapshot doesn't match.
+ * @param inBlockPtr top block
+ * @param inFileName snapshot file name
+ * @param inDesignHash hash of the design
+ * @return success status
+ */
+bool StaClientBase::attachGraphSnapshot(
+		const GenericBlock* inBlockPtr,
+		const std::string& inFileName,
+		uint64_t inDesignHash) {
+	if(!inBlockPtr)
+		return false;
+
+	if(!flush())
+		return false;
+
+	clearGraphMapping();
+
+	GraphMappingSnapshot snapshot;
+	if(!snapshot.open(inFileName))
+		return false;
+
+	CommandGetGraphFingerprint command;
+	GraphFingerprintData fingerprint;
+	if(!mProtocol.execute(command, fingerprint))
+		return false;
+
+	const GraphSnapshotHeader& header = snapshot.getHeader();
+	if(header.mDesignHash != inDesignHash ||
+			header.mDivider != uint32_t(mDivider) ||
+			header.mGraphGeneration != fingerprint.mGraphGeneration ||
+			header.mGraphHash != fingerprint.mGraphHash ||
+			header.mVerticesNum != fingerprint.mVerticesNum ||
+			header.mEdgesNum != fingerprint.mEdgesNum)
+		return false;
+
+	PinPathLookup lookup;
+	const GraphSnapshotVertex* verticesPtr = snapshot.getVertices();
+	for(uint32_t vertexIdx = 0; vertexIdx < header.mVerticesNum; vertexIdx++) {
+		const GraphSnapshotVertex& vertex = verticesPtr[vertexIdx];
+
+		std::string_view path = snapshot.getPath(vertex);
+		GenericPin* pinPtr = nullptr;
+		if(mPathToPinUMap.empty())
+			pinPtr = findPinByPath(inBlockPtr, path, lookup);
+
+		//names with dividers inside are found only in complete mapping
+		if(!pinPtr) {
+			if(mPathToPinUMap.empty() && !fillPathToPinMap(inBlockPtr)) {
+				clearGraphMapping();
+				return false;
+			}
+
+			auto pinIt = mPathToPinUMap.find(std::string(path));
+			if(pinIt != mPathToPinUMap.end())
+				pinPtr = pinIt->second;
+		}
+
+		if(!pinPtr) {
+			clearGraphMapping();
+			return false;
+		}
+
+		if(vertex.mVertexId >= mVertexIdToPinVec.size())
+			mVertexIdToPinVec.resize(vertex.mVertexId + 1, nullptr);
+		mVertexIdToPinVec[vertex.mVertexId] = pinPtr;
+
+		if(vertex.mIsDriver)
+			mSourcePinToVertexIdUMap.emplace(pinPtr, vertex.mVertexId);
+		else
+			mSinkPinToVertexIdUMap.emplace(pinPtr, vertex.mVertexId);
+	}
+
+	//paths of vertex pins are enough until netlist is edited
+	if(mPathToPinUMap.empty()) {
+		for(uint32_t vertexIdx = 0; vertexIdx < header.mVerticesNum; vertexIdx++) {
+			const GraphSnapshotVertex& vertex = verticesPtr[vertexIdx];
+			mPathToPinUMap.emplace(
+					snapshot.getPath(vertex),
+					mVertexIdToPinVec[vertex.mVertexId]);
+		}
+		mPartialPathsBlockPtr = inBlockPtr;
+	}
+
+	const GraphSnapshotEdge* edgesPtr = snapshot.getEdges();
+	for(uint32_t edgeIdx = 0; edgeIdx < header.mEdgesNum; edgeIdx++) {
+		const GraphSnapshotEdge& edge = edgesPtr[edgeIdx];
+		if(edge.mFromVertexId >= mVertexIdToPinVec.size() ||
+				edge.mToVertexId >= mVertexIdToPinVec.size() ||
+				!mVertexIdToPinVec[edge.mFromVertexId] ||
+				!mVertexIdToPinVec[edge.mToVertexId]) {
+			clearGraphMapping();
+			return false;
+		}
+
+		mPinPairToEdgeIdUMap.emplace(
+				PinsPair(
+					mVertexIdToPinVec[edge.mFromVertexId],
+					mVertexIdToPinVec[edge.mToVertexId]),
+				edge.mEdgeId);
+		setEdgeVertexIds({edge.mFromVertexId, edge.mToVertexId, edge.mEdgeId});
+	}
+
+	mHasGraph = true;
+	return true;
+}
+
+/**
+ * Method to get pin slacks from STA engine.
+ * Gets only criticality factors if server computes them.
+ * Timing is loaded in the back buffer, that becomes readable on success.
+ * Timing stays stale if STA state was changed during the load.
+ * Failed load drops timing, unless stale timing is kept by lazy invalidation.
+ * Does nothing and returns false if timing graph wasn't loaded.
+ * @return success status
+ */
+bool StaClientBase::loadNetlistSlacks() {
+	if(!mHasGraph)
+		return false;
+
+	//changes after this point may be not flushed, so they keep timing stale
+	uint64_t staleNum = mTimingStaleNum.load();
+	if(!flush())
+		return false;
+
+	NodeTimingBuffer& timing = getBackTiming();
+	bool ok = false;
+
+	if(mServerCritFactorBits) {
+		CommandGetCritFactors factorsCommand;
+		CritFactorsData factors;
+		factorsCommand.mFactorBits = mServerCritFactorBits;
+
+		timing.mNodeTimingDataVec.clear();
+		ok = mProtocol.execute(factorsCommand, factors) &&
+			dequantizeCritFactors(
+				factors, timing.mNodeMinCritFactorsVec, timing.mNodeMaxCritFactorsVec);
+		if(ok)
+			swapTimingBuffers(staleNum);
+		else if(!mLazyTimingInvalidation)
+			dropTimingBuffers();
+		return ok;
+	}
+
+	timing.mNodeTimingDataVec.clear();
+	if(mPackedSlacks) {
+		CommandGetPackedGraphSlacks command;
+		ok = mProtocol.execute(command, timing.mNodeTimingDataVec);
+	} else {
+		CommandGetGraphSlacksData command;
+		ok = mProtocol.execute(command, timing.mNodeTimingDataVec);
+	}
+
+//	for(auto& data: timing.mNodeTimingDataVec) {
+//		std::cout << "Node " << data.mNodeId << ": "
+//				<< " mHasTiming =" << data.mHasTiming
+//				<< " mMaxWorstSlackAat =" << data.mMaxWorstSlackAat
+//				<< " mMaxWorstSlackRat =" << data.mMaxWorstSlackRat
+//				<< " mMinWorstSlackAat =" << data.mMinWorstSlackAat
+//				<< " mMinWorstSlackRat =" << data.mMinWorstSlackRat
+//				<< std::endl;
+//	}
+
+
+	//must be virtual to modify it in subclasses
+	if(ok) {
+		std::vector<float> clockMinWorstRatVec;
+		std::vector<float> clockMaxWorstRatVec;
+		std::vector<float> clockMinWorstSlackVec;
+		std::vector<float> clockMaxWorstSlackVec;
+
+		ok = collectClockShifts(timing.mNodeTimingDataVec,
+					clockMinWorstRatVec, clockMaxWorstRatVec,
+					clockMinWorstSlackVec, clockMaxWorstSlackVec) &&
+			calcNodeCritFactors(
+				timing.mNodeTimingDataVec, timing.mNodeMinCritFactorsVec,
+				clockMinWorstRatVec, clockMinWorstSlackVec, true) &&
+			calcNodeCritFactors(
+				timing.mNodeTimingDataVec, timing.mNodeMaxCritFactorsVec,
+				clockMaxWorstRatVec, clockMaxWorstSlackVec, false);
+	}
+
+	if(ok)
+		swapTimingBuffers(staleNum);
+	else if(!mLazyTimingInvalidation)
+		dropTimingBuffers();
+
+	return ok;
+}
+
+/**
+ * Calculates timing criticalness factor on group's and node's data.
+ * @param inData timing data of target node
+ * @param inGroupMinSlack min slack of constraint group
+ * @param inGroupMaxSlack max slack of constraint group
+ * @param inGroupMaxRat max RAT of group's endpoint
+ * @param inMinConstraint flag of min-constraint
+ * @return criticality factor
+ */
+float StaClientBase::calcCritFactor(
+						const NodeTimingData& inData,
+						float inGroupMinSlack,
+						float inGroupMaxSlack,
+						float inGroupMaxRat,
+						bool inMinConstraint) {
+
+	float shiftAdd = inGroupMinSlack;
+
+	//flipping the minimum slack to use it as a shifter of the paths group
+	if(shiftAdd >= 0) {
+		shiftAdd = 0;
+	} else {
+		shiftAdd *= -1;
+	}
+
+	//if max slack(with shift) exceeds divider, then use it instead
+	inGroupMaxRat += shiftAdd;
+	if(inGroupMaxSlack + shiftAdd > inGroupMaxRat)
+		inGroupMaxRat = inGroupMaxSlack + shiftAdd;
+
+	//zero, you shall not pass!
+	if(inGroupMaxRat == 0)
+		inGroupMaxRat += 1;
+
+	//then finally calculating the node critical factor
+	float nodeSlack = getNodeDataSlack(inData, inMinConstraint);
+	return 1 - ( (nodeSlack + shiftAdd) / inGroupMaxRat );
+}
+
+float StaClientBase::getNodeDataSlack(
+		const NodeTimingData& inData,
+		bool inMinConstraint) {
+	return getNodeTimingSlack(inData, inMinConstraint);
+}
+
+
+/**
+ * Fills worst min/max RATs and slacks for clocks mentioned in node timings.
+ * Resizes output vectors depending on clock index.
+ * @param inNodeTimingData nodes timing data
+ * @param outClockMinWorstRatVec worst min RATs for clocks
+ * @param outClockMaxWorstRatVec worst max RATs for clocks
+ * @param outClockMaxWorstRatVec worst min slacks for clocks
+ * @param outClockMaxWorstRatVec worst max slacks for clocks
+ * @return success flag
+ */
+bool StaClientBase::collectClockShifts(
+						const std::vector<NodeTimingData>& inNodeTimingData,
+						std::vector<float>& outClockMinWorstRatVec,
+						std::vector<float>& outClockMaxWorstRatVec,
+						std::vector<float>& outClockMinWorstSlackVec,
+						std::vector<float>& outClockMaxWorstSlackVec) {
+	return collectClockWorstTimings(inNodeTimingData,
+			outClockMinWorstRatVec, outClockMaxWorstRatVec,
+			outClockMinWorstSlackVec, outClockMaxWorstSlackVec);
+}
+
+
+/**
+ * Calculates criticalness factors for all nodes based on their timing data.
+ * Skips nodes that lack constrained path endpoints (i.e. unconstrained directly).
+ * @param inNodeTimingData nodes timing data
+ * @param outNodeCritFactorsVec nodes criticalness factors to set
+ * @param inWorstRatPerClockVec worst RATs for clocks
+ * @param inWorstSlackPerClockVec worst slacks for clocks
+ * @param inMinConstraint min-constraint flag
+ * @return success flag
+ */
+bool StaClientBase::calcNodeCritFactors(
+						const std::vector<NodeTimingData>& inNodeTimingData,
+						std::vector<float>& outNodeCritFactorsVec,
+						const std::vector<float>& inWorstRatPerClockVec,
+						const std::vector<float>& inWorstSlackPerClockVec,
+						bool inMinConstraint) {
+	return calcNodeTimingCritFactors(inNodeTimingData, outNodeCritFactorsVec,
+			inWorstRatPerClockVec, inWorstSlackPerClockVec, inMinConstraint);
+}
+
+
+/**
+ * Returns critical factor of node of the sink pin.
+ * Does nothing and returns false if fails to find edge/node in the graph.
+ * Does nothing and returns false if timing/graph data wasn't initialized.
+ * Writes out zero if node index is out of bounds.
+ * @param inSourcePinPtr beginning pin of the edge
+ * @param inSinkPinPtr ending pin of the edge
+ * @param inMinConstraint flag to get min-constraint factor
+ * @param outCritFactor factor to set
+ * @return success flag
+ */
+bool StaClientBase::getArcCritFactor(
+						const GenericPin* inSourcePinPtr,
+						const GenericPin* inSinkPinPtr,
+						bool inMinConstraint,
+						float& outCritFactor) {
+	if(!mHasGraph || !mHasGraphTiming)
+		return false;
+
+	auto sourceIt = mSourcePinToVertexIdUMap.find(inSourcePinPtr);
+	auto sinkIt = mSourcePinToVertexIdUMap.find(inSourcePinPtr);
+	if(sourceIt == mSourcePinToVertexIdUMap.end() ||
+			sinkIt == mSourcePinToVertexIdUMap.end())
+		return false;
+
+	auto edgeIt = mPinPairToEdgeIdUMap.find(
+			std::make_pair(inSourcePinPtr, inSinkPinPtr));
+	if(edgeIt == mPinPairToEdgeIdUMap.end())
+		return false;
+
+	uint32_t nodeId = std::numeric_limits<uint32_t>::max();
+	auto it = mSourcePinToVertexIdUMap.begin();
+
+	//if it is intra-instance, then search sink first in sources, then in sinks
+	if(getParentInstance(inSourcePinPtr) == getParentInstance(inSinkPinPtr)) {
+		it = mSourcePinToVertexIdUMap.find(inSinkPinPtr);
+		if(it != mSourcePinToVertexIdUMap.end()) {
+			nodeId = it->second;
+		} else {
+			it = mSinkPinToVertexIdUMap.find(inSinkPinPtr);
+			if(it != mSinkPinToVertexIdUMap.end())
+				nodeId = it->second;
+		}
+	} else {
+		//for inter-instance search in reverse order
+		it = mSinkPinToVertexIdUMap.find(inSinkPinPtr);
+		if(it != mSinkPinToVertexIdUMap.end()) {
+			nodeId = it->second;
+		} else {
+			it = mSourcePinToVertexIdUMap.find(inSinkPinPtr);
+			if(it != mSourcePinToVertexIdUMap.end())
+				nodeId = it->second;
+		}
+	}
+
+	FrontTimingReader reader(*this);
+	if(!reader.getTiming())
+		return false;
+	const NodeTimingBuffer& timing = *reader.getTiming();
+
+	//nothing to do if failed to find node ID
+	if(nodeId >= timing.mNodeMinCritFactorsVec.size() ||
+			nodeId >= timing.mNodeMaxCritFactorsVec.size())
+		return false;
+
+	if(inMinConstraint)
+		outCritFactor = timing.mNodeMinCritFactorsVec[nodeId];
+	else
+		outCritFactor = timing.mNodeMaxCritFactorsVec[nodeId];
+
+	return true;
+}
+
+
+/**
+ * Sends command to set inter-pin delay in top-module context.
+ * @param inSourcePinPtr source pin pointer
+ * @param inSinkPinPtr sink pin pointer
+ * @param inMin apply as min delay
+ * @param inMax apply as max delay
+ * @param inValue delay value
+ */
+bool StaClientBase::setInterPinArcDelay(
+		const GenericPin* inSourcePinPtr,
+		const GenericPin* inSinkPinPtr,
+		bool inMin,
+		bool inMax,
+		float inValue) {
+	if(!inSourcePinPtr || !inSinkPinPtr)
+		return false;
+
+	//making timing data invalid if arc delay changed
+	clearTimingMapping();
+
+	InterPinDelayData arcData = {inSourcePinPtr, inSinkPinPtr, inValue};
+	return setInterPinArcDelays(
+			{arcData},
+			inMin, inMax);
+}
+
+/**
+ * Method to set inter-pin delays in top-module context.
+ * Ignores unexistent edges.
+ * Returns false if non-empty input arcs vector becomes empty after filtering out.
+ * Delay value is in seconds.
+ * @param inArcDelaysVec pin pairs and their delays
+ * @param inMin apply as min delay
+ * @param inMax apply as max delay
+ */
+bool StaClientBase::setInterPinArcDelays(
+						const std::vector<InterPinDelayData>& inArcDelaysVec,
+						bool inMin,
+						bool inMax) {
+	//return true when there's nothing to do
+	if(inArcDelaysVec.empty())
+		return true;
+
+	//nothing to do if graph mapping isn't ready
+	if(!mHasGraph)
+		return false;
+
+	bool allOk = true;
+
+	CommandSetArcsDelays& command =
+			mProtocol.acquireCommand<CommandSetArcsDelays>();
+	command.mMin = inMin;
+	command.mMax = inMax;
+
+	std::string sourceName;
+	std::string sinkName;
+
+	//processing all arc to find vertexes
+	//skipping pin pairs that have no edge ID
+	for(const InterPinDelayData& arcData : inArcDelaysVec) {
+		auto edgePairIt = mPinPairToEdgeIdUMap.equal_range(
+				std::make_pair(arcData.mSourcePinPtr, arcData.mSinkPinPtr));
+
+//		sourceName = getName(getParentInstance(arcData.mSourcePinPtr));
+//		sourceName += "/";
+//		sourceName += getName(arcData.mSourcePinPtr);
+//		sinkName = getName(getParentInstance(arcData.mSinkPinPtr));
+//		sinkName += "/";
+//		sinkName += getName(arcData.mSinkPinPtr);
+
+		if(edgePairIt.first == edgePairIt.second) {
+//			std::cout << "no edge '" << sourceName << "' -> '" << sinkName << "'" << std::endl;
+//
+//			auto sourceVertIt = mSourcePinToVertexIdUMap.find(arcData.mSourcePinPtr);
+//			if(sourceVertIt != mSourcePinToVertexIdUMap.end())
+//				std::cout << "\tsource_vertex: " << sourceVertIt->second << std::endl;
+//			else
+//				std::cout << "\tsource_vertex: undefined" << std::endl;
+//
+//			auto sinkVertIt = mSinkPinToVertexIdUMap.find(arcData.mSinkPinPtr);
+//			if(sinkVertIt != mSinkPinToVertexIdUMap.end())
+//				std::cout << "\tsink_vertex: " << sinkVertIt->second << std::endl;
+//			else
+//				std::cout << "\tsink_vertex: undefined" << std::endl;
+
+			//allOk = false;
+			continue;
+		}
+
+		//setting delay for all edges between two nodes
+		for(; edgePairIt.first != edgePairIt.second; edgePairIt.first++) {
+//			std::cout << "edge '" << edgePairIt.first->second << ": " << sourceName << "' -> '" << sinkName << "'" << std::endl;
+
+			command.mEdgeIdsVec.push_back(edgePairIt.first->second);
+			command.mDelayValuesVec.push_back(arcData.mValue);
+		}
+
+	}
+
+	if(!inArcDelaysVec.empty() && command.mEdgeIdsVec.empty())
+		return false;
+
+	//NOTE: sometimes STA engine may remove net edges on it own
+	//so have to accept this fact and continue as it never happened
+//	//there were unexistent edges
+//	if(!allOk)
+//		return false;
+
+	//return true when there's nothing to do
+	if(command.mDelayValuesVec.empty() ||
+			command.mEdgeIdsVec.empty())
+		return true;
+
+	//making timing data invalid if arc delay changed
+	clearTimingMapping();
+
+	if(mWriteBack) {
+		writeBackArcsDelays(command);
+		return true;
+	}
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Method to resolve pin pairs to handles of their graph edges.
+ * Parallel edges are kept in the table of handle edges once per pin pair,
+ * so resolving the same pairs again doesn't grow it.
+ * Pair's edges are added again only if their amount changed.
+ * @param inArcsVec pin pairs to resolve, delay values are ignored
+ * @param outHandlesVec edge handles to fill, one per pin pair
+ * @return false if graph mapping isn't ready
+ */
+bool StaClientBase::resolveArcs(
+						const std::vector<InterPinDelayData>& inArcsVec,
+						std::vector<EdgeHandle>& outHandlesVec) {
+	outHandlesVec.clear();
+	if(!mHasGraph)
+		return false;
+
+	outHandlesVec.resize(inArcsVec.size());
+	for(size_t arcIdx = 0; arcIdx < inArcsVec.size(); arcIdx++) {
+		EdgeHandle& handle = outHandlesVec[arcIdx];
+		handle.mGeneration = mGraphMappingGeneration;
+
+		PinsPair pinsPair(
+				inArcsVec[arcIdx].mSourcePinPtr, inArcsVec[arcIdx].mSinkPinPtr);
+		auto edgePairIt = mPinPairToEdgeIdUMap.equal_range(pinsPair);
+		handle.mEdgesNum = std::distance(edgePairIt.first, edgePairIt.second);
+
+		if(handle.mEdgesNum == 1) {
+			handle.mEdgeIdx = edgePairIt.first->second;
+			continue;
+		}
+
+		if(handle.mEdgesNum == 0)
+			continue;
+
+		auto idxIt = mPinPairToHandleEdgeIdxUMap.find(pinsPair);
+		if(idxIt != mPinPairToHandleEdgeIdxUMap.end() &&
+				idxIt->second + handle.mEdgesNum <= mHandleEdgeIdsVec.size() &&
+				std::equal(edgePairIt.first, edgePairIt.second,
+						mHandleEdgeIdsVec.begin() + idxIt->second,
+						[](const PinsPairToEdgeIdUMMap::value_type& inEdge,
+								uint32_t inEdgeId) {
+							return inEdge.second == inEdgeId;
+						})) {
+			handle.mEdgeIdx = idxIt->second;
+			continue;
+		}
+
+		handle.mEdgeIdx = mHandleEdgeIdsVec.size();
+		mPinPairToHandleEdgeIdxUMap[pinsPair] = handle.mEdgeIdx;
+		for(; edgePairIt.first != edgePairIt.second; edgePairIt.first++)
+			mHandleEdgeIdsVec.push_back(edgePairIt.first->second);
+	}
+
+	return true;
+}
+
+/**
+ * Method to set delays of arcs by their resolved edge handles.
+ * Skips empty handles, fails without sending anything
+ * if some handle is outdated or amounts of handles and delays differ.
+ * Delay value is in seconds.
+ * @param inHandlesVec edge handles
+ * @param inDelaysVec delays of handles' arcs
+ * @param inMin apply as min delay
+ * @param inMax apply as max delay
+ */
+bool StaClientBase::setArcDelays(
+						const std::vector<EdgeHandle>& inHandlesVec,
+						const std::vector<float>& inDelaysVec,
+						bool inMin,
+						bool inMax) {
+	if(inHandlesVec.size() != inDelaysVec.size())
+		return false;
+
+	if(inHandlesVec.empty())
+		return true;
+
+	if(!mHasGraph)
+		return false;
+
+	CommandSetArcsDelays& command =
+			mProtocol.acquireCommand<CommandSetArcsDelays>();
+	command.mMin = inMin;
+	command.mMax = inMax;
+
+	for(size_t arcIdx = 0; arcIdx < inHandlesVec.size(); arcIdx++) {
+		const EdgeHandle& handle = inHandlesVec[arcIdx];
+		if(handle.mGeneration != mGraphMappingGeneration)
+			return false;
+
+		if(!handle.mEdgesNum)
+			continue;
+
+		if(handle.mEdgesNum == 1) {
+			command.mEdgeIdsVec.push_back(handle.mEdgeIdx);
+			command.mDelayValuesVec.push_back(inDelaysVec[arcIdx]);
+			continue;
+		}
+
+		for(uint32_t edgeIdx = handle.mEdgeIdx;
+				edgeIdx < handle.mEdgeIdx + handle.mEdgesNum; edgeIdx++) {
+			command.mEdgeIdsVec.push_back(mHandleEdgeIdsVec[edgeIdx]);
+			command.mDelayValuesVec.push_back(inDelaysVec[arcIdx]);
+		}
+	}
+
+	if(command.mEdgeIdsVec.empty())
+		return true;
+
+	//making timing data invalid if arc delay changed
+	clearTimingMapping();
+
+	if(mWriteBack) {
+		writeBackArcsDelays(command);
+		return true;
+	}
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Method to set min and max inter-pin delays in top-module context.
+ * Ignores unexistent edges like \link setInterPinArcDelays.
+ * Returns false if non-empty input arcs vector becomes empty after filtering out.
+ * Delay values are in seconds.
+ * @param inArcDelaysVec pin pairs and their min and max delays
+ * @param inMin apply min delays
+ * @param inMax apply max delays
+ */
+bool StaClientBase::setArcMinMaxDelays(
+						const std::vector<InterPinMinMaxDelayData>& inArcDelaysVec,
+						bool inMin,
+						bool inMax) {
+	if(inArcDelaysVec.empty())
+		return true;
+
+	if(!mHasGraph)
+		return false;
+
+	CommandSetArcsMinMaxDelays& command =
+			mProtocol.acquireCommand<CommandSetArcsMinMaxDelays>();
+	command.mMin = inMin;
+	command.mMax = inMax;
+
+	//setting delays for all edges between two nodes
+	for(const InterPinMinMaxDelayData& arcData : inArcDelaysVec) {
+		auto edgePairIt = mPinPairToEdgeIdUMap.equal_range(
+				std::make_pair(arcData.mSourcePinPtr, arcData.mSinkPinPtr));
+
+		for(; edgePairIt.first != edgePairIt.second; edgePairIt.first++)
+			command.mArcDelaysVec.push_back(
+					{edgePairIt.first->second, arcData.mMinValue, arcData.mMaxValue});
+	}
+
+	if(command.mArcDelaysVec.empty())
+		return false;
+
+	dedupArcDelays(command.mArcDelaysVec);
+
+	//making timing data invalid if arc delay changed
+	clearTimingMapping();
+
+	if(mWriteBack) {
+		writeBackArcsDelays(command);
+		return true;
+	}
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Method to set min and max delays of graph edges by their IDs.
+ * Edge IDs are the ones of graph mapping, see \link getPinPairEdgeIds.
+ * Delay values are in seconds.
+ * @param inArcDelaysVec edge IDs and their min and max delays
+ * @param inMin apply min delays
+ * @param inMax apply max delays
+ */
+bool StaClientBase::setArcMinMaxDelays(
+						const std::vector<ArcDelayData>& inArcDelaysVec,
+						bool inMin,
+						bool inMax) {
+	if(inArcDelaysVec.empty())
+		return true;
+
+	if(!mHasGraph)
+		return false;
+
+	CommandSetArcsMinMaxDelays& command =
+			mProtocol.acquireCommand<CommandSetArcsMinMaxDelays>();
+	command.mMin = inMin;
+	command.mMax = inMax;
+	command.mArcDelaysVec.assign(inArcDelaysVec.begin(), inArcDelaysVec.end());
+	dedupArcDelays(command.mArcDelaysVec);
+
+	//making timing data invalid if arc delay changed
+	clearTimingMapping();
+
+	if(mWriteBack) {
+		writeBackArcsDelays(command);
+		return true;
+	}
+
+	return mProtocol.execute(command);
+}
+
+
+/**
+ * Sends command to report timing and gets resulting report.
+ * @param inUnique report unique paths(without rise/fall variations)
+ * @param inMin report min-constraint paths
+ * @param inMax report max-constraint paths
+ * @param inUnconstrained report unconstrained paths
+ * @param inEndPointsNum amount of endpoints to report
+ * @param inGroupsNum amount of groups to report
+ * @param outReportStr report string to fill
+ * @return success status
+ */
+bool StaClientBase::reportTiming(
+		bool inUnique,
+		bool inMin,
+		bool inMax,
+		bool inUnconstrained,
+		uint32_t inEndPointsNum,
+		uint32_t inGroupsNum,
+		std::string& outReportStr) {
+	if(!flush())
+		return false;
+
+	CommandReportTiming command;
+
+	command.mUniquePaths = inUnique;
+	command.mMin = inMin;
+	command.mMax = inMax;
+	command.mUnconstrained = inUnconstrained;
+	command.mEndPointsNum = inEndPointsNum;
+	command.mGroupsNum = inGroupsNum;
+
+	return mProtocol.execute(command, outReportStr);
+}
+
+/**
+ * Method to get critical timing paths as arrays of graph IDs and numbers.
+ * @param inUnique get unique paths(without rise/fall variations)
+ * @param inMin get min-constraint paths
+ * @param inMax get max-constraint paths
+ * @param inUnconstrained get unconstrained paths
+ * @param inEndPointsNum amount of endpoints per group
+ * @param inGroupsNum amount of groups
+ * @param outPaths paths data to fill
+ * @return success status
+ */
+bool StaClientBase::getTimingPaths(
+		bool inUnique,
+		bool inMin,
+		bool inMax,
+		bool inUnconstrained,
+		uint32_t inEndPointsNum,
+		uint32_t inGroupsNum,
+		TimingPathsData& outPaths) {
+	if(!flush())
+		return false;
+
+	CommandGetTimingPaths command;
+
+	command.mUniquePaths = inUnique;
+	command.mMin = inMin;
+	command.mMax = inMax;
+	command.mUnconstrained = inUnconstrained;
+	command.mEndPointsNum = inEndPointsNum;
+	command.mGroupsNum = inGroupsNum;
+
+	return mProtocol.execute(command, outPaths);
+}
+
+/**
+ * Method to get endpoint slack summary of the design and of each clock.
+ * @param inHistMinSlack lower bound of histogram range
+ * @param inHistMaxSlack upper bound of histogram range
+ * @param inHistBinsNum amount of histogram bins, zero skips histograms
+ * @param outSummary summary to fill
+ * @return success status
+ */
+bool StaClientBase::getTimingSummary(
+		float inHistMinSlack,
+		float inHistMaxSlack,
+		uint32_t inHistBinsNum,
+		TimingSummaryData& outSummary) {
+	if(!flush())
+		return false;
+
+	CommandGetTimingSummary command;
+
+	command.mHistMinSlack = inHistMinSlack;
+	command.mHistMaxSlack = inHistMaxSlack;
+	command.mHistBinsNum = inHistBinsNum;
+
+	return mProtocol.execute(command, outSummary);
+}
+
+/**
+ * Method to get timing data of a subset of graph nodes.
+ * @param inVertexIdsVec IDs of vertices or cone roots
+ * @param inFanInDepth depth of fan-in cones in edges, zero skips them
+ * @param inFanOutDepth depth of fan-out cones in edges, zero skips them
+ * @param inMin check min-constraint criticality against threshold
+ * @param inMax check max-constraint criticality against threshold
+ * @param inMinCritFactor criticality threshold, zero keeps all nodes
+ * @param outNodeTimingsVec timing data of selected nodes in order of IDs
+ * @return success status
+ */
+bool StaClientBase::getGraphSlacksSubset(
+		const std::vector<uint32_t>& inVertexIdsVec,
+		uint32_t inFanInDepth,
+		uint32_t inFanOutDepth,
+		bool inMin,
+		bool inMax,
+		float inMinCritFactor,
+		std::vector<NodeTimingData>& outNodeTimingsVec) {
+	if(!flush())
+		return false;
+
+	CommandGetGraphSlacksSubset command;
+
+	command.mVertexIdsVec = inVertexIdsVec;
+	command.mFanInDepth = inFanInDepth;
+	command.mFanOutDepth = inFanOutDepth;
+	command.mMin = inMin;
+	command.mMax = inMax;
+	command.mMinCritFactor = inMinCritFactor;
+
+	return mProtocol.execute(command, outNodeTimingsVec);
+}
+
+/**
+ * Method to report basic timing stats of the design.
+ * @param inCommand command to execute
+ * @param outMinWNS worst slack for min condition
+ * @param outMinWNS worst slack for max condition
+ * @param outMinWNS total negative slack for min condition
+ * @param outMinWNS total negative slack for max condition
+ * @success status
+ */
+bool StaClientBase::getDesignStats(
+		float& outMinWNS,
+		float& outMaxWNS,
+		float& outMinTNS,
+		float& outMaxTNS) {
+	if(!flush())
+		return false;
+
+	CommandGetDesignStats command;
+
+	return mProtocol.execute(
+			command,
+			outMinWNS, outMaxWNS,
+			outMinTNS, outMaxTNS);
+}
+
+
+/**
+ * Clears all internal mappings of graph IDs and timings.
+ */
+void StaClientBase::clearGraphMapping() {
+	//std::cout << "Clearing graph mapping" << std::endl;
+	mPathToPinUMap.clear();
+	mPartialPathsBlockPtr = nullptr;
+	mSourcePinToVertexIdUMap.clear();
+	mSinkPinToVertexIdUMap.clear();
+	mPinPairToEdgeIdUMap.clear();
+	mVertexIdToPinVec.clear();
+	mEdgeIdToVertexIdsVec.clear();
+	mHasGraph = false;
+
+	invalidateEdgeHandles();
+	dropTimingBuffers();
+
+	//callers flush pending updates before, the rest refers to stale edges
+	clearWriteBack();
+}
+
+/**
+ * Marks timing data stale after STA state has changed.
+ * Clears it unless stale timing is kept by lazy invalidation.
+ */
+void StaClientBase::clearTimingMapping() {
+	markTimingStale();
+	if(!mLazyTimingInvalidation)
+		dropTimingBuffers();
+}
+
+/**
+ * Marks timing stale and counts the change.
+ * Change is counted before the flag is set, so load that didn't see
+ * the change can't clear the flag after it.
+ */
+void StaClientBase::markTimingStale() {
+	mTimingStaleNum++;
+	mTimingStale = true;
+}
+
+/**
+ * Clears all internal timing data in both buffers.
+ * Timing is made unreadable first, then getters are waited out.
+ */
+void StaClientBase::dropTimingBuffers() {
+	mHasGraphTiming = false;
+	markTimingStale();
+	for(NodeTimingBuffer& timing : mTimingBuffersArr) {
+		waitTimingReaders(timing);
+		timing.mNodeTimingDataVec.clear();
+		timing.mNodeMinCritFactorsVec.clear();
+		timing.mNodeMaxCritFactorsVec.clear();
+		timing.mGeneration = 0;
+	}
+}
+
+/**
+ * Returns timing buffer that is filled by the next load.
+ * Waits until getters stop reading it, since it was front before the last swap.
+ * @return back timing buffer
+ */
+StaClientBase::NodeTimingBuffer& StaClientBase::getBackTiming() {
+	NodeTimingBuffer& timing = mTimingBuffersArr[1 - mFrontTimingIdx.load()];
+	waitTimingReaders(timing);
+	return timing;
+}
+
+/**
+ * Waits until getters stop reading timing buffer.
+ * @param inTiming timing buffer
+ */
+void StaClientBase::waitTimingReaders(const NodeTimingBuffer& inTiming) const {
+	while(inTiming.mReadersNum.load())
+		std::this_thread::yield();
+}
+
+/**
+ * Makes loaded back buffer readable with the next timing generation.
+ * Buffer index is published atomically, so readers see complete timing.
+ * Timing stays stale if it was changed since the load has started.
+ * @param inStaleNum amount of stale changes at the start of the load
+ */
+void StaClientBase::swapTimingBuffers(uint64_t inStaleNum) {
+	getBackTiming().mGeneration = ++mTimingGeneration;
+	mFrontTimingIdx.store(1 - mFrontTimingIdx.load());
+	mHasGraphTiming = true;
+	mTimingStale = false;
+	if(mTimingStaleNum.load() != inStaleNum)
+		mTimingStale = true;
+}
+
+/**
+ * Counts reader of front timing buffer if timing is readable.
+ * Reader is counted before the buffer index is checked again,
+ * so the buffer can't be refilled after it became back one.
+ * @param inClient client with timing buffers
+ */
+StaClientBase::FrontTimingReader::FrontTimingReader(
+		const StaClientBase& inClient):
+			mTimingPtr(nullptr) {
+	while(inClient.mHasGraphTiming) {
+		uint32_t frontIdx = inClient.mFrontTimingIdx.load();
+		const NodeTimingBuffer& timing = inClient.mTimingBuffersArr[frontIdx];
+		timing.mReadersNum++;
+
+		if(frontIdx == inClient.mFrontTimingIdx.load() && inClient.mHasGraphTiming) {
+			mTimingPtr = &timing;
+			return;
+		}
+
+		timing.mReadersNum--;
+	}
+}
+
+/**
+ * Releases read buffer.
+ */
+StaClientBase::FrontTimingReader::~FrontTimingReader() {
+	if(mTimingPtr)
+		mTimingPtr->mReadersNum--;
+}
+
+/**
+ * Returns read timing buffer.
+ * @return timing buffer, nullptr if timing isn't readable
+ */
+const StaClientBase::NodeTimingBuffer* StaClientBase::FrontTimingReader::getTiming() const {
+	return mTimingPtr;
+}
+
+/**
+ * Drops pending arc delays and net caps of write-back mode.
+ */
+void StaClientBase::clearWriteBack() {
+	std::unique_lock<std::mutex> lock(mWriteBackMutex);
+	mWriteBackArcsUMap.clear();
+	mWriteBackNetCapsMap.clear();
+}
+
+/**
+ * Sends pending net caps of write-back mode in one command.
+ * Net caps are dropped only if the command succeeded.
+ * Setters wait for the end of flush.
+ * @return success status
+ */
+bool StaClientBase::flushNetCaps() {
+	std::unique_lock<std::mutex> lock(mWriteBackMutex);
+	if(mWriteBackNetCapsMap.empty())
+		return true;
+
+	CommandSetGroupNetCap& command =
+			mProtocol.acquireCommand<CommandSetGroupNetCap>();
+	size_t usedNum = 0;
+	for(const auto& netCap : mWriteBackNetCapsMap) {
+		fillNetNameData(
+				netCap.first.first, netCap.first.second,
+				nextPooledElement(command.mNetAddrsVec, usedNum));
+		command.mValuesVec.push_back(netCap.second);
+	}
+	trimPooledElements(command.mNetAddrsVec, usedNum);
+
+	if(!mProtocol.execute(command))
+		return false;
+
+	mWriteBackNetCapsMap.clear();
+	return true;
+}
+
+/**
+ * Sends pending arc delays of write-back mode
+ * in one command per combination of min and max flags.
+ * Arc delays are dropped only if all commands succeeded,
+ * resending already applied delays doesn't change anything.
+ * @return success status
+ */
+bool StaClientBase::flushArcs() {
+	std::unique_lock<std::mutex> lock(mWriteBackMutex);
+	if(mWriteBackArcsUMap.empty())
+		return true;
+
+	std::vector<ArcDelayData> minMaxDelaysVec;
+	std::vector<ArcDelayData> minDelaysVec;
+	std::vector<ArcDelayData> maxDelaysVec;
+	for(const auto& edgeArc : mWriteBackArcsUMap) {
+		const WriteBackArcData& arc = edgeArc.second;
+		ArcDelayData arcDelay = {edgeArc.first, arc.mMinDelay, arc.mMaxDelay};
+		if(arc.mMin && arc.mMax)
+			minMaxDelaysVec.push_back(arcDelay);
+		else if(arc.mMin)
+			minDelaysVec.push_back(arcDelay);
+		else
+			maxDelaysVec.push_back(arcDelay);
+	}
+
+	if(!flushArcsDelays(minMaxDelaysVec, true, true) ||
+			!flushArcsDelays(minDelaysVec, true, false) ||
+			!flushArcsDelays(maxDelaysVec, false, true))
+		return false;
+
+	mWriteBackArcsUMap.clear();
+	return true;
+}
+
+/**
+ * Keeps delays of arcs command until flush, the last delay of edge wins.
+ * Timing is marked stale after delays are kept.
+ * @param inCommand command with edge IDs and delays
+ */
+void StaClientBase::writeBackArcsDelays(
+		const CommandSetArcsDelays& inCommand) {
+	std::unique_lock<std::mutex> lock(mWriteBackMutex);
+	for(size_t arcIdx = 0; arcIdx < inCommand.mEdgeIdsVec.size() &&
+			arcIdx < inCommand.mDelayValuesVec.size(); arcIdx++) {
+		WriteBackArcData& arc = mWriteBackArcsUMap[inCommand.mEdgeIdsVec[arcIdx]];
+		if(inCommand.mMin) {
+			arc.mMinDelay = inCommand.mDelayValuesVec[arcIdx];
+			arc.mMin = true;
+		}
+		if(inCommand.mMax) {
+			arc.mMaxDelay = inCommand.mDelayValuesVec[arcIdx];
+			arc.mMax = true;
+		}
+	}
+
+	//load that started before the delays were kept doesn't flush them
+	lock.unlock();
+	markTimingStale();
+}
+
+/**
+ * Keeps min and max delays of arcs command until flush,
+ * the last delays of edge win.
+ * Timing is marked stale after delays are kept.
+ * @param inCommand command with edge IDs and delays
+ */
+void StaClientBase::writeBackArcsDelays(
+		const CommandSetArcsMinMaxDelays& inCommand) {
+	std::unique_lock<std::mutex> lock(mWriteBackMutex);
+	for(const ArcDelayData& arcDelay : inCommand.mArcDelaysVec) {
+		WriteBackArcData& arc = mWriteBackArcsUMap[arcDelay.mEdgeId];
+		if(inCommand.mMin) {
+			arc.mMinDelay = arcDelay.mMinDelay;
+			arc.mMin = true;
+		}
+		if(inCommand.mMax) {
+			arc.mMaxDelay = arcDelay.mMaxDelay;
+			arc.mMax = true;
+		}
+	}
+
+	//load that started before the delays were kept doesn't flush them
+	lock.unlock();
+	markTimingStale();
+}
+
+/**
+ * Sends pending arc delays with the same min and max flags.
+ * Delays are sorted by edge IDs, so batches don't depend on hashing.
+ * Command isn't pooled, setters may fill pooled one during background load.
+ * @param ioArcDelaysVec arc delays to send, moved in command
+ * @param inMin apply min delays
+ * @param inMax apply max delays
+ * @return success status
+ */
+bool StaClientBase::flushArcsDelays(
+		std::vector<ArcDelayData>& ioArcDelaysVec,
+		bool inMin,
+		bool inMax) {
+	if(ioArcDelaysVec.empty())
+		return true;
+
+	std::sort(ioArcDelaysVec.begin(), ioArcDelaysVec.end(),
+			[](const ArcDelayData& inLeft, const ArcDelayData& inRight) {
+				return inLeft.mEdgeId < inRight.mEdgeId;
+			});
+
+	CommandSetArcsMinMaxDelays command;
+	command.mMin = inMin;
+	command.mMax = inMax;
+	command.mArcDelaysVec.swap(ioArcDelaysVec);
+
+	return mProtocol.execute(command);
+}
+
+/**
+ * Fills names of net and instances of its context.
+ * Names are assigned into kept strings, so pooled name data isn't reallocated.
+ * @param inInstContextVec top-bottom sequence of instances
+ * @param inNetPtr net pointer
+ * @param outNameData names to fill
+ */
+void StaClientBase::fillNetNameData(
+		const std::vector<const GenericInst*>& inInstContextVec,
+		const GenericNet* inNetPtr,
+		ObjectContextNameData& outNameData) {
+	outNameData.mObjName.assign(getNameView(inNetPtr));
+
+	size_t usedNum = 0;
+	for(const GenericInst* instPtr : inInstContextVec)
+		nextPooledElement(outNameData.mInstContextVec, usedNum).assign(
+				getNameView(instPtr));
+	trimPooledElements(outNameData.mInstContextVec, usedNum);
+}
+
+/**
+ * Makes all resolved edge handles outdated by changing mapping generation.
+ */
+void StaClientBase::invalidateEdgeHandles() {
+	mGraphMappingGeneration++;
+	mHandleEdgeIdsVec.clear();
+	mPinPairToHandleEdgeIdxUMap.clear();
+}
+
+/**
+ * Drops netlist edits that weren't uploaded.
+ */
+void StaClientBase::clearPendingNetlistEdits() {
+	mPendingEdits.mInstContextsVec.clear();
+	mPendingEdits.mEditsVec.clear();
+	mPendingContextToIdxMap.clear();
+	mPendingAddedPinPathsVec.clear();
+	mPendingRemovedPinPathsVec.clear();
+}
+
+/**
+ * Patches graph mapping with changes of timing graph.
+ * Removes entities first, because their IDs may be recycled by added ones.
+ * Added vertexes are matched with pins by paths, so paths must be updated.
+ * Timing data of changed vertexes is reset until the next slacks load.
+ * Edge handles are invalidated if edges are removed, their IDs may be recycled.
+ * Returns false if some ID is out of bounds or vertex pin isn't found,
+ * mapping is partially patched then and must be cleared.
+ * @param inChanges changes of timing graph
+ * @return operation success
+ */
+bool StaClientBase::applyGraphChanges(
+						const GraphChangesData& inChanges) {
+	std::vector<uint32_t> changedVertexIdsVec;
+	if(!inChanges.mRemovedEdgeIdsVec.empty())
+		invalidateEdgeHandles();
+
+	for(uint32_t edgeId : inChanges.mRemovedEdgeIdsVec) {
+		if(edgeId >= mEdgeIdToVertexIdsVec.size())
+			return false;
+
+		//edges go first, so their vertexes are still mapped
+		const VertexIdPair& vertexIds = mEdgeIdToVertexIdsVec[edgeId];
+		if(vertexIds.first >= mVertexIdToPinVec.size() ||
+				vertexIds.second >= mVertexIdToPinVec.size())
+			return false;
+
+		auto edgeRange = mPinPairToEdgeIdUMap.equal_range(PinsPair(
+				mVertexIdToPinVec[vertexIds.first],
+				mVertexIdToPinVec[vertexIds.second]));
+		for(auto edgeIt = edgeRange.first; edgeIt != edgeRange.second; edgeIt++) {
+			if(edgeIt->second == edgeId) {
+				mPinPairToEdgeIdUMap.erase(edgeIt);
+				break;
+			}
+		}
+
+		mEdgeIdToVertexIdsVec[edgeId] = VertexIdPair(cNoGraphId, cNoGraphId);
+	}
+
+	for(uint32_t vertexId : inChanges.mRemovedVertexIdsVec) {
+		if(vertexId >= mVertexIdToPinVec.size())
+			return false;
+
+		//pin may be already remapped to another vertex
+		const GenericPin* pinPtr = mVertexIdToPinVec[vertexId];
+		auto nodeIt = mSourcePinToVertexIdUMap.find(pinPtr);
+		if(nodeIt != mSourcePinToVertexIdUMap.end() && nodeIt->second == vertexId)
+			mSourcePinToVertexIdUMap.erase(nodeIt);
+		nodeIt = mSinkPinToVertexIdUMap.find(pinPtr);
+		if(nodeIt != mSinkPinToVertexIdUMap.end() && nodeIt->second == vertexId)
+			mSinkPinToVertexIdUMap.erase(nodeIt);
+
+		mVertexIdToPinVec[vertexId] = nullptr;
+		changedVertexIdsVec.push_back(vertexId);
+	}
+
+	for(const VertexIdData& data : inChanges.mAddedVerticesVec) {
+		GenericPin* pinPtr = findVertexPin(data, mPathToPinUMap);
+		if(!pinPtr)
+			return false;
+
+		if(data.mVertexId >= mVertexIdToPinVec.size())
+			mVertexIdToPinVec.resize(data.mVertexId + 1, nullptr);
+		mVertexIdToPinVec[data.mVertexId] = pinPtr;
+
+		if(data.mIsDriver)
+			mSourcePinToVertexIdUMap[pinPtr] = data.mVertexId;
+		else
+			mSinkPinToVertexIdUMap[pinPtr] = data.mVertexId;
+
+		changedVertexIdsVec.push_back(data.mVertexId);
+	}
+
+	for(const EdgeIdData& data : inChanges.mAddedEdgesVec) {
+		if(data.mFromVertexId >= mVertexIdToPinVec.size() ||
+				data.mToVertexId >= mVertexIdToPinVec.size())
+			return false;
+
+		PinsPair pinsPair(
+				mVertexIdToPinVec[data.mFromVertexId],
+				mVertexIdToPinVec[data.mToVertexId]);
+		if(!pinsPair.first || !pinsPair.second)
+			return false;
+
+		mPinPairToEdgeIdUMap.emplace(pinsPair, data.mEdgeId);
+		setEdgeVertexIds(data);
+	}
+
+	resetNodesTiming(changedVertexIdsVec);
+	return true;
+}
+
+/**
+ * Resets timing data and criticality of vertexes if timing was loaded.
+ * Front buffer may be read by getters, so it's copied in back buffer,
+ * that is reset and swapped keeping timing generation and stale flag.
+ * @param inVertexIdsVec vertex IDs
+ */
+void StaClientBase::resetNodesTiming(const std::vector<uint32_t>& inVertexIdsVec) {
+	if(inVertexIdsVec.empty() || !mHasGraphTiming)
+		return;
+
+	const NodeTimingBuffer& front = mTimingBuffersArr[mFrontTimingIdx.load()];
+	NodeTimingBuffer& timing = getBackTiming();
+	timing.mNodeTimingDataVec = front.mNodeTimingDataVec;
+	timing.mNodeMinCritFactorsVec = front.mNodeMinCritFactorsVec;
+	timing.mNodeMaxCritFactorsVec = front.mNodeMaxCritFactorsVec;
+	timing.mGeneration = front.mGeneration;
+
+	for(uint32_t vertexId : inVertexIdsVec) {
+		if(vertexId < timing.mNodeTimingDataVec.size())
+			timing.mNodeTimingDataVec[vertexId] = NodeTimingData();
+		if(vertexId < timing.mNodeMinCritFactorsVec.size())
+			timing.mNodeMinCritFactorsVec[vertexId] = 0;
+		if(vertexId < timing.mNodeMaxCritFactorsVec.size())
+			timing.mNodeMaxCritFactorsVec[vertexId] = 0;
+	}
+
+	mFrontTimingIdx.store(1 - mFrontTimingIdx.load());
+}
+
+/**
+ * Maps pins of leaf instances and top-level ports by their paths.
+ * Returns false if block pointer is null.
+ * @param inBlockPtr top-block
+ * @return operation success
+ */
+bool StaClientBase::fillPathToPinMap(
+						const GenericBlock* inBlockPtr) {
+	if(!addBlockPinsInNameMap(
+			nullptr, inBlockPtr,
+			mDivider, "", mPathToPinUMap))
+		return false;
+
+	//also have to map pins of top-level ports
+	std::vector<GenericPort*> topPortsVec;
+	getPorts(inBlockPtr, topPortsVec);
+	for(GenericPort* portPtr : topPortsVec) {
+		if(!portPtr || !getPortPin(portPtr))
+			continue;
+
+		mPathToPinUMap.emplace(
+				getName(portPtr), getPortPin(portPtr));
+	}
+
+	return true;
+}
+
+/**
+ * Maps paths of all pins if mapping has only vertex pins after snapshot attach.
+ * @return operation success
+ */
+bool StaClientBase::completePathToPinMap() {
+	if(!mPartialPathsBlockPtr)
+		return true;
+
+	const GenericBlock* blockPtr = mPartialPathsBlockPtr;
+	mPartialPathsBlockPtr = nullptr;
+	return fillPathToPinMap(blockPtr);
+}
+
+/**
+ * Finds pin by it's path descending from the top block by instance names.
+ * Children of each visited instance are mapped by names once in given lookup,
+ * so other instances of the hierarchy aren't visited.
+ * Path without dividers is a name of top-level port.
+ * Returns nullptr if some name in the path isn't found.
+ * @param inBlockPtr top block
+ * @param inPath pin path
+ * @param ioLookup children of visited instances
+ * @return found pin
+ */
+GenericPin* StaClientBase::findPinByPath(
+						const GenericBlock* inBlockPtr,
+						std::string_view inPath,
+						PinPathLookup& ioLookup) {
+	const GenericInst* parentInstPtr = nullptr;
+	const GenericBlock* blockPtr = inBlockPtr;
+
+	std::size_t nameStart = 0;
+	std::size_t dividerPos = inPath.find(mDivider);
+	if(dividerPos == std::string_view::npos) {
+		if(ioLookup.mTopPinsUMap.empty()) {
+			std::vector<GenericPort*> topPortsVec;
+			getPorts(inBlockPtr, topPortsVec);
+			for(GenericPort* portPtr : topPortsVec) {
+				if(portPtr && getPortPin(portPtr))
+					ioLookup.mTopPinsUMap.emplace(
+							getName(portPtr), getPortPin(portPtr));
+			}
+		}
+
+		auto pinIt = ioLookup.mTopPinsUMap.find(std::string(inPath));
+		return pinIt == ioLookup.mTopPinsUMap.end() ? nullptr : pinIt->second;
+	}
+
+	std::vector<GenericInst*> childrenInstsVec;
+	for(; dividerPos != std::string_view::npos;
+			dividerPos = inPath.find(mDivider, nameStart)) {
+		auto emplaced = ioLookup.mChildInstsUMap.try_emplace(parentInstPtr);
+		auto& childInstsUMap = emplaced.first->second;
+		if(emplaced.second) {
+			childrenInstsVec.clear();
+			getBlockInsts(parentInstPtr, blockPtr, childrenInstsVec);
+			for(GenericInst* instPtr : childrenInstsVec) {
+				if(instPtr)
+					childInstsUMap.emplace(getNameView(instPtr), instPtr);
+			}
+		}
+
+		auto instIt = childInstsUMap.find(
+				inPath.substr(nameStart, dividerPos - nameStart));
+		if(instIt == childInstsUMap.end())
+			return nullptr;
+
+		parentInstPtr = instIt->second;
+		blockPtr = getMasterBlock(parentInstPtr);
+		if(!blockPtr)
+			return nullptr;
+
+		nameStart = dividerPos + 1;
+	}
+
+	if(!isLeafBlock(blockPtr))
+		return nullptr;
+
+	auto emplaced = ioLookup.mInstPinsUMap.try_emplace(parentInstPtr);
+	auto& instPinsUMap = emplaced.first->second;
+	if(emplaced.second) {
+		std::vector<GenericPin*> instPinsVec;
+		getInstPins(parentInstPtr, instPinsVec);
+		for(GenericPin* pinPtr : instPinsVec) {
+			if(pinPtr)
+				instPinsUMap.emplace(getNameView(pinPtr), pinPtr);
+		}
+	}
+
+	auto pinIt = instPinsUMap.find(inPath.substr(nameStart));
+	return pinIt == instPinsUMap.end() ? nullptr : pinIt->second;
+}
+
+/**
+ * First remaps vertexes to pins
+ * Then fills driver/sink pins -> vertexIds and pin pairs to edgeIDs.
+ * Returns false if fails to fill data on each of steps.
+ * @param inBlockPtr top-block
+ * @param inVertexIdToDataVec vertexes data
+ * @param inEdgeIdToDataVec edges data
+ */
+bool StaClientBase::addGraphMapping(
+						const GenericBlock* inBlockPtr,
+						const std::vector<VertexIdData>& inVertexIdToDataVec,
+						const std::vector<EdgeIdData>& inEdgeIdToDataVec) {
+
+	//preparing mapping of the netlist objects by their paths
+	if(!fillPathToPinMap(inBlockPtr))
+		return false;
+
+	//first matching vertexes and pins between each other
+	//keeping the matching to patch it after netlist edits
+	if(!matchVertexPins(inVertexIdToDataVec,
+			mPathToPinUMap, mVertexIdToPinVec))
+		return false;
+
+	//then fill pin -> vertexId mappings
+	//depending on vertex "driver" flag
+	if(!fillPinToVertexIdMaps(
+			mVertexIdToPinVec,
+			inVertexIdToDataVec,
+			mSourcePinToVertexIdUMap,
+			mSinkPinToVertexIdUMap))
+		return false;
+
+	//finally filling the edge mapping
+	if(!fillPinPairsToEdgeIdMap(
+			mVertexIdToPinVec,
+			inEdgeIdToDataVec,
+			mPinPairToEdgeIdUMap))
+		return false;
+
+	//vertexes of edges to remove edges by their IDs
+	mEdgeIdToVertexIdsVec.assign(
+			inEdgeIdToDataVec.size(), VertexIdPair(cNoGraphId, cNoGraphId));
+	for(const EdgeIdData& data : inEdgeIdToDataVec)
+		setEdgeVertexIds(data);
+
+	return true;
+}
+
+/**
+ * Keeps vertex IDs of the edge, grows the vector if it's necessary.
+ * @param inEdgeData edge data
+ */
+void StaClientBase::setEdgeVertexIds(
+						const EdgeIdData& inEdgeData) {
+	if(inEdgeData.mEdgeId >= mEdgeIdToVertexIdsVec.size())
+		mEdgeIdToVertexIdsVec.resize(
+				inEdgeData.mEdgeId + 1, VertexIdPair(cNoGraphId, cNoGraphId));
+
+	mEdgeIdToVertexIdsVec[inEdgeData.mEdgeId] = VertexIdPair(
+			inEdgeData.mFromVertexId, inEdgeData.mToVertexId);
+}
+
+/**
+ * Creates path of vertex and finds pin with the same path.
+ * @param inVertexData data of vertex
+ * @param inPathToPinUMap paths of pins
+ * @return pin pointer or nullptr if it isn't found
+ */
+GenericPin* StaClientBase::findVertexPin(
+						const VertexIdData& inVertexData,
+						const std::map<std::string, GenericPin*>& inPathToPinUMap) const {
+	std::string vertexPath;
+	for (const auto &instName : inVertexData.mContextInstNamesVec) {
+		vertexPath += instName;
+		vertexPath += mDivider;
+	}
+	vertexPath += inVertexData.mPinName;
+
+	auto pinIt = inPathToPinUMap.find(vertexPath);
+	if(pinIt == inPathToPinUMap.end())
+		return nullptr;
+
+	return pinIt->second;
+}
+
+/**
+ * For each vertex data creates a path.
+ * Then by matching path to pin's one creates matching.
+ * Returns false if fails to find one of the pins.
+ * @param inVertexIdToDataVec data of vertexes
+ * @param inPathToPinUMap paths of pins
+ * @param outVertexIdToPinVec output vertex-pin mapping
+ * @return operation success
+ */
+bool StaClientBase::matchVertexPins(
+						const std::vector<VertexIdData>& inVertexIdToDataVec,
+						const std::map<std::string, GenericPin*>& inPathToPinUMap,
+						std::vector<GenericPin*>& outVertexIdToPinVec) {
+	outVertexIdToPinVec.clear();
+	outVertexIdToPinVec.resize(
+			inVertexIdToDataVec.size(),
+			nullptr);
+
+//	std::cout << "Matching vertex IDX and pins" << std::endl;
+
+	//processing data of all vertexes
+	//vertexId is ignores, because edge references the vector indexes now
+	for(size_t dataIdx = 0; dataIdx < inVertexIdToDataVec.size(); dataIdx++) {
+		//searching the pin by vertex path
+		outVertexIdToPinVec[dataIdx] = findVertexPin(
+				inVertexIdToDataVec[dataIdx], inPathToPinUMap);
+		if(!outVertexIdToPinVec[dataIdx]) {
+//			std::cout << "vertex index " << dataIdx << " failed to find pin" << std::endl;
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Maps out vertex IDs of pins.
+ * Writes out in driver or sink map depending on driver flag of vertex data.
+ * @param inVertexIdToPinVec vertexId->pin mapping
+ * @param inVertexIdToDataVec data of vertexes
+ * @param inPathToPinUMap paths of pins
+ * @param outVertexIdToPinVec output vertex-pin mapping
+ * @return operation success
+ */
+bool StaClientBase::fillPinToVertexIdMaps(
+						const std::vector<GenericPin*>& inVertexIdToPinVec,
+						const std::vector<VertexIdData>& inVertexIdToDataVec,
+						std::unordered_map<const GenericPin*, uint32_t>& mDriverPinToVertexIdUMap,
+						std::unordered_map<const GenericPin*, uint32_t>& mSinkPinToVertexIdUMap) {
+	GenericPin* pinPtr = nullptr;
+
+	mDriverPinToVertexIdUMap.clear();
+	mSinkPinToVertexIdUMap.clear();
+
+	//processing data of all vertexes
+	//pins are mapped by indexes in the vector
+	for(size_t dataIdx = 0; dataIdx < inVertexIdToDataVec.size(); dataIdx++) {
+		if(dataIdx >= inVertexIdToPinVec.size())
+			return false;
+
+		pinPtr = inVertexIdToPinVec[dataIdx];
+		if(!pinPtr) {
+			return false;
+		}
+
+		//writing out mapping
+		//mapping into vertex IDs from timing graph, not the vector indexes
+		if(inVertexIdToDataVec[dataIdx].mIsDriver)
+			mDriverPinToVertexIdUMap.emplace(pinPtr, dataIdx);
+		else
+			mSinkPinToVertexIdUMap.emplace(pinPtr, dataIdx);
+	}
+
+	return true;
+}
+
+/**
+ * Maps out pin pairs to edge IDs.
+ * @param inVertexIdToPinVec vertexId->pin mapping
+ * @param inVertexIdToDataVec data of edges
+ * @param outPinPairToEdgeIdUMap output mapping
+ * @return operation success
+ */
+bool StaClientBase::fillPinPairsToEdgeIdMap(
+						const std::vector<GenericPin*>& inVertexIdToPinVec,
+						const std::vector<EdgeIdData>& inEdgeIdToDataVec,
+						PinsPairToEdgeIdUMMap& outPinPairToEdgeIdUMap) {
+	const GenericPin* fromPinPtr = nullptr;
+	const GenericPin* toPinPtr = nullptr;
+
+	outPinPairToEdgeIdUMap.clear();
+
+	//processing data of all edges
+	for(const EdgeIdData& data : inEdgeIdToDataVec) {
+		//have to find pins for both vertex ends
+		if(data.mFromVertexId >= inVertexIdToPinVec.size() ||
+				data.mToVertexId >= inVertexIdToPinVec.size()) {
+//			std::cout << "out of bounds pins for edge " << data.mEdgeId <<
+//					": " << data.mFromVertexId << " -> " << data.mToVertexId << std::endl;
+			return false;
+		}
+		fromPinPtr = inVertexIdToPinVec[data.mFromVertexId];
+		toPinPtr = inVertexIdToPinVec[data.mToVertexId];
+
+		if(!fromPinPtr || !toPinPtr) {
+//			std::cout << "failed to find pins for edge " << data.mEdgeId <<
+//					": " << data.mFromVertexId << " -> " << data.mToVertexId  << std::endl;
+			return false;
+		}
+
+		outPinPairToEdgeIdUMap.insert(
+				std::make_pair(
+					std::make_pair(fromPinPtr, toPinPtr),
+					data.mEdgeId));
+	}
+
+	return true;
+}
+
+/**
+ * Descends inside the block in DFS manner, maps pins of leaf insts by their paths.
+ * For non-leaf masters accumulates inst names in path and descends deeper.
+ * Returns false if block pointer is null.
+ * @param inParentInstPtr previous parent instance
+ * @param inBlockPtr target block
+ * @param inDivider hierarchy divider to use
+ * @param inPath current path
+ * @param outPathToPinUMap output map to fill
+ * @return operation success
+ */
+bool StaClientBase::addBlockPinsInNameMap(
+						const GenericInst* inParentInstPtr,
+						const GenericBlock* inBlockPtr,
+						char inDivider,
+						const std::string& inPath,
+						std::map<std::string, GenericPin*>& outPathToPinMap) {
+	if(!inBlockPtr)
+		return false;
+
+	//std::cout << "Filling pin paths mapping" << std::endl;
+
+	bool allOk = true;
+
+	std::string nextPath;
+	std::vector<GenericInst*> childrenInstsVec;
+	std::vector<GenericPin*> instPinsVec;
+	GenericBlock* masterPtr = nullptr;
+
+	//processing all children instances
+	getBlockInsts(inParentInstPtr, inBlockPtr, childrenInstsVec);
+	for(GenericInst* instPtr : childrenInstsVec) {
+		if(!instPtr)
+			continue;
+
+		nextPath = inPath;
+		nextPath += getNameView(instPtr);
+		nextPath += inDivider;
+
+		masterPtr = getMasterBlock(instPtr);
+		if(!masterPtr)
+			continue;
+
+		//diving deeper if it isn't a leaf
+		if(!isLeafBlock(masterPtr)) {
+			allOk &= addBlockPinsInNameMap(
+					instPtr, masterPtr, inDivider,
+					nextPath, outPathToPinMap);
+			continue;
+		}
+
+		//otherwise mapping all pins in the instance
+		instPinsVec.clear();
+		getInstPins(instPtr, instPinsVec);
+		for(GenericPin* pinPtr : instPinsVec) {
+			if(!pinPtr)
+				continue;
+
+			std::string pinPath = nextPath;
+			pinPath += getNameView(pinPtr);
+			outPathToPinMap.emplace(std::move(pinPath), pinPtr);
+		}
+	}
+
+	return allOk;
+}
+
+
+
+/**
+ * Sets all data in path message, doesn't check anything.
+ */
+bool StaClientBase::fillPathMesgData(
+						bool inFromRise,
+						bool inFromFall,
+						const std::vector<PinContextPath>& inFromPinPathsVec,
+						const std::vector<std::string>& inFromClocksVec,
+						const std::vector<InstContextPath>& inFromInstPathsVec,
+						bool inThroughRise,
+						bool inThroughFall,
+						const std::vector<PinContextPath>& inThroughPinPathsVec,
+						const std::vector<InstContextPath>& inThroughInstPathsVec,
+						const std::vector<NetContextPath>& inThroughNetPathsVec,
+						bool inToRise,
+						bool inToFall,
+						const std::vector<PinContextPath>& inToPinPathsVec,
+						const std::vector<std::string>& inToClocksVec,
+						const std::vector<InstContextPath>& inToInstPathsVec,
+						bool inRise,
+						bool inFall,
+						TimingPathMessageBase& outMessage) {
+	outMessage.mFromRise = inFromRise;
+	outMessage.mFromFall = inFromFall;
+	convertContextNameDataVec(inFromPinPathsVec, outMessage.mFromPinPathsVec);
+	outMessage.mFromClocksVec = inFromClocksVec;
+	convertContextNameDataVec(inFromInstPathsVec, outMessage.mFromInstPathsVec);
+
+	outMessage.mThroughRise = inThroughRise;
+	outMessage.mThroughFall = inThroughFall;
+	convertContextNameDataVec(inThroughPinPathsVec, outMessage.mThroughPinPathsVec);
+	convertContextNameDataVec(inThroughInstPathsVec, outMessage.mThroughInstPathsVec);
+	convertContextNameDataVec(inThroughNetPathsVec, outMessage.mThroughNetPathsVec);
+
+	outMessage.mToRise = inToRise;
+	outMessage.mToFall = inToFall;
+	convertContextNameDataVec(inToPinPathsVec, outMessage.mToPinPathsVec);
+	outMessage.mToClocksVec = inToClocksVec;
+	convertContextNameDataVec(inToInstPathsVec, outMessage.mToInstPathsVec);
+
+	outMessage.mRise = inRise;
+	outMessage.mFall = inFall;
+
+	return true;
+}
+
+
+
+}
+
+
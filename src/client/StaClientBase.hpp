@@ -1,613 +1,983 @@
-#ifndef SRC_NEW_STACLIENTBASE_HPP_
-#define SRC_NEW_STACLIENTBASE_HPP_
-
-
-#include "IStaClient.hpp"
-#include "StaClientIpcProtocol.hpp"
-#include "AbsNetlistProcessorBase.hpp"
-
-#include <boost/functional/hash.hpp>
-
-#include <unordered_map>
-#include <vector>
-#include <limits>
-
-
-namespace stamask {
-
-
-/**
- * Base class to make client interface to STA via IPC connection.
- * Takes objects, converts data to send a command via IPC and acquire execution results.
- */
-class StaClientBase:
-		public IStaClient,
-		public AbsNetlistProcessorBase {
-
-	typedef std::pair<const GenericPin*, const GenericPin*>
-			PinsPair;
-	typedef std::pair<uint32_t, uint32_t>
-			PinIdPair;
-	typedef std::unordered_multimap<
-				PinsPair, uint32_t, boost::hash<PinsPair>>
-			PinsPairToEdgeIdUMMap;
-	typedef std::unordered_multimap<
-				PinIdPair, uint32_t, boost::hash<PinIdPair>>
-			PinIdPairToEdgeIdUMMap;
-	typedef std::map<std::string, GenericPin*>
-			StrToPinMap;
-
-	/** protocol to interchange messages and get results */
-	StaClientIpcProtocol mProtocol;
-
-private:
-
-	/** path divides to use */
-	char mDivider;
-
-	/** mapping from hierarchical path to pins (to match timing nodes) */
-	std::map<std::string, GenericPin*> mPathToPinUMap;
-
-	/** mapping from edge source to timing node index */
-	std::unordered_map<const GenericPin*, uint32_t> mSourcePinToVertexIdUMap;
-
-	/** mapping from edge target to timing node index */
-	std::unordered_map<const GenericPin*, uint32_t> mSinkPinToVertexIdUMap;
-
-	/** mapping from (source, target) pair of pins to ID of timing edge  */
-	PinsPairToEdgeIdUMMap mPinPairToEdgeIdUMap;
-
-	/** flag that timing graph was loaded */
-	bool mHasGraph;
-
-private:
-
-	/** timing data of graph nodes */
-	std::vector<NodeTimingData> mNodeTimingDataVec;
-
-	/** calculated min-constraint criticality of graph nodes */
-	std::vector<float> mNodeMinCritFactorsVec;
-
-	/** calculated max-constraint criticality of graph nodes */
-	std::vector<float> mNodeMaxCritFactorsVec;
-
-	/** flag that timing data was loaded */
-	bool mHasGraphTiming;
-
-
-public:
-
-	StaClientBase();
-
-	virtual ~StaClientBase();
-
-	virtual void setChannel(IpcChannel* inChannelPtr);
-
-	IpcChannel* getChannel();
-
-public:
-
-	bool hasGraph() const;
-
-	bool hasTimings() const;
-
-	bool getPinCriticality(
-			const GenericPin* inPinPtr,
-			float& outValue,
-			bool inMin,
-			bool inEdgeSourcePriority = true) const;
-			
-	bool getPinTimingData(
-			const GenericPin* inPinPtr,
-			NodeTimingData& outValue) const;
-
-	StrToPinMap::const_iterator beginPathPins() const;
-	StrToPinMap::const_iterator endPathPins() const;
-
-
-			
-public:
-
-	virtual bool exit();
-
-	virtual bool ping(
-			unsigned long inMsTimeout);
-
-	virtual void setHierarchySeparator(
-			char inSeparator);
-
-	virtual bool readLibertyFile(
-			const std::string& inFileName);
-
-	virtual bool readLibertyStream(
-			std::istream& inDataStream);
-
-	virtual bool clearLibraries();
-
-
-	virtual bool readVerilogFile(
-			const std::string& inFileName);
-
-	virtual bool readVerilogStream(
-			std::istream& inDataStream);
-
-	virtual bool linkVerilogTopBlockNetlist(
-			const std::string& inTopBlockName);
-
-
-	virtual bool linkCreateTopBlockNetlist(
-			const GenericBlock* inBlockPtr);
-
-	virtual bool connectTopContextPinNet(
-			const GenericPin* inPinPtr,
-			const GenericNet* inNetPtr);
-
-	virtual bool disconnectTopContextPinNet(
-			const GenericPin* inPinPtr,
-			const GenericNet* inNetPtr);
-
-	virtual bool connectContextPinNet(
-			const std::vector<GenericInst*>& inInstContextVec,
-			const GenericPin* inPinPtr,
-			const GenericNet* inNetPtr);
-
-	virtual bool disconnectContextPinNet(
-			const std::vector<GenericInst*>& inInstContextVec,
-			const GenericPin* inPinPtr,
-			const GenericNet* inNetPtr);
-
-	virtual bool clearNetlistBlocks();
-
-public:
-
-	virtual bool createClock(
-			const std::string& inName,
-			const std::string& inDescription,
-			const std::vector<PinContextPath>& inPinPathsVec,
-			bool inAddFlag,
-			float inPeriod,
-			const std::vector<float>& inWaveformVec);
-
-	virtual bool createGeneratedClock(
-			const std::string& inName,
-			const std::string& inDescription,
-			const PinContextPath& inMasterClockPinPath,
-			const std::string& inMasterClockName,
-			const std::vector<PinContextPath>& inPinPathsVec,
-			bool inAddFlag,
-		    int inDivideFactor,
-			int inMultiplyFactor,
-		    float inDutyCycle,
-		    bool inInvert,
-		    const std::vector<int>& inEdgesVec,
-			const std::vector<float>& inEdgeShiftsVec);
-
-	virtual bool setClockGroups(
-			const std::string& inName,
-			const std::string& inDescription,
-			bool inLogicalExclusive,
-			bool inPhysicalExclusive,
-			bool inAsynchronous,
-			bool inAllowPaths,
-			const std::vector<std::vector<std::string>>& inClockGroupsVec);
-
-	virtual bool setClockLatency(
-			bool inSource,
-			bool inMin,
-			bool inMax,
-			bool inEarly,
-			bool inLate,
-			bool inRise,
-			bool inFall,
-			float inValue,
-			const std::string& inClockName,
-			const PinContextPath& inPinPath);
-
-	virtual bool setClockToClockUncertainty(
-			const std::string& inFromClockName,
-			bool inFromRise,
-			bool inFromFall,
-			const std::string& inToClockName,
-			bool inToRise,
-			bool inToFall,
-			bool inSetup,
-			bool inHold,
-			float inValue);
-
-	virtual bool setClockUncertainty(
-			const std::string& inClockName,
-			bool inSetup,
-			bool inHold,
-			float inValue);
-
-	virtual bool setPinUncertainty(
-			const PinContextPath& inPinPath,
-			bool inSetup,
-			bool inHold,
-			float inValue);
-
-	virtual bool setPortDelay(
-			bool inIsInput,
-			const std::string& inClockName,
-			const PinContextPath& inClockPinPath,
-			bool inClockFall,
-			bool inLevelSensitive,
-			bool inDelayRise,
-			bool inDelayFall,
-			bool inDelayMax,
-			bool inDelayMin,
-			bool inAdd,
-			bool inNetworkLatencyInc,
-			bool inSourceLatencyInc,
-			float inDelay,
-			const PinContextPath& inTargetPortPin);
-
-	virtual bool setInputTransition(
-			bool inDelayRise,
-			bool inDelayFall,
-			bool inDelayMax,
-			bool inDelayMin,
-			float inDelay,
-			const PinContextPath& inTargetPortPin);
-
-	virtual bool setPortPinLoad(
-			bool inRise,
-			bool inFall,
-			bool inMax,
-			bool inMin,
-			float inCap,
-			const PinContextPath& inTargetPortPin);
-
-	virtual bool setFalsePath(
-			bool inSetup,
-			bool inHold,
-			const std::string& inComment,
-			bool inFromRise,
-			bool inFromFall,
-			const std::vector<PinContextPath>& inFromPinPathsVec,
-			const std::vector<std::string>& inFromClocksVec,
-			const std::vector<InstContextPath>& inFromInstPathsVec,
-			bool inThroughRise,
-			bool inThroughFall,
-			const std::vector<PinContextPath>& inThroughPinPathsVec,
-			const std::vector<InstContextPath>& inThroughInstPathsVec,
-			const std::vector<NetContextPath>& inThroughNetPathsVec,
-			bool inToRise,
-			bool inToFall,
-			const std::vector<PinContextPath>& inToPinPathsVec,
-			const std::vector<std::string>& inToClocksVec,
-			const std::vector<InstContextPath>& inToInstPathsVec,
-			bool inRise,
-			bool inFall);
-
-	virtual bool setMinMaxDelay(
-			bool inMinDelayFlag,
-			float inValue,
-			const std::string& inComment,
-			bool inFromRise,
-			bool inFromFall,
-			const std::vector<PinContextPath>& inFromPinPathsVec,
-			const std::vector<std::string>& inFromClocksVec,
-			const std::vector<InstContextPath>& inFromInstPathsVec,
-			bool inThroughRise,
-			bool inThroughFall,
-			const std::vector<PinContextPath>& inThroughPinPathsVec,
-			const std::vector<InstContextPath>& inThroughInstPathsVec,
-			const std::vector<NetContextPath>& inThroughNetPathsVec,
-			bool inToRise,
-			bool inToFall,
-			const std::vector<PinContextPath>& inToPinPathsVec,
-			const std::vector<std::string>& inToClocksVec,
-			const std::vector<InstContextPath>& inToInstPathsVec,
-			bool inRise,
-			bool inFall);
-
-	virtual bool setMulticyclePath(
-			bool inSetup,
-			bool inHold,
-			bool inStart,
-			bool inEnd,
-			int inValue,
-			const std::string& inComment,
-			bool inFromRise,
-			bool inFromFall,
-			const std::vector<PinContextPath>& inFromPinPathsVec,
-			const std::vector<std::string>& inFromClocksVec,
-			const std::vector<InstContextPath>& inFromInstPathsVec,
-			bool inThroughRise,
-			bool inThroughFall,
-			const std::vector<PinContextPath>& inThroughPinPathsVec,
-			const std::vector<InstContextPath>& inThroughInstPathsVec,
-			const std::vector<NetContextPath>& inThroughNetPathsVec,
-			bool inToRise,
-			bool inToFall,
-			const std::vector<PinContextPath>& inToPinPathsVec,
-			const std::vector<std::string>& inToClocksVec,
-			const std::vector<InstContextPath>& inToInstPathsVec,
-			bool inRise,
-			bool inFall);
-
-	virtual bool setDisablePinTiming(
-			const PinContextPath& inPinPath);
-
-	virtual bool setDisableInstTiming(
-			const std::vector<const GenericInst*>& mInstContextVec,
-			const GenericPin* inFromPinPtr,
-			const GenericPin* inToPinPtr);
-
-	virtual bool setGlobalTimingDerate(
-			bool inCellDelay,
-			bool inCellCheck,
-			bool inNetDelay,
-			bool inData,
-			bool inClock,
-			bool inEarly,
-			bool inLate,
-			bool inRise,
-			bool inFall,
-			float inValue);
-
-public:
-
-	virtual bool readSPEFFile(
-			const std::string& inFileName);
-
-	virtual bool readSPEFStream(
-			std::istream& inDataStream);
-
-	virtual bool setNetsLumpCap(
-			const std::vector<NetContextPath>& inNetsDataVec,
-			const std::vector<float>& inNetCapsVec);
-
-public:
-
-	virtual bool readSdfFile(
-			const std::string& inFileName);
-
-	virtual bool readSdfStream(
-			std::istream& inDataStream);
-
-	virtual bool writeSdfFile(
-			const std::string& inFileName);
-
-public:
-
-	virtual bool loadNetlistGraph(
-			const GenericBlock* inBlockPtr);
-
-	virtual bool loadNetlistSlacks();
-
-	virtual bool getArcCritFactor(
-			const GenericPin* inSourcePinPtr,
-			const GenericPin* inSinkPinPtr,
-			bool inMinConstraint,
-			float& outCritFactor);
-
-
-	virtual bool setInterPinArcDelay(
-			const GenericPin* inSourcePinPtr,
-			const GenericPin* inSinkPinPtr,
-			bool inMin,
-			bool inMax,
-			float inValue);
-
-	virtual bool setInterPinArcDelays(
-			const std::vector<InterPinDelayData>& inArcDelaysVec,
-			bool inMin,
-			bool inMax);
-
-	virtual bool reportTiming(
-			bool inUnique,
-			bool inMin,
-			bool inMax,
-			bool inUnconstrained,
-			uint32_t inEndPointsNum,
-			uint32_t inGroupsNum,
-			std::string& outReportStr);
-
-	virtual bool getDesignStats(
-			float& outMinWNS,
-			float& outMaxWNS,
-			float& outMinTNS,
-			float& outMaxTNS);
-
-protected:
-
-	void clearGraphMapping();
-
-	void clearTimingMapping();
-
-	bool addGraphMapping(
-			const GenericBlock* inBlockPtr,
-			const std::vector<VertexIdData>& inVertexIdToDataVec,
-			const std::vector<EdgeIdData>& inEdgeIdToDataVec);
-
-private:
-
-	bool addBlockPinsInNameMap(
-			const GenericInst* inParentInstPtr,
-			const GenericBlock* inBlockPtr,
-			char inDivider,
-			const std::string& inPath,
-			std::map<std::string, GenericPin*>& outPathToPinMap);
-
-	bool matchVertexPins(
-			const std::vector<VertexIdData>& inVertexIdToDataVec,
-			const std::map<std::string, GenericPin*>& inPathToPinUMap,
-			std::vector<GenericPin*>& outVertexIdToPinVec);
-
-	bool fillPinToVertexIdMaps(
-			const std::vector<GenericPin*>& inVertexIdToPinVec,
-			const std::vector<VertexIdData>& inVertexIdToDataVec,
-			std::unordered_map<const GenericPin*, uint32_t>& mDriverPinToVertexIdUMap,
-			std::unordered_map<const GenericPin*, uint32_t>& mSinkPinToVertexIdUMap);
-
-	bool fillPinPairsToEdgeIdMap(
-			const std::vector<GenericPin*>& inVertexIdToPinVec,
-			const std::vector<EdgeIdData>& inEdgeIdToDataVec,
-			PinsPairToEdgeIdUMMap& outPinPairToEdgeIdUMap);
-
-private:
-
-
-	virtual bool collectClockShifts(
-			const std::vector<NodeTimingData>& inNodeTimingData,
-			std::vector<float>& outClockMinWorstRatVec,
-			std::vector<float>& outClockMaxWorstRatVec,
-			std::vector<float>& outClockMinWorstSlackVec,
-			std::vector<float>& outClockMaxWorstSlackVec);
-
-	virtual bool calcNodeCritFactors(
-			const std::vector<NodeTimingData>& inNodeTimingData,
-			std::vector<float>& outNodeCritFactorsVec,
-			const std::vector<float>& inWorstRatPerClockVec,
-			const std::vector<float>& inWorstSlackPerClockVec,
-			bool inMinConstraint);
-
-	virtual float calcCritFactor(
-			const NodeTimingData& inData,
-			float inGroupMinSlack,
-			float inGroupMaxSlack,
-			float inGroupMaxRat,
-			bool inMinConstraint);
-
-	float getNodeDataSlack(
-			const NodeTimingData& inData,
-			bool inMinConstraint);
-
-private:
-	template<typename _CommandType>
-	bool fillPinNetCommand(
-			_CommandType& outCommand,
-			const std::vector<GenericInst*>& inInstContextVec,
-			const GenericPin* inPinPtr,
-			const GenericNet* inNetPtr);
-
-private:
-	template<typename _ObjType>
-	bool convertContextObjPath(
-			const ObjectContextPath<_ObjType>& inObjPath,
-			ObjectContextNameData& outStringPath);
-
-	template<typename _ObjType>
-	bool convertContextNameDataVec(
-			const std::vector<ObjectContextPath<_ObjType>>& inObjPathsVec,
-			std::vector<ObjectContextNameData>& outObjContextPathsVec);
-
-
-
-	bool fillPathMesgData(
-			bool inFromRise,
-			bool inFromFall,
-			const std::vector<PinContextPath>& inFromPinPathsVec,
-			const std::vector<std::string>& inFromClocksVec,
-			const std::vector<InstContextPath>& inFromInstPathsVec,
-			bool inThroughRise,
-			bool inThroughFall,
-			const std::vector<PinContextPath>& inThroughPinPathsVec,
-			const std::vector<InstContextPath>& inThroughInstPathsVec,
-			const std::vector<NetContextPath>& inThroughNetPathsVec,
-			bool inToRise,
-			bool inToFall,
-			const std::vector<PinContextPath>& inToPinPathsVec,
-			const std::vector<std::string>& inToClocksVec,
-			const std::vector<InstContextPath>& inToInstPathsVec,
-			bool inRise,
-			bool inFall,
-			TimingPathMessageBase& outMessage);
-
-protected:
-
-	friend class StaClientIpcProtocol;
-
-
-};
-
-
-/**
- * Fills names of: net, net's parent block, pin, instance;
- */
-template<typename _CommandType>
-bool StaClientBase::fillPinNetCommand(
-		_CommandType& outCommand,
-		const std::vector<GenericInst*>& inInstContextVec,
-		const GenericPin* inPinPtr,
-		const GenericNet* inNetPtr) {
-	if(!inPinPtr || !inNetPtr)
-		return false;
-
-	GenericBlock* netParentPtr = getParentBlock(inNetPtr);
-	GenericInst* instPtr = getParentInstance(inPinPtr);
-	if(!netParentPtr || !instPtr)
-		return false;
-
-	GenericBlock* instParentPtr = getParentBlock(instPtr);
-	if(netParentPtr != instParentPtr)
-		return false;
-
-	//outCommand.mParentBlockName = getName(netParentPtr);
-	outCommand.mNetName = getName(inNetPtr);
-	outCommand.mInstName = getName(instPtr);
-	outCommand.mPinName = getName(inPinPtr);
-
-	//then adding names of all instances
-	for(auto instPtr : inInstContextVec) {
-		if(!instPtr)
-			continue;
-		outCommand.mInstContextVec.push_back(getName(instPtr));
-	}
-
-	return true;
-}
-
-
-/**
- * Fills instance hierarchy and object name of the object.
- * Does nothing and returns false if object pointer is null.
- * @param inObjPath pin path
- * @param outStringPath output path to fill
- */
-template<typename _ObjType>
-bool StaClientBase::convertContextObjPath(
-						const ObjectContextPath<_ObjType>& inObjPath,
-						ObjectContextNameData& outStringPath) {
-	if(!inObjPath.mObjectPtr)
-		return false;
-
-	for(const GenericInst* instPtr : inObjPath.mInstContextVec)
-		outStringPath.mInstContextVec.push_back(getName(instPtr));
-
-	outStringPath.mObjName = getName(inObjPath.mObjectPtr);
-	return true;
-}
-
-/**
- * Converts vector of object paths to name paths.
- * Returns false if fails to fill one of name paths
- */
-template<typename _ObjType>
-bool StaClientBase::convertContextNameDataVec(
-						const std::vector<ObjectContextPath<_ObjType>>& inObjPathsVec,
-						std::vector<ObjectContextNameData>& outObjContextPathsVec) {
-	bool isOk = true;
-	for(const ObjectContextPath<_ObjType>& inData : inObjPathsVec) {
-		ObjectContextNameData namePath;
-		if(!convertContextObjPath(inData, namePath)) {
-			isOk = false;
-			continue;
-		}
-
-		outObjContextPathsVec.push_back(namePath);
-	}
-
-	return isOk;
-}
-
-
-
-
-}
-
-
-
-#endif /* SRC_NEW_STACLIENTBASE_HPP_ */
+#ifndef SRC_NEW_STACLIENTBASE_HPP_
+#define SRC_NEW_STACLIENTBASE_HPP_
+
+
+#include "IStaClient.hpp"
+#include "StaClientIpcProtocol.hpp"
+#include "AbsNetlistProcessorBase.hpp"
+#include "GraphMappingSnapshot.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <map>
+#include <vector>
+#include <limits>
+
+
+namespace stamask {
+
+
+/**
+ * Base class to make client interface to STA via IPC connection.
+ * Takes objects, converts data to send a command via IPC and acquire execution results.
+ */
+class StaClientBase:
+		public IStaClient,
+		public AbsNetlistProcessorBase {
+
+	typedef std::pair<const GenericPin*, const GenericPin*>
+			PinsPair;
+	typedef std::pair<uint32_t, uint32_t>
+			PinIdPair;
+	typedef std::pair<uint32_t, uint32_t>
+			VertexIdPair;
+	typedef std::unordered_multimap<
+				PinsPair, uint32_t, boost::hash<PinsPair>>
+			PinsPairToEdgeIdUMMap;
+	typedef std::unordered_multimap<
+				PinIdPair, uint32_t, boost::hash<PinIdPair>>
+			PinIdPairToEdgeIdUMMap;
+	typedef std::unordered_map<
+				PinsPair, uint32_t, boost::hash<PinsPair>>
+			PinsPairToIdxUMap;
+	typedef std::map<std::string, GenericPin*>
+			StrToPinMap;
+	typedef std::pair<std::vector<const GenericInst*>, const GenericNet*>
+			NetContextKey;
+
+	/** children of visited hierarchy nodes by name to find pins by paths */
+	struct PinPathLookup {
+		std::unordered_map<const GenericInst*,
+				std::unordered_map<std::string_view, GenericInst*>> mChildInstsUMap;
+		std::unordered_map<const GenericInst*,
+				std::unordered_map<std::string_view, GenericPin*>> mInstPinsUMap;
+		std::unordered_map<std::string, GenericPin*> mTopPinsUMap;
+	};
+
+	/** pending delays of graph edge with flags of set ones */
+	struct WriteBackArcData {
+		float mMinDelay = 0;
+		float mMaxDelay = 0;
+		bool mMin = false;
+		bool mMax = false;
+	};
+
+	/** timing arrays of graph nodes, one is read while another is loaded */
+	struct NodeTimingBuffer {
+		/** timing data of graph nodes */
+		std::vector<NodeTimingData> mNodeTimingDataVec;
+
+		/** calculated min-constraint criticality of graph nodes */
+		std::vector<float> mNodeMinCritFactorsVec;
+
+		/** calculated max-constraint criticality of graph nodes */
+		std::vector<float> mNodeMaxCritFactorsVec;
+
+		/** generation of the load that filled buffer, zero if empty */
+		uint64_t mGeneration = 0;
+
+		/** amount of getters reading the buffer, it isn't refilled until zero */
+		mutable std::atomic<uint32_t> mReadersNum{0};
+	};
+
+	/** counted reader of front timing buffer, keeps it from being refilled */
+	class FrontTimingReader {
+
+		/** read buffer, nullptr if timing isn't readable */
+		const NodeTimingBuffer* mTimingPtr;
+
+	public:
+
+		explicit FrontTimingReader(const StaClientBase& inClient);
+
+		~FrontTimingReader();
+
+		FrontTimingReader(const FrontTimingReader&) = delete;
+
+		FrontTimingReader& operator=(const FrontTimingReader&) = delete;
+
+		const NodeTimingBuffer* getTiming() const;
+	};
+
+	/** marker of absent vertex or edge ID */
+	static constexpr uint32_t cNoGraphId = std::numeric_limits<uint32_t>::max();
+
+	/** protocol to interchange messages and get results */
+	StaClientIpcProtocol mProtocol;
+
+private:
+
+	/** path divides to use */
+	char mDivider;
+
+	/** mapping from hierarchical path to pins (to match timing nodes) */
+	std::map<std::string, GenericPin*> mPathToPinUMap;
+
+	/** top block to complete path mapping, that has only vertex pins after snapshot attach */
+	const GenericBlock* mPartialPathsBlockPtr;
+
+	/** mapping from edge source to timing node index */
+	std::unordered_map<const GenericPin*, uint32_t> mSourcePinToVertexIdUMap;
+
+	/** mapping from edge target to timing node index */
+	std::unordered_map<const GenericPin*, uint32_t> mSinkPinToVertexIdUMap;
+
+	/** mapping from (source, target) pair of pins to ID of timing edge  */
+	PinsPairToEdgeIdUMMap mPinPairToEdgeIdUMap;
+
+	/** pins of timing nodes by vertex ID (nullptr for absent vertex) */
+	std::vector<GenericPin*> mVertexIdToPinVec;
+
+	/** vertex IDs of timing edges by edge ID (cNoGraphId for absent edge) */
+	std::vector<VertexIdPair> mEdgeIdToVertexIdsVec;
+
+	/** flag that timing graph was loaded */
+	bool mHasGraph;
+
+	/** generation of graph mapping, changes when edge IDs may become stale */
+	uint32_t mGraphMappingGeneration;
+
+	/** edge IDs of resolved parallel edges, referenced by edge handles */
+	std::vector<uint32_t> mHandleEdgeIdsVec;
+
+	/** index of pin pair's parallel edges in handle edges table */
+	PinsPairToIdxUMap mPinPairToHandleEdgeIdxUMap;
+
+private:
+
+	/** front buffer is read, back one is filled by the next load */
+	NodeTimingBuffer mTimingBuffersArr[2];
+
+	/** index of front timing buffer */
+	std::atomic<uint32_t> mFrontTimingIdx;
+
+	/** flag that timing data was loaded */
+	std::atomic<bool> mHasGraphTiming;
+
+	/** flag that timing wasn't loaded or has changed since the load */
+	std::atomic<bool> mTimingStale;
+
+	/** amount of changes that made timing stale, load keeps stale flag if it grew */
+	std::atomic<uint64_t> mTimingStaleNum;
+
+	/** generation of the last successful timing load */
+	uint64_t mTimingGeneration;
+
+	/** flag to keep stale timing readable until the next load */
+	bool mLazyTimingInvalidation;
+
+private:
+
+	/** netlist edits that weren't uploaded yet */
+	CommandUpdateNetlist mPendingEdits;
+
+	/** indexes of context nodes in pending edits by parent node and instance */
+	std::map<std::pair<uint32_t, const GenericInst*>, uint32_t> mPendingContextToIdxMap;
+
+	/** pin paths which appear with pending edits */
+	std::vector<std::pair<std::string, GenericPin*>> mPendingAddedPinPathsVec;
+
+	/** pin paths which disappear with pending edits */
+	std::vector<std::string> mPendingRemovedPinPathsVec;
+
+private:
+
+	/** flag to hand seekable streams over in shared memory */
+	bool mSharedStreams;
+
+	/** bits of criticality factors computed by server, zero to compute them here */
+	uint8_t mServerCritFactorBits;
+
+	/** flag to load node timings with 16-bit timing values */
+	bool mPackedSlacks;
+
+private:
+
+	/** flag to keep arc delays and net caps until timing is queried */
+	bool mWriteBack;
+
+	/** pending arc delays by edge ID */
+	std::unordered_map<uint32_t, WriteBackArcData> mWriteBackArcsUMap;
+
+	/** pending lumped caps by net and its context */
+	std::map<NetContextKey, float> mWriteBackNetCapsMap;
+
+	/** guards pending updates, setters may fill them during background load */
+	mutable std::mutex mWriteBackMutex;
+
+
+public:
+
+	StaClientBase();
+
+	virtual ~StaClientBase();
+
+	virtual void printError(const std::string& inErrorStr);
+
+	virtual void setChannel(IpcChannel* inChannelPtr);
+
+	IpcChannel* getChannel();
+
+	void setSharedStreams(bool inEnabled);
+
+	bool getSharedStreams() const;
+
+	bool setServerCritFactorBits(uint8_t inFactorBits);
+
+	uint8_t getServerCritFactorBits() const;
+
+	void setPackedSlacks(bool inEnabled);
+
+	bool getPackedSlacks() const;
+
+	bool setWriteBack(bool inEnabled);
+
+	bool getWriteBack() const;
+
+	bool hasPendingWriteBack() const;
+
+	virtual bool flush();
+
+	void setLazyTimingInvalidation(bool inEnabled);
+
+	bool getLazyTimingInvalidation() const;
+
+public:
+
+	bool hasGraph() const;
+
+	bool hasTimings() const;
+
+	bool isTimingStale() const;
+
+	uint64_t getTimingGeneration() const;
+
+	bool getPinCriticality(
+			const GenericPin* inPinPtr,
+			float& outValue,
+			bool inMin,
+			bool inEdgeSourcePriority = true) const;
+			
+	bool getPinTimingData(
+			const GenericPin* inPinPtr,
+			NodeTimingData& outValue) const;
+
+	GenericPin* getVertexPin(uint32_t inVertexId) const;
+
+	bool getPinVertexId(
+			const GenericPin* inPinPtr,
+			uint32_t& outVertexId,
+			bool inEdgeSourcePriority = true) const;
+
+	bool getPinPairEdgeIds(
+			const GenericPin* inSourcePinPtr,
+			const GenericPin* inSinkPinPtr,
+			std::vector<uint32_t>& outEdgeIdsVec) const;
+
+	uint32_t getGraphMappingGeneration() const;
+
+	bool isEdgeHandleValid(const EdgeHandle& inHandle) const;
+
+	StrToPinMap::const_iterator beginPathPins() const;
+	StrToPinMap::const_iterator endPathPins() const;
+
+
+			
+public:
+
+	virtual bool exit();
+
+	virtual bool ping(
+			unsigned long inMsTimeout);
+
+	virtual void setHierarchySeparator(
+			char inSeparator);
+
+	virtual bool readLibertyFile(
+			const std::string& inFileName);
+
+	virtual bool readLibertyStream(
+			std::istream& inDataStream);
+
+	virtual bool clearLibraries();
+
+
+	virtual bool readVerilogFile(
+			const std::string& inFileName);
+
+	virtual bool readVerilogStream(
+			std::istream& inDataStream);
+
+	virtual bool linkVerilogTopBlockNetlist(
+			const std::string& inTopBlockName);
+
+
+	virtual bool linkCreateTopBlockNetlist(
+			const GenericBlock* inBlockPtr);
+
+	virtual bool connectTopContextPinNet(
+			const GenericPin* inPinPtr,
+			const GenericNet* inNetPtr);
+
+	virtual bool disconnectTopContextPinNet(
+			const GenericPin* inPinPtr,
+			const GenericNet* inNetPtr);
+
+	virtual bool connectContextPinNet(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericPin* inPinPtr,
+			const GenericNet* inNetPtr);
+
+	virtual bool disconnectContextPinNet(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericPin* inPinPtr,
+			const GenericNet* inNetPtr);
+
+	virtual bool editContextPinNets(
+			const std::vector<PinNetEditData>& inEditsVec);
+
+	virtual bool clearNetlistBlocks();
+
+public:
+
+	virtual bool queueAddContextInst(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericInst* inInstPtr);
+
+	virtual bool queueRemoveContextInst(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericInst* inInstPtr);
+
+	virtual bool queueAddContextNet(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericNet* inNetPtr);
+
+	virtual bool queueRemoveContextNet(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericNet* inNetPtr);
+
+	virtual bool queueConnectContextPinNet(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericPin* inPinPtr,
+			const GenericNet* inNetPtr);
+
+	virtual bool queueDisconnectContextPinNet(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericPin* inPinPtr,
+			const GenericNet* inNetPtr);
+
+	virtual bool uploadNetlistEdits();
+
+	bool hasPendingNetlistEdits() const;
+
+public:
+
+	virtual bool createClock(
+			const std::string& inName,
+			const std::string& inDescription,
+			const std::vector<PinContextPath>& inPinPathsVec,
+			bool inAddFlag,
+			float inPeriod,
+			const std::vector<float>& inWaveformVec);
+
+	virtual bool createGeneratedClock(
+			const std::string& inName,
+			const std::string& inDescription,
+			const PinContextPath& inMasterClockPinPath,
+			const std::string& inMasterClockName,
+			const std::vector<PinContextPath>& inPinPathsVec,
+			bool inAddFlag,
+		    int inDivideFactor,
+			int inMultiplyFactor,
+		    float inDutyCycle,
+		    bool inInvert,
+		    const std::vector<int>& inEdgesVec,
+			const std::vector<float>& inEdgeShiftsVec);
+
+	virtual bool setClockGroups(
+			const std::string& inName,
+			const std::string& inDescription,
+			bool inLogicalExclusive,
+			bool inPhysicalExclusive,
+			bool inAsynchronous,
+			bool inAllowPaths,
+			const std::vector<std::vector<std::string>>& inClockGroupsVec);
+
+	virtual bool setClockLatency(
+			bool inSource,
+			bool inMin,
+			bool inMax,
+			bool inEarly,
+			bool inLate,
+			bool inRise,
+			bool inFall,
+			float inValue,
+			const std::string& inClockName,
+			const PinContextPath& inPinPath);
+
+	virtual bool setClockToClockUncertainty(
+			const std::string& inFromClockName,
+			bool inFromRise,
+			bool inFromFall,
+			const std::string& inToClockName,
+			bool inToRise,
+			bool inToFall,
+			bool inSetup,
+			bool inHold,
+			float inValue);
+
+	virtual bool setClockUncertainty(
+			const std::string& inClockName,
+			bool inSetup,
+			bool inHold,
+			float inValue);
+
+	virtual bool setPinUncertainty(
+			const PinContextPath& inPinPath,
+			bool inSetup,
+			bool inHold,
+			float inValue);
+
+	virtual bool setPortDelay(
+			bool inIsInput,
+			const std::string& inClockName,
+			const PinContextPath& inClockPinPath,
+			bool inClockFall,
+			bool inLevelSensitive,
+			bool inDelayRise,
+			bool inDelayFall,
+			bool inDelayMax,
+			bool inDelayMin,
+			bool inAdd,
+			bool inNetworkLatencyInc,
+			bool inSourceLatencyInc,
+			float inDelay,
+			const PinContextPath& inTargetPortPin);
+
+	virtual bool setInputTransition(
+			bool inDelayRise,
+			bool inDelayFall,
+			bool inDelayMax,
+			bool inDelayMin,
+			float inDelay,
+			const PinContextPath& inTargetPortPin);
+
+	virtual bool setPortPinLoad(
+			bool inRise,
+			bool inFall,
+			bool inMax,
+			bool inMin,
+			float inCap,
+			const PinContextPath& inTargetPortPin);
+
+	virtual bool setFalsePath(
+			bool inSetup,
+			bool inHold,
+			const std::string& inComment,
+			bool inFromRise,
+			bool inFromFall,
+			const std::vector<PinContextPath>& inFromPinPathsVec,
+			const std::vector<std::string>& inFromClocksVec,
+			const std::vector<InstContextPath>& inFromInstPathsVec,
+			bool inThroughRise,
+			bool inThroughFall,
+			const std::vector<PinContextPath>& inThroughPinPathsVec,
+			const std::vector<InstContextPath>& inThroughInstPathsVec,
+			const std::vector<NetContextPath>& inThroughNetPathsVec,
+			bool inToRise,
+			bool inToFall,
+			const std::vector<PinContextPath>& inToPinPathsVec,
+			const std::vector<std::string>& inToClocksVec,
+			const std::vector<InstContextPath>& inToInstPathsVec,
+			bool inRise,
+			bool inFall);
+
+	virtual bool setMinMaxDelay(
+			bool inMinDelayFlag,
+			float inValue,
+			const std::string& inComment,
+			bool inFromRise,
+			bool inFromFall,
+			const std::vector<PinContextPath>& inFromPinPathsVec,
+			const std::vector<std::string>& inFromClocksVec,
+			const std::vector<InstContextPath>& inFromInstPathsVec,
+			bool inThroughRise,
+			bool inThroughFall,
+			const std::vector<PinContextPath>& inThroughPinPathsVec,
+			const std::vector<InstContextPath>& inThroughInstPathsVec,
+			const std::vector<NetContextPath>& inThroughNetPathsVec,
+			bool inToRise,
+			bool inToFall,
+			const std::vector<PinContextPath>& inToPinPathsVec,
+			const std::vector<std::string>& inToClocksVec,
+			const std::vector<InstContextPath>& inToInstPathsVec,
+			bool inRise,
+			bool inFall);
+
+	virtual bool setMulticyclePath(
+			bool inSetup,
+			bool inHold,
+			bool inStart,
+			bool inEnd,
+			int inValue,
+			const std::string& inComment,
+			bool inFromRise,
+			bool inFromFall,
+			const std::vector<PinContextPath>& inFromPinPathsVec,
+			const std::vector<std::string>& inFromClocksVec,
+			const std::vector<InstContextPath>& inFromInstPathsVec,
+			bool inThroughRise,
+			bool inThroughFall,
+			const std::vector<PinContextPath>& inThroughPinPathsVec,
+			const std::vector<InstContextPath>& inThroughInstPathsVec,
+			const std::vector<NetContextPath>& inThroughNetPathsVec,
+			bool inToRise,
+			bool inToFall,
+			const std::vector<PinContextPath>& inToPinPathsVec,
+			const std::vector<std::string>& inToClocksVec,
+			const std::vector<InstContextPath>& inToInstPathsVec,
+			bool inRise,
+			bool inFall);
+
+	virtual bool setDisablePinTiming(
+			const PinContextPath& inPinPath);
+
+	virtual bool setDisableInstTiming(
+			const std::vector<const GenericInst*>& mInstContextVec,
+			const GenericPin* inFromPinPtr,
+			const GenericPin* inToPinPtr);
+
+	virtual bool setGlobalTimingDerate(
+			bool inCellDelay,
+			bool inCellCheck,
+			bool inNetDelay,
+			bool inData,
+			bool inClock,
+			bool inEarly,
+			bool inLate,
+			bool inRise,
+			bool inFall,
+			float inValue);
+
+public:
+
+	virtual bool readSPEFFile(
+			const std::string& inFileName);
+
+	virtual bool readSPEFStream(
+			std::istream& inDataStream);
+
+	virtual bool setNetsLumpCap(
+			const std::vector<NetContextPath>& inNetsDataVec,
+			const std::vector<float>& inNetCapsVec);
+
+public:
+
+	virtual bool readSdfFile(
+			const std::string& inFileName);
+
+	virtual bool readSdfStream(
+			std::istream& inDataStream);
+
+	virtual bool writeSdfFile(
+			const std::string& inFileName);
+
+	virtual bool saveCheckpoint(
+			const std::string& inPathPrefix);
+
+	virtual bool loadCheckpoint(
+			const std::string& inPathPrefix);
+
+	virtual bool openCommandJournal(
+			const std::string& inFileName);
+
+	virtual void closeCommandJournal();
+
+	virtual bool replayCommandJournal();
+
+public:
+
+	virtual bool loadNetlistGraph(
+			const GenericBlock* inBlockPtr);
+
+	virtual bool loadNetlistSlacks();
+
+	virtual bool saveGraphSnapshot(
+			const std::string& inFileName,
+			uint64_t inDesignHash);
+
+	virtual bool attachGraphSnapshot(
+			const GenericBlock* inBlockPtr,
+			const std::string& inFileName,
+			uint64_t inDesignHash);
+
+	virtual bool getArcCritFactor(
+			const GenericPin* inSourcePinPtr,
+			const GenericPin* inSinkPinPtr,
+			bool inMinConstraint,
+			float& outCritFactor);
+
+
+	virtual bool setInterPinArcDelay(
+			const GenericPin* inSourcePinPtr,
+			const GenericPin* inSinkPinPtr,
+			bool inMin,
+			bool inMax,
+			float inValue);
+
+	virtual bool setInterPinArcDelays(
+			const std::vector<InterPinDelayData>& inArcDelaysVec,
+			bool inMin,
+			bool inMax);
+
+	virtual bool resolveArcs(
+			const std::vector<InterPinDelayData>& inArcsVec,
+			std::vector<EdgeHandle>& outHandlesVec);
+
+	virtual bool setArcDelays(
+			const std::vector<EdgeHandle>& inHandlesVec,
+			const std::vector<float>& inDelaysVec,
+			bool inMin,
+			bool inMax);
+
+	virtual bool setArcMinMaxDelays(
+			const std::vector<InterPinMinMaxDelayData>& inArcDelaysVec,
+			bool inMin,
+			bool inMax);
+
+	virtual bool setArcMinMaxDelays(
+			const std::vector<ArcDelayData>& inArcDelaysVec,
+			bool inMin,
+			bool inMax);
+
+	virtual bool reportTiming(
+			bool inUnique,
+			bool inMin,
+			bool inMax,
+			bool inUnconstrained,
+			uint32_t inEndPointsNum,
+			uint32_t inGroupsNum,
+			std::string& outReportStr);
+
+	virtual bool getTimingPaths(
+			bool inUnique,
+			bool inMin,
+			bool inMax,
+			bool inUnconstrained,
+			uint32_t inEndPointsNum,
+			uint32_t inGroupsNum,
+			TimingPathsData& outPaths);
+
+	virtual bool getTimingSummary(
+			float inHistMinSlack,
+			float inHistMaxSlack,
+			uint32_t inHistBinsNum,
+			TimingSummaryData& outSummary);
+
+	virtual bool getGraphSlacksSubset(
+			const std::vector<uint32_t>& inVertexIdsVec,
+			uint32_t inFanInDepth,
+			uint32_t inFanOutDepth,
+			bool inMin,
+			bool inMax,
+			float inMinCritFactor,
+			std::vector<NodeTimingData>& outNodeTimingsVec);
+
+	virtual bool getDesignStats(
+			float& outMinWNS,
+			float& outMaxWNS,
+			float& outMinTNS,
+			float& outMaxTNS);
+
+protected:
+
+	void clearGraphMapping();
+
+	void clearTimingMapping();
+
+	void markTimingStale();
+
+	void dropTimingBuffers();
+
+	NodeTimingBuffer& getBackTiming();
+
+	void waitTimingReaders(const NodeTimingBuffer& inTiming) const;
+
+	void swapTimingBuffers(uint64_t inStaleNum);
+
+	void invalidateEdgeHandles();
+
+	void clearWriteBack();
+
+	bool flushNetCaps();
+
+	bool flushArcs();
+
+	void writeBackArcsDelays(
+			const CommandSetArcsDelays& inCommand);
+
+	void writeBackArcsDelays(
+			const CommandSetArcsMinMaxDelays& inCommand);
+
+	bool flushArcsDelays(
+			std::vector<ArcDelayData>& ioArcDelaysVec,
+			bool inMin,
+			bool inMax);
+
+	void fillNetNameData(
+			const std::vector<const GenericInst*>& inInstContextVec,
+			const GenericNet* inNetPtr,
+			ObjectContextNameData& outNameData);
+
+	void clearPendingNetlistEdits();
+
+	bool getSharedStreamSize(
+			std::istream& inDataStream,
+			uint64_t& outBytesNum);
+
+	bool applyGraphChanges(
+			const GraphChangesData& inChanges);
+
+	void resetNodesTiming(const std::vector<uint32_t>& inVertexIdsVec);
+
+	bool addGraphMapping(
+			const GenericBlock* inBlockPtr,
+			const std::vector<VertexIdData>& inVertexIdToDataVec,
+			const std::vector<EdgeIdData>& inEdgeIdToDataVec);
+
+private:
+
+	bool addBlockPinsInNameMap(
+			const GenericInst* inParentInstPtr,
+			const GenericBlock* inBlockPtr,
+			char inDivider,
+			const std::string& inPath,
+			std::map<std::string, GenericPin*>& outPathToPinMap);
+
+	bool fillPathToPinMap(
+			const GenericBlock* inBlockPtr);
+
+	bool completePathToPinMap();
+
+	GenericPin* findPinByPath(
+			const GenericBlock* inBlockPtr,
+			std::string_view inPath,
+			PinPathLookup& ioLookup);
+
+	void setEdgeVertexIds(
+			const EdgeIdData& inEdgeData);
+
+	GenericPin* findVertexPin(
+			const VertexIdData& inVertexData,
+			const std::map<std::string, GenericPin*>& inPathToPinUMap) const;
+
+	bool matchVertexPins(
+			const std::vector<VertexIdData>& inVertexIdToDataVec,
+			const std::map<std::string, GenericPin*>& inPathToPinUMap,
+			std::vector<GenericPin*>& outVertexIdToPinVec);
+
+	bool fillPinToVertexIdMaps(
+			const std::vector<GenericPin*>& inVertexIdToPinVec,
+			const std::vector<VertexIdData>& inVertexIdToDataVec,
+			std::unordered_map<const GenericPin*, uint32_t>& mDriverPinToVertexIdUMap,
+			std::unordered_map<const GenericPin*, uint32_t>& mSinkPinToVertexIdUMap);
+
+	bool fillPinPairsToEdgeIdMap(
+			const std::vector<GenericPin*>& inVertexIdToPinVec,
+			const std::vector<EdgeIdData>& inEdgeIdToDataVec,
+			PinsPairToEdgeIdUMMap& outPinPairToEdgeIdUMap);
+
+private:
+
+
+	virtual bool collectClockShifts(
+			const std::vector<NodeTimingData>& inNodeTimingData,
+			std::vector<float>& outClockMinWorstRatVec,
+			std::vector<float>& outClockMaxWorstRatVec,
+			std::vector<float>& outClockMinWorstSlackVec,
+			std::vector<float>& outClockMaxWorstSlackVec);
+
+	virtual bool calcNodeCritFactors(
+			const std::vector<NodeTimingData>& inNodeTimingData,
+			std::vector<float>& outNodeCritFactorsVec,
+			const std::vector<float>& inWorstRatPerClockVec,
+			const std::vector<float>& inWorstSlackPerClockVec,
+			bool inMinConstraint);
+
+	virtual float calcCritFactor(
+			const NodeTimingData& inData,
+			float inGroupMinSlack,
+			float inGroupMaxSlack,
+			float inGroupMaxRat,
+			bool inMinConstraint);
+
+	float getNodeDataSlack(
+			const NodeTimingData& inData,
+			bool inMinConstraint);
+
+private:
+
+	uint32_t internInstContext(
+			const std::vector<GenericInst*>& inInstContextVec);
+
+	NetlistEditData* queueNetlistEdit(
+			const std::vector<GenericInst*>& inInstContextVec,
+			ENetlistEditType inEditType);
+
+	std::string getContextPath(
+			const std::vector<GenericInst*>& inInstContextVec) const;
+
+	bool queueInstPinPaths(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericInst* inInstPtr,
+			bool inAdded);
+
+	bool queuePinNetEdit(
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericPin* inPinPtr,
+			const GenericNet* inNetPtr,
+			ENetlistEditType inEditType);
+
+private:
+	template<typename _CommandType>
+	bool fillPinNetCommand(
+			_CommandType& outCommand,
+			const std::vector<GenericInst*>& inInstContextVec,
+			const GenericPin* inPinPtr,
+			const GenericNet* inNetPtr);
+
+private:
+	template<typename _ObjType>
+	bool convertContextObjPath(
+			const ObjectContextPath<_ObjType>& inObjPath,
+			ObjectContextNameData& outStringPath);
+
+	template<typename _ObjType>
+	bool convertContextNameDataVec(
+			const std::vector<ObjectContextPath<_ObjType>>& inObjPathsVec,
+			std::vector<ObjectContextNameData>& outObjContextPathsVec);
+
+
+
+	bool fillPathMesgData(
+			bool inFromRise,
+			bool inFromFall,
+			const std::vector<PinContextPath>& inFromPinPathsVec,
+			const std::vector<std::string>& inFromClocksVec,
+			const std::vector<InstContextPath>& inFromInstPathsVec,
+			bool inThroughRise,
+			bool inThroughFall,
+			const std::vector<PinContextPath>& inThroughPinPathsVec,
+			const std::vector<InstContextPath>& inThroughInstPathsVec,
+			const std::vector<NetContextPath>& inThroughNetPathsVec,
+			bool inToRise,
+			bool inToFall,
+			const std::vector<PinContextPath>& inToPinPathsVec,
+			const std::vector<std::string>& inToClocksVec,
+			const std::vector<InstContextPath>& inToInstPathsVec,
+			bool inRise,
+			bool inFall,
+			TimingPathMessageBase& outMessage);
+
+protected:
+
+	friend class StaClientIpcProtocol;
+
+
+};
+
+
+/**
+ * Fills names of: net, net's parent block, pin, instance;
+ */
+template<typename _CommandType>
+bool StaClientBase::fillPinNetCommand(
+		_CommandType& outCommand,
+		const std::vector<GenericInst*>& inInstContextVec,
+		const GenericPin* inPinPtr,
+		const GenericNet* inNetPtr) {
+	if(!inPinPtr || !inNetPtr)
+		return false;
+
+	GenericBlock* netParentPtr = getParentBlock(inNetPtr);
+	GenericInst* instPtr = getParentInstance(inPinPtr);
+	if(!netParentPtr || !instPtr)
+		return false;
+
+	GenericBlock* instParentPtr = getParentBlock(instPtr);
+	if(netParentPtr != instParentPtr)
+		return false;
+
+	//cached names are assigned, so pooled strings aren't reallocated
+	//outCommand.mParentBlockName = getName(netParentPtr);
+	outCommand.mNetName.assign(getNameView(inNetPtr));
+	outCommand.mInstName.assign(getNameView(instPtr));
+	outCommand.mPinName.assign(getNameView(inPinPtr));
+
+	//then adding names of all instances into kept pooled strings
+	size_t usedNum = 0;
+	for(auto instPtr : inInstContextVec) {
+		if(!instPtr)
+			continue;
+		nextPooledElement(outCommand.mInstContextVec, usedNum).assign(
+				getNameView(instPtr));
+	}
+	trimPooledElements(outCommand.mInstContextVec, usedNum);
+
+	return true;
+}
+
+
+/**
+ * Fills instance hierarchy and object name of the object.
+ * Does nothing and returns false if object pointer is null.
+ * @param inObjPath pin path
+ * @param outStringPath output path to fill
+ */
+template<typename _ObjType>
+bool StaClientBase::convertContextObjPath(
+						const ObjectContextPath<_ObjType>& inObjPath,
+						ObjectContextNameData& outStringPath) {
+	if(!inObjPath.mObjectPtr)
+		return false;
+
+	for(const GenericInst* instPtr : inObjPath.mInstContextVec)
+		outStringPath.mInstContextVec.push_back(getName(instPtr));
+
+	outStringPath.mObjName = getName(inObjPath.mObjectPtr);
+	return true;
+}
+
+/**
+ * Converts vector of object paths to name paths.
+ * Returns false if fails to fill one of name paths
+ */
+template<typename _ObjType>
+bool StaClientBase::convertContextNameDataVec(
+						const std::vector<ObjectContextPath<_ObjType>>& inObjPathsVec,
+						std::vector<ObjectContextNameData>& outObjContextPathsVec) {
+	bool isOk = true;
+	for(const ObjectContextPath<_ObjType>& inData : inObjPathsVec) {
+		ObjectContextNameData namePath;
+		if(!convertContextObjPath(inData, namePath)) {
+			isOk = false;
+			continue;
+		}
+
+		outObjContextPathsVec.push_back(namePath);
+	}
+
+	return isOk;
+}
+
+
+
+
+}
+
+
+
+#endif /* SRC_NEW_STACLIENTBASE_HPP_ */
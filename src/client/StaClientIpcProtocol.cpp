@@ -1,555 +1,1053 @@
-
-#include "StaClientIpcProtocol.hpp"
-#include "StaClientBase.hpp"
-
-namespace stamask {
-
-/**
- * Default constructor.
- * Sets channel to nullptr.
- */
-StaClientIpcProtocol::StaClientIpcProtocol():
-	mChannelPtr(nullptr),
-	mCallbackPtr(nullptr) {}
-
-/**
- * Deletes channel if it isn't null.
- */
-StaClientIpcProtocol::~StaClientIpcProtocol() {
-	if(mChannelPtr)
-		delete mChannelPtr;
-}
-
-/**
- * Sets channel inside the protocol.
- * Accepts even the nullptr.
- * Protocol deletes previously set channel.
- */
-void StaClientIpcProtocol::setChannel(
-						IpcChannel* inChannelPtr) {
-	if(mChannelPtr)
-		delete mChannelPtr;
-
-	mChannelPtr = inChannelPtr;
-}
-
-/**
- * Returns set up channel.
- * @return channel pointer
- */
-IpcChannel* StaClientIpcProtocol::getChannel() {
-	return mChannelPtr;
-}
-
-
-/**
- * Sets callback inside the protocol.
- * Accepts even the nullptr.
- * @param inCallbackPtr callback
- */
-void StaClientIpcProtocol::setCallback(
-						StaClientBase* inCallbackPtr) {
-	mCallbackPtr = inCallbackPtr;
-}
-
-/**
- * Returns set up callback.
- * @return callback pointer
- */
-StaClientBase* StaClientIpcProtocol::getCallback() {
-	return mCallbackPtr;
-}
-
-/**
- * Returns empty string.
- * Error messages are passed in callback object.
- */
-std::string StaClientIpcProtocol::getExecMessage() const {
-	return "";
-}
-
-
-/**
- * Sends command to set hierarchy separator.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetHierarhySeparator& inCommand) {
-	return executeWithSimpleResponse<CommandSetHierarhySeparator>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command for STA engine to exit.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandExit& inCommand) {
-	return executeWithSimpleResponse<CommandExit>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to ping STA engine.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandPing& inCommand) {
-	return executeWithSimpleResponse<CommandPing>(
-			inCommand, mCallbackPtr, inCommand.mMsTimeout);
-}
-
-/**
- * Sends command to read liberty file.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandReadLibertyFile& inCommand) {
-	return executeWithSimpleResponse<CommandReadLibertyFile>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to read liberty string.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandReadLibertyStream& inCommand) {
-	return executeWithSimpleResponse<CommandReadLibertyStream>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to clear liberty libraries.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandClearLibs& inCommand) {
-	return executeWithSimpleResponse<CommandClearLibs>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to read verilog file.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandReadVerilogFile& inCommand) {
-	return executeWithSimpleResponse<CommandReadVerilogFile>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to read verilog string.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandReadVerilogStream& inCommand) {
-	return executeWithSimpleResponse<CommandReadVerilogStream>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to link netlist with top block.
- * Receives back response with entities of timing graph.
- * Uses callback to set-up mapping for edges and vertexes.
- * See \link executeWithGraphResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandLinkTop& inCommand) {
-	return executeWithSimpleResponse<CommandLinkTop>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to clear netlist and it's blocks.
- * Clears timing graph mappings in callback on success.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandClearNetlistBlocks& inCommand) {
-	if(!executeWithSimpleResponse<CommandClearNetlistBlocks>(
-			inCommand, mCallbackPtr))
-		return false;
-
-	mCallbackPtr->clearGraphMapping();
-	return true;
-}
-
-/**
- * Sends command to create entire netlist.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandCreateNetlist& inCommand) {
-	return executeWithSimpleResponse<CommandCreateNetlist>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to get graph data.
- * On receive writes out graph data.
- * Returns false on fail.
- */
-bool StaClientIpcProtocol::execute(
-		const CommandGetGraphData& inCommand,
-		std::vector<VertexIdData>& outVertexIdToDataVec,
-		std::vector<EdgeIdData>& outEdgeIdToDataVec) {
-
-	ResponseGraphMap response;
-	if(!sendReceiveCommand(inCommand, response))
-		return false;
-
-	if(!processResponseStatus(response, mCallbackPtr))
-		return false;
-
-	std::swap(outVertexIdToDataVec, response.mVertexIdToDataVec);
-	std::swap(outEdgeIdToDataVec, response.mEdgeIdToDataVec);
-
-	return true;
-}
-
-/**
- * Sends command to get timing data of graph vertexes.
- * On receive writes out timing data.
- * Returns false on fail.
- */
-bool StaClientIpcProtocol::execute(
-		const CommandGetGraphSlacksData& inCommand,
-		std::vector<NodeTimingData>& outNodeTimingsVec) {
-	ResponseGraphSlacks response;
-	if(!sendReceiveCommand(inCommand, response))
-		return false;
-
-	if(!processResponseStatus(response, mCallbackPtr))
-		return false;
-
-	std::swap(outNodeTimingsVec, response.mNodeTimingsVec);
-
-	return true;
-}
-
-/**
- * Sends command to set delays of several edges in a graph.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetArcsDelays& inCommand) {
-	return executeWithSimpleResponse<CommandSetArcsDelays>(
-			inCommand, mCallbackPtr);
-}
-
-
-
-/**
- * Sends command to connect net and instance/pin.
- * Client part must update graph data manually afterwards.
- * See \link executeWithGraphResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandConnectContextPinNet& inCommand) {
-	return executeWithSimpleResponse<CommandConnectContextPinNet>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to disconnect net and instance/pin.
- * Client part must update graph data manually afterwards.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandDisconnectContextPinNet& inCommand) {
-	return executeWithSimpleResponse<CommandDisconnectContextPinNet>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to read SPEF file.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandReadSpefFile& inCommand) {
-	return executeWithSimpleResponse<CommandReadSpefFile>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to read SPEF string.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandReadSpefStream& inCommand) {
-	return executeWithSimpleResponse<CommandReadSpefStream>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set summary capacitance of group of nets .
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetGroupNetCap& inCommand) {
-	return executeWithSimpleResponse<CommandSetGroupNetCap>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to read SDF file.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandReadSdfFile& inCommand) {
-	return executeWithSimpleResponse<CommandReadSdfFile>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to read SDF string.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandReadSdfStream& inCommand) {
-	return executeWithSimpleResponse<CommandReadSdfStream>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to write SDF file.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandWriteSdfFile& inCommand) {
-	return executeWithSimpleResponse<CommandWriteSdfFile>(
-			inCommand, mCallbackPtr);
-}
-
-
-
-
-/**
- * Sends command to report timing paths.
- * Uses string in status response as holder of report.
- * Returns false if channel or callback is nullptr.
- * Returns false if response isn't OK.
- * @param inCommand command send
- * @param outReportStr string to write the report
- * @return execution status
- */
-bool StaClientIpcProtocol::execute(
-		const CommandReportTiming& inCommand,
-		std::string& outReportStr) {
-	if(!mChannelPtr || !mCallbackPtr)
-		return false;
-
-	ResponseCommExecStatus status;
-	if(!sendReceiveCommand(inCommand, status))
-		return false;
-
-	if(!processResponseStatus(status, mCallbackPtr))
-		return false;
-
-	outReportStr = status.mStr;
-
-	return true;
-}
-
-/**
- * Sends command to get main timing stats.
- * Returns false if channel or callback is nullptr.
- * Returns false if response isn't OK.
- * @param inCommand command send
- * @param outMinWNS worst slack for min condition
- * @param outMinWNS worst slack for max condition
- * @param outMinWNS total negative slack for min condition
- * @param outMinWNS total negative slack for max condition
- * @return execution status
- */
-bool StaClientIpcProtocol::execute(
-		const CommandGetDesignStats& inCommand,
-		float& outMinWNS,
-		float& outMaxWNS,
-		float& outMinTNS,
-		float& outMaxTNS) {
-	if(!mChannelPtr || !mCallbackPtr)
-		return false;
-
-	ResponseDesignStats status;
-	if(!sendReceiveCommand(inCommand, status))
-		return false;
-
-	if(!processResponseStatus(status, mCallbackPtr))
-		return false;
-
-	outMinWNS = status.mMinWslack;
-	outMaxWNS = status.mMaxWslack;
-	outMinTNS = status.mMinTNS;
-	outMaxTNS = status.mMaxTNS;
-
-	return true;
-}
-
-
-/**
- * Sends command to create clock.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandCreateClock& inCommand) {
-	return executeWithSimpleResponse<CommandCreateClock>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to create generated clock.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandCreateGenClock& inCommand) {
-	return executeWithSimpleResponse<CommandCreateGenClock>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set clock groups.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetClockGroups& inCommand) {
-	return executeWithSimpleResponse<CommandSetClockGroups>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set clock latency.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetClockLatency& inCommand) {
-	return executeWithSimpleResponse<CommandSetClockLatency>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set uncertainty between two clocks.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetInterClockUncertainty& inCommand) {
-	return executeWithSimpleResponse<CommandSetInterClockUncertainty>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set uncertainty of single clock.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetSingleClockUncertainty& inCommand) {
-	return executeWithSimpleResponse<CommandSetSingleClockUncertainty>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set uncertainty of single pin.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetSinglePinUncertainty& inCommand) {
-	return executeWithSimpleResponse<CommandSetSinglePinUncertainty>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set port delay.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetPortDelay& inCommand) {
-	return executeWithSimpleResponse<CommandSetPortDelay>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set input port transition.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetInPortTransition& inCommand) {
-	return executeWithSimpleResponse<CommandSetInPortTransition>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set port load.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetPortPinLoad& inCommand) {
-	return executeWithSimpleResponse<CommandSetPortPinLoad>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set false paths.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetFalsePath& inCommand) {
-	return executeWithSimpleResponse<CommandSetFalsePath>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set min/max delay.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetMinMaxDelay& inCommand) {
-	return executeWithSimpleResponse<CommandSetMinMaxDelay>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set multicycle path.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetMulticyclePath& inCommand) {
-	return executeWithSimpleResponse<CommandSetMulticyclePath>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to disable timing of single pin.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandDisableSinglePinTiming& inCommand) {
-	return executeWithSimpleResponse<CommandDisableSinglePinTiming>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to disable inter-pin timing of an instance.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandDisableInstTiming& inCommand) {
-	return executeWithSimpleResponse<CommandDisableInstTiming>(
-			inCommand, mCallbackPtr);
-}
-
-/**
- * Sends command to set global timing derate.
- * See \link executeWithSimpleResponse
- */
-bool StaClientIpcProtocol::execute(
-		const CommandSetGlobalTimingDerate& inCommand) {
-	return executeWithSimpleResponse<CommandSetGlobalTimingDerate>(
-			inCommand, mCallbackPtr);
-}
-
-
-}
-
-
+
+#include "StaClientIpcProtocol.hpp"
+#include "StaClientBase.hpp"
+#include "common/ContentHash.hpp"
+#include "common/NodeTimingCalc.hpp"
+
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/exceptions.hpp>
+
+#include <random>
+
+
+namespace bi = boost::interprocess;
+
+namespace stamask {
+
+/**
+ * Default constructor.
+ * Sets channel to nullptr.
+ */
+StaClientIpcProtocol::StaClientIpcProtocol():
+	mChannelPtr(nullptr),
+	mCallbackPtr(nullptr),
+	mMessagePool(),
+	mJournal() {}
+
+/**
+ * Deletes channel if it isn't null.
+ */
+StaClientIpcProtocol::~StaClientIpcProtocol() {
+	if(mChannelPtr)
+		delete mChannelPtr;
+}
+
+/**
+ * Sets channel inside the protocol.
+ * Accepts even the nullptr.
+ * Protocol deletes previously set channel.
+ */
+void StaClientIpcProtocol::setChannel(
+						IpcChannel* inChannelPtr) {
+	if(mChannelPtr)
+		delete mChannelPtr;
+
+	mChannelPtr = inChannelPtr;
+}
+
+/**
+ * Returns set up channel.
+ * @return channel pointer
+ */
+IpcChannel* StaClientIpcProtocol::getChannel() {
+	return mChannelPtr;
+}
+
+
+/**
+ * Sets callback inside the protocol.
+ * Accepts even the nullptr.
+ * @param inCallbackPtr callback
+ */
+void StaClientIpcProtocol::setCallback(
+						StaClientBase* inCallbackPtr) {
+	mCallbackPtr = inCallbackPtr;
+}
+
+/**
+ * Returns set up callback.
+ * @return callback pointer
+ */
+StaClientBase* StaClientIpcProtocol::getCallback() {
+	return mCallbackPtr;
+}
+
+/**
+ * Returns empty string.
+ * Error messages are passed in callback object.
+ */
+std::string StaClientIpcProtocol::getExecMessage() const {
+	return "";
+}
+
+
+/**
+ * Opens journal file to record executed commands that change STA state.
+ * Commands of existing journal are kept, so journal of crashed session
+ * can be replayed on a new server.
+ * @param inFileName journal file name
+ * @return operation success
+ */
+bool StaClientIpcProtocol::openJournal(const std::string& inFileName) {
+	return mJournal.openJournal(inFileName);
+}
+
+/**
+ * Stops recording of commands, journal file stays on disk.
+ */
+void StaClientIpcProtocol::closeJournal() {
+	mJournal.closeJournal();
+	mJournal.clear();
+}
+
+/**
+ * Checks that commands are recorded in journal.
+ * @return flag of open journal
+ */
+bool StaClientIpcProtocol::isJournalOpen() const {
+	return mJournal.isJournalOpen();
+}
+
+/**
+ * Returns journal of recorded commands.
+ * @return command journal
+ */
+const CommandLog& StaClientIpcProtocol::getJournal() const {
+	return mJournal;
+}
+
+/**
+ * Drops superseded commands from journal and rewrites journal file.
+ * @return operation success
+ */
+bool StaClientIpcProtocol::compactJournal() {
+	return mJournal.compact();
+}
+
+/**
+ * Sends compacted journal to the server in batches of commands.
+ * Commands are read from journal file, batches are limited
+ * by \link cReplayBatchBytes to fit in messages.
+ * Is used to restore state of a fresh server after restart.
+ * @return success status
+ */
+bool StaClientIpcProtocol::replayJournal() {
+	if(!mJournal.isJournalOpen() || !mJournal.compact())
+		return false;
+
+	CommandLog replayLog;
+	if(!replayLog.load(mJournal.getJournalFileName()))
+		return false;
+
+	CommandReplayCommandLog command;
+	std::size_t entryIdx = 0;
+	while(entryIdx < replayLog.size()) {
+		if(!replayLog.saveBatchToString(entryIdx, cReplayBatchBytes, command.mStr) ||
+				!execute(command))
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * Reports failed write of command journal via callback.
+ */
+void StaClientIpcProtocol::printJournalError() {
+	if(mCallbackPtr)
+		mCallbackPtr->printError("failed to write command journal " +
+				mJournal.getJournalFileName());
+}
+
+/**
+ * Creates shared memory object of given size with random name and maps it.
+ * Creation is retried with other name if object already exists.
+ * @param inBytesNum size of the object
+ * @param outShmName name of created object
+ * @param outRegion region of mapped object
+ * @return success status
+ */
+static bool createSharedStream(
+		uint64_t inBytesNum,
+		std::string& outShmName,
+		bi::mapped_region& outRegion) {
+	std::random_device randDevice;
+	for(unsigned attemptIdx = 0;
+			attemptIdx < StaClientIpcProtocol::cSharedStreamNameAttempts;
+			attemptIdx++) {
+		uint64_t nameId = (uint64_t(randDevice()) << 32) | randDevice();
+		outShmName = "stalink_stream_" + std::to_string(nameId);
+
+		bool created = false;
+		try {
+			bi::shared_memory_object shdMem(
+					bi::create_only, outShmName.c_str(), bi::read_write);
+			created = true;
+			shdMem.truncate(inBytesNum);
+			outRegion = bi::mapped_region(shdMem, bi::read_write);
+			return true;
+		} catch(const bi::interprocess_exception& ex) {
+			if(created) {
+				bi::shared_memory_object::remove(outShmName.c_str());
+				return false;
+			}
+
+			if(ex.get_error_code() != bi::already_exists_error)
+				return false;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Asks server whether it has stored text of stream command.
+ * Server executes the command from parsed library cache or stored text,
+ * so found flag means successful execution.
+ * Flag isn't set if stored streams weren't negotiated with the server.
+ * @param inStreamMesgType type of stream command
+ * @param inContentHash content hash of the text
+ * @param inBytesNum size of the text
+ * @param outFound flag that server executed stored command
+ * @return success status
+ */
+bool StaClientIpcProtocol::lookupStoredStream(
+		EMessageType inStreamMesgType,
+		const std::string& inContentHash,
+		uint64_t inBytesNum,
+		bool& outFound) {
+	outFound = false;
+	if(!mChannelPtr)
+		return false;
+
+	if(!(mChannelPtr->getFeatureFlags() & eChannelFeatureStoredStreams))
+		return true;
+
+	CommandReadStoredStream storedCommand;
+	storedCommand.mStreamMesgType = inStreamMesgType;
+	storedCommand.mContentHash = inContentHash;
+	storedCommand.mBytesNum = inBytesNum;
+
+	ResponseCommExecStatus& status =
+			mMessagePool.acquire<ResponseCommExecStatus>();
+	if(!sendReceiveCommand(storedCommand, status))
+		return false;
+
+	if(status.mExecStatus == EMessageStatus::eMessageStatusNotFound ||
+			status.mExecStatus == EMessageStatus::eMessageStatusUnsupported)
+		return true;
+
+	if(!processResponseStatus(status, mCallbackPtr))
+		return false;
+
+	outFound = true;
+	return true;
+}
+
+/**
+ * Executes stream command with text handed over in shared memory object.
+ * Reads given amount of bytes from the stream right into mapped memory,
+ * server maps the same object instead of getting text in the message
+ * and removes the object right after mapping.
+ * Stored text is looked up by content hash before handing the object over.
+ * Text is sent in the regular stream command if shared streams
+ * weren't negotiated, object can't be created or server can't map it.
+ * @param inDataStream stream to read
+ * @param inBytesNum amount of bytes to read
+ * @return success status
+ */
+template<typename _StreamCommand>
+bool StaClientIpcProtocol::executeSharedStream(
+		std::istream& inDataStream,
+		uint64_t inBytesNum) {
+	_StreamCommand streamCommand;
+	CommandReadSharedStream command;
+	command.mStreamMesgType = _StreamCommand::cMesgType;
+	command.mBytesNum = inBytesNum;
+
+	bi::mapped_region region;
+	if(!(mChannelPtr->getFeatureFlags() & eChannelFeatureSharedStreams) ||
+			!createSharedStream(inBytesNum, command.mShmName, region)) {
+		streamCommand.mStr = std::string(
+				std::istreambuf_iterator<char>(inDataStream), {});
+		return executeStoredStream(
+				streamCommand, hashContent(streamCommand.mStr));
+	}
+
+	char* textPtr = static_cast<char*>(region.get_address());
+	bool ok = bool(inDataStream.read(textPtr, inBytesNum));
+	bool found = false;
+	if(ok) {
+		command.mContentHash = hashContent(textPtr, inBytesNum);
+		ok = lookupStoredStream(command.mStreamMesgType,
+				command.mContentHash, inBytesNum, found);
+	}
+
+	bool sendText = false;
+	if(ok && !found) {
+		ResponseCommExecStatus& status =
+				mMessagePool.acquire<ResponseCommExecStatus>();
+		ok = sendReceiveCommand(command, status);
+		if(ok && (status.mExecStatus ==
+						EMessageStatus::eMessageStatusNotFound ||
+				status.mExecStatus ==
+						EMessageStatus::eMessageStatusUnsupported)) {
+			streamCommand.mStr.assign(textPtr, inBytesNum);
+			sendText = true;
+		} else {
+			ok = ok && processResponseStatus(status, mCallbackPtr);
+		}
+	}
+
+	if(ok && !sendText)
+		recordStreamText<_StreamCommand>(textPtr, inBytesNum);
+
+	region = bi::mapped_region();
+	bi::shared_memory_object::remove(command.mShmName.c_str());
+
+	if(sendText)
+		return execute(streamCommand);
+
+	return ok;
+}
+
+/**
+ * Executes stream command of given type with text in shared memory.
+ * See \link executeSharedStream
+ * @param inStreamMesgType type of stream command
+ * @param inDataStream stream to read
+ * @param inBytesNum amount of bytes to read
+ * @return success status
+ */
+bool StaClientIpcProtocol::executeSharedStream(
+		EMessageType inStreamMesgType,
+		std::istream& inDataStream,
+		uint64_t inBytesNum) {
+	if(!mChannelPtr || !mCallbackPtr)
+		return false;
+
+	switch(inStreamMesgType) {
+	case EMessageType::EMessageTypeReadLibStream:
+		return executeSharedStream<CommandReadLibertyStream>(
+				inDataStream, inBytesNum);
+	case EMessageType::EMessageTypeReadVerilogStream:
+		return executeSharedStream<CommandReadVerilogStream>(
+				inDataStream, inBytesNum);
+	case EMessageType::EMessageTypeReadSpefStream:
+		return executeSharedStream<CommandReadSpefStream>(
+				inDataStream, inBytesNum);
+	case EMessageType::EMessageTypeReadSdfStream:
+		return executeSharedStream<CommandReadSdfStream>(
+				inDataStream, inBytesNum);
+	default:
+		mCallbackPtr->printError("unsupported stream command " +
+				std::to_string(inStreamMesgType));
+		return false;
+	}
+}
+
+/**
+ * Sends batch of logged commands to execute.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReplayCommandLog& inCommand) {
+	return executeWithSimpleResponse<CommandReplayCommandLog>(
+			inCommand, mCallbackPtr);
+}
+
+
+/**
+ * Sends command to set hierarchy separator.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetHierarhySeparator& inCommand) {
+	return executeWithSimpleResponse<CommandSetHierarhySeparator>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command for STA engine to exit.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandExit& inCommand) {
+	return executeWithSimpleResponse<CommandExit>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to ping STA engine.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandPing& inCommand) {
+	return executeWithSimpleResponse<CommandPing>(
+			inCommand, mCallbackPtr, inCommand.mMsTimeout);
+}
+
+/**
+ * Sends command to read liberty file.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReadLibertyFile& inCommand) {
+	return executeWithSimpleResponse<CommandReadLibertyFile>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to read liberty string.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReadLibertyStream& inCommand) {
+	return executeWithSimpleResponse<CommandReadLibertyStream>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to read cached liberty.
+ * Any status except OK means cache miss, so it isn't printed as an error.
+ * Command isn't journaled, since it has no text to replay,
+ * \link executeStoredStream is used to read liberty with journal.
+ * Returns false if library wasn't read from cache.
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReadCachedLiberty& inCommand) {
+	if(!mChannelPtr)
+		return false;
+
+	ResponseCommExecStatus& status =
+			mMessagePool.acquire<ResponseCommExecStatus>();
+	if(!sendReceiveCommand(inCommand, status))
+		return false;
+
+	return status.mExecStatus == EMessageStatus::eMessageStatusOk;
+}
+
+/**
+ * Sends command to clear liberty libraries.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandClearLibs& inCommand) {
+	return executeWithSimpleResponse<CommandClearLibs>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to read verilog file.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReadVerilogFile& inCommand) {
+	return executeWithSimpleResponse<CommandReadVerilogFile>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to read verilog string.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReadVerilogStream& inCommand) {
+	return executeWithSimpleResponse<CommandReadVerilogStream>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to link netlist with top block.
+ * Receives back response with entities of timing graph.
+ * Uses callback to set-up mapping for edges and vertexes.
+ * See \link executeWithGraphResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandLinkTop& inCommand) {
+	return executeWithSimpleResponse<CommandLinkTop>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to clear netlist and it's blocks.
+ * Clears timing graph mappings in callback on success.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandClearNetlistBlocks& inCommand) {
+	if(!executeWithSimpleResponse<CommandClearNetlistBlocks>(
+			inCommand, mCallbackPtr))
+		return false;
+
+	mCallbackPtr->clearGraphMapping();
+	return true;
+}
+
+/**
+ * Sends command to create entire netlist.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandCreateNetlist& inCommand) {
+	return executeWithSimpleResponse<CommandCreateNetlist>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to get graph data.
+ * On receive writes out graph data.
+ * Returns false on fail.
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandGetGraphData& inCommand,
+		std::vector<VertexIdData>& outVertexIdToDataVec,
+		std::vector<EdgeIdData>& outEdgeIdToDataVec) {
+
+	ResponseGraphMap response;
+	if(!sendReceiveCommand(inCommand, response))
+		return false;
+
+	if(!processResponseStatus(response, mCallbackPtr))
+		return false;
+
+	std::swap(outVertexIdToDataVec, response.mVertexIdToDataVec);
+	std::swap(outEdgeIdToDataVec, response.mEdgeIdToDataVec);
+
+	return true;
+}
+
+/**
+ * Sends command to get fingerprint of timing graph.
+ * On receive writes out fingerprint data.
+ * Returns false on fail.
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandGetGraphFingerprint& inCommand,
+		GraphFingerprintData& outFingerprint) {
+	ResponseGraphFingerprint response;
+	if(!sendReceiveCommand(inCommand, response))
+		return false;
+
+	if(!processResponseStatus(response, mCallbackPtr))
+		return false;
+
+	outFingerprint = response.mFingerprint;
+
+	return true;
+}
+
+/**
+ * Sends command to get timing data of graph vertexes.
+ * On receive writes out timing data.
+ * Returns false on fail.
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandGetGraphSlacksData& inCommand,
+		std::vector<NodeTimingData>& outNodeTimingsVec) {
+	ResponseGraphSlacks response;
+	if(!sendReceiveCommand(inCommand, response))
+		return false;
+
+	if(!processResponseStatus(response, mCallbackPtr))
+		return false;
+
+	std::swap(outNodeTimingsVec, response.mNodeTimingsVec);
+
+	return true;
+}
+
+/**
+ * Sends command to get quantized criticality factors of all nodes.
+ * Factors are calculated by the protocol on server side,
+ * so it isn't a part of message executor interface.
+ * Returns false on fail.
+ * @param inCommand command send
+ * @param outFactors quantized factors to fill
+ * @return execution status
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandGetCritFactors& inCommand,
+		CritFactorsData& outFactors) {
+	ResponseCritFactors response;
+	if(!sendReceiveCommand(inCommand, response))
+		return false;
+
+	if(!processResponseStatus(response, mCallbackPtr))
+		return false;
+
+	std::swap(outFactors, response.mFactors);
+
+	return true;
+}
+
+/**
+ * Sends command to get packed timing data of all nodes.
+ * On receive unpacks it in node timing data.
+ * Packing is done by the protocol on server side,
+ * so it isn't a part of message executor interface.
+ * Returns false on fail.
+ * @param inCommand command send
+ * @param outNodeTimingsVec nodes timing data to fill
+ * @return execution status
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandGetPackedGraphSlacks& inCommand,
+		std::vector<NodeTimingData>& outNodeTimingsVec) {
+	ResponsePackedGraphSlacks response;
+	if(!sendReceiveCommand(inCommand, response))
+		return false;
+
+	if(!processResponseStatus(response, mCallbackPtr))
+		return false;
+
+	return unpackNodeTimings(response.mPackedTimings, outNodeTimingsVec);
+}
+
+/**
+ * Sends command to set delays of several edges in a graph.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetArcsDelays& inCommand) {
+	return executeWithSimpleResponse<CommandSetArcsDelays>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set min and max delays of several edges in a graph.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetArcsMinMaxDelays& inCommand) {
+	return executeWithSimpleResponse<CommandSetArcsMinMaxDelays>(
+			inCommand, mCallbackPtr);
+}
+
+
+
+/**
+ * Sends command to connect net and instance/pin.
+ * Client part must update graph data manually afterwards.
+ * See \link executeWithGraphResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandConnectContextPinNet& inCommand) {
+	return executeWithSimpleResponse<CommandConnectContextPinNet>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to disconnect net and instance/pin.
+ * Client part must update graph data manually afterwards.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandDisconnectContextPinNet& inCommand) {
+	return executeWithSimpleResponse<CommandDisconnectContextPinNet>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to apply batch of netlist edits.
+ * On receive writes out changes of timing graph.
+ * Returns false on fail.
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandUpdateNetlist& inCommand,
+		GraphChangesData& outChanges) {
+	ResponseGraphChanges response;
+	if(!sendReceiveCommand(inCommand, response))
+		return false;
+
+	if(!processResponseStatus(response, mCallbackPtr))
+		return false;
+
+	recordCommand(inCommand);
+	std::swap(outChanges, response.mChanges);
+
+	return true;
+}
+
+/**
+ * Sends command to read SPEF file.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReadSpefFile& inCommand) {
+	return executeWithSimpleResponse<CommandReadSpefFile>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to read SPEF string.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReadSpefStream& inCommand) {
+	return executeWithSimpleResponse<CommandReadSpefStream>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set summary capacitance of group of nets .
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetGroupNetCap& inCommand) {
+	return executeWithSimpleResponse<CommandSetGroupNetCap>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to read SDF file.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReadSdfFile& inCommand) {
+	return executeWithSimpleResponse<CommandReadSdfFile>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to read SDF string.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReadSdfStream& inCommand) {
+	return executeWithSimpleResponse<CommandReadSdfStream>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to write SDF file.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandWriteSdfFile& inCommand) {
+	return executeWithSimpleResponse<CommandWriteSdfFile>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to save checkpoint.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSaveCheckpoint& inCommand) {
+	return executeWithSimpleResponse<CommandSaveCheckpoint>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to load checkpoint.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandLoadCheckpoint& inCommand) {
+	return executeWithSimpleResponse<CommandLoadCheckpoint>(
+			inCommand, mCallbackPtr);
+}
+
+
+
+
+/**
+ * Sends command to report timing paths.
+ * Uses string in status response as holder of report.
+ * Returns false if channel or callback is nullptr.
+ * Returns false if response isn't OK.
+ * @param inCommand command send
+ * @param outReportStr string to write the report
+ * @return execution status
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandReportTiming& inCommand,
+		std::string& outReportStr) {
+	if(!mChannelPtr || !mCallbackPtr)
+		return false;
+
+	ResponseCommExecStatus status;
+	if(!sendReceiveCommand(inCommand, status))
+		return false;
+
+	if(!processResponseStatus(status, mCallbackPtr))
+		return false;
+
+	outReportStr = status.mStr;
+
+	return true;
+}
+
+/**
+ * Sends command to get critical timing paths.
+ * On receive writes out paths data.
+ * Returns false on fail.
+ * @param inCommand command send
+ * @param outPaths paths data to fill
+ * @return execution status
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandGetTimingPaths& inCommand,
+		TimingPathsData& outPaths) {
+	ResponseTimingPaths response;
+	if(!sendReceiveCommand(inCommand, response))
+		return false;
+
+	if(!processResponseStatus(response, mCallbackPtr))
+		return false;
+
+	std::swap(outPaths, response.mPaths);
+
+	return true;
+}
+
+/**
+ * Sends command to get endpoint slack summary.
+ * Summary is aggregated by the protocol on server side,
+ * so it isn't a part of message executor interface.
+ * Returns false on fail.
+ * @param inCommand command send
+ * @param outSummary summary to fill
+ * @return execution status
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandGetTimingSummary& inCommand,
+		TimingSummaryData& outSummary) {
+	ResponseTimingSummary response;
+	if(!sendReceiveCommand(inCommand, response))
+		return false;
+
+	if(!processResponseStatus(response, mCallbackPtr))
+		return false;
+
+	std::swap(outSummary, response.mSummary);
+
+	return true;
+}
+
+/**
+ * Sends command to get timing data of a subset of graph nodes.
+ * Subset is selected by the protocol on server side,
+ * so it isn't a part of message executor interface.
+ * Returns false on fail.
+ * @param inCommand command send
+ * @param outNodeTimingsVec timing data of selected nodes to fill
+ * @return execution status
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandGetGraphSlacksSubset& inCommand,
+		std::vector<NodeTimingData>& outNodeTimingsVec) {
+	ResponseGraphSlacks response;
+	if(!sendReceiveCommand(inCommand, response))
+		return false;
+
+	if(!processResponseStatus(response, mCallbackPtr))
+		return false;
+
+	std::swap(outNodeTimingsVec, response.mNodeTimingsVec);
+
+	return true;
+}
+
+/**
+ * Sends command to get main timing stats.
+ * Returns false if channel or callback is nullptr.
+ * Returns false if response isn't OK.
+ * @param inCommand command send
+ * @param outMinWNS worst slack for min condition
+ * @param outMinWNS worst slack for max condition
+ * @param outMinWNS total negative slack for min condition
+ * @param outMinWNS total negative slack for max condition
+ * @return execution status
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandGetDesignStats& inCommand,
+		float& outMinWNS,
+		float& outMaxWNS,
+		float& outMinTNS,
+		float& outMaxTNS) {
+	if(!mChannelPtr || !mCallbackPtr)
+		return false;
+
+	ResponseDesignStats status;
+	if(!sendReceiveCommand(inCommand, status))
+		return false;
+
+	if(!processResponseStatus(status, mCallbackPtr))
+		return false;
+
+	outMinWNS = status.mMinWslack;
+	outMaxWNS = status.mMaxWslack;
+	outMinTNS = status.mMinTNS;
+	outMaxTNS = status.mMaxTNS;
+
+	return true;
+}
+
+
+/**
+ * Sends command to create clock.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandCreateClock& inCommand) {
+	return executeWithSimpleResponse<CommandCreateClock>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to create generated clock.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandCreateGenClock& inCommand) {
+	return executeWithSimpleResponse<CommandCreateGenClock>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set clock groups.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetClockGroups& inCommand) {
+	return executeWithSimpleResponse<CommandSetClockGroups>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set clock latency.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetClockLatency& inCommand) {
+	return executeWithSimpleResponse<CommandSetClockLatency>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set uncertainty between two clocks.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetInterClockUncertainty& inCommand) {
+	return executeWithSimpleResponse<CommandSetInterClockUncertainty>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set uncertainty of single clock.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetSingleClockUncertainty& inCommand) {
+	return executeWithSimpleResponse<CommandSetSingleClockUncertainty>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set uncertainty of single pin.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetSinglePinUncertainty& inCommand) {
+	return executeWithSimpleResponse<CommandSetSinglePinUncertainty>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set port delay.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetPortDelay& inCommand) {
+	return executeWithSimpleResponse<CommandSetPortDelay>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set input port transition.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetInPortTransition& inCommand) {
+	return executeWithSimpleResponse<CommandSetInPortTransition>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set port load.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetPortPinLoad& inCommand) {
+	return executeWithSimpleResponse<CommandSetPortPinLoad>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set false paths.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetFalsePath& inCommand) {
+	return executeWithSimpleResponse<CommandSetFalsePath>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set min/max delay.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetMinMaxDelay& inCommand) {
+	return executeWithSimpleResponse<CommandSetMinMaxDelay>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set multicycle path.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetMulticyclePath& inCommand) {
+	return executeWithSimpleResponse<CommandSetMulticyclePath>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to disable timing of single pin.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandDisableSinglePinTiming& inCommand) {
+	return executeWithSimpleResponse<CommandDisableSinglePinTiming>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to disable inter-pin timing of an instance.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandDisableInstTiming& inCommand) {
+	return executeWithSimpleResponse<CommandDisableInstTiming>(
+			inCommand, mCallbackPtr);
+}
+
+/**
+ * Sends command to set global timing derate.
+ * See \link executeWithSimpleResponse
+ */
+bool StaClientIpcProtocol::execute(
+		const CommandSetGlobalTimingDerate& inCommand) {
+	return executeWithSimpleResponse<CommandSetGlobalTimingDerate>(
+			inCommand, mCallbackPtr);
+}
+
+
+}
+
+
@@ -0,0 +1,85 @@
+#ifndef SRC_COMMON_ARCDELAYS_HPP_
+#define SRC_COMMON_ARCDELAYS_HPP_
+
+
+#include "channel/Messages.hpp"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace stamask {
+
+
+/**
+ * Leaves single delay per edge, the last given one wins.
+ * Delays are ordered by edge ID afterwards.
+ * @param ioArcDelaysVec arc delays to dedup
+ */
+inline void dedupArcDelays(std::vector<ArcDelayData>& ioArcDelaysVec) {
+	std::stable_sort(ioArcDelaysVec.begin(), ioArcDelaysVec.end(),
+			[](const ArcDelayData& inLeft, const ArcDelayData& inRight) {
+				return inLeft.mEdgeId < inRight.mEdgeId;
+			});
+
+	size_t keptNum = 0;
+	for(size_t arcIdx = 0; arcIdx < ioArcDelaysVec.size(); arcIdx++) {
+		if(arcIdx + 1 < ioArcDelaysVec.size() &&
+				ioArcDelaysVec[arcIdx + 1].mEdgeId == ioArcDelaysVec[arcIdx].mEdgeId)
+			continue;
+
+		ioArcDelaysVec[keptNum++] = ioArcDelaysVec[arcIdx];
+	}
+
+	ioArcDelaysVec.resize(keptNum);
+}
+
+/**
+ * Converts min-max arcs delays into separate min and max arcs delays commands.
+ * Arcs are deduplicated, if min and max delays are the same for all arcs,
+ * then single command with both flags is filled and the other is left empty.
+ * @param inCommand min-max arcs delays command
+ * @param outMinCommand min arcs delays command to fill
+ * @param outMaxCommand max arcs delays command to fill
+ */
+inline void splitArcsMinMaxDelays(
+		const CommandSetArcsMinMaxDelays& inCommand,
+		CommandSetArcsDelays& outMinCommand,
+		CommandSetArcsDelays& outMaxCommand) {
+	std::vector<ArcDelayData> arcDelaysVec = inCommand.mArcDelaysVec;
+	dedupArcDelays(arcDelaysVec);
+
+	outMinCommand.mEdgeIdsVec.clear();
+	outMinCommand.mDelayValuesVec.clear();
+	outMinCommand.mMin = true;
+	outMinCommand.mMax = false;
+	outMaxCommand.mEdgeIdsVec.clear();
+	outMaxCommand.mDelayValuesVec.clear();
+	outMaxCommand.mMin = false;
+	outMaxCommand.mMax = true;
+
+	bool sameDelays = inCommand.mMin && inCommand.mMax &&
+			std::all_of(arcDelaysVec.begin(), arcDelaysVec.end(),
+				[](const ArcDelayData& inArc) {
+					return inArc.mMinDelay == inArc.mMaxDelay;
+				});
+	if(sameDelays)
+		outMinCommand.mMax = true;
+
+	for(const ArcDelayData& arcDelay : arcDelaysVec) {
+		if(inCommand.mMin) {
+			outMinCommand.mEdgeIdsVec.push_back(arcDelay.mEdgeId);
+			outMinCommand.mDelayValuesVec.push_back(arcDelay.mMinDelay);
+		}
+		if(inCommand.mMax && !sameDelays) {
+			outMaxCommand.mEdgeIdsVec.push_back(arcDelay.mEdgeId);
+			outMaxCommand.mDelayValuesVec.push_back(arcDelay.mMaxDelay);
+		}
+	}
+}
+
+
+}
+
+
+#endif /* SRC_COMMON_ARCDELAYS_HPP_ */
@@ -0,0 +1,630 @@
+
+#include "CommandLog.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <unordered_set>
+
+
+namespace stamask {
+
+
+constexpr char CommandLog::cMagic[8];
+
+
+/**
+ * Parts of STA engine state that commands change.
+ * Clear command of the part makes earlier commands of the part obsolete.
+ */
+enum ECommandLogPart {
+	eCommandLogPartGeneral,
+	eCommandLogPartLibs,
+	eCommandLogPartDesign
+};
+
+/**
+ * Returns part of STA engine state that command changes.
+ * @param inMesgType command type
+ * @return state part
+ */
+static ECommandLogPart getCommandLogPart(EMessageType inMesgType) {
+	switch(inMesgType) {
+	case EMessageType::EMessageTypeSetHierSeparator:
+		return eCommandLogPartGeneral;
+	case EMessageType::EMessageTypeReadLibFile:
+	case EMessageType::EMessageTypeReadLibStream:
+	case EMessageType::EMessageTypeClearLibs:
+		return eCommandLogPartLibs;
+	default:
+		return eCommandLogPartDesign;
+	}
+}
+
+/**
+ * Checks that command changes timing graph, so edge IDs may get other meaning.
+ * @param inMesgType command type
+ * @return flag that graph is changed
+ */
+static bool isGraphChanging(EMessageType inMesgType) {
+	switch(inMesgType) {
+	case EMessageType::EMessageTypeReadVerilogFile:
+	case EMessageType::EMessageTypeReadVerilogStream:
+	case EMessageType::EMessageTypeLinkTop:
+	case EMessageType::EMessageTypeClearNetlistBlocks:
+	case EMessageType::EMessageTypeCreateNetlist:
+	case EMessageType::EMessageTypeConnectContextPinNet:
+	case EMessageType::EMessageTypeDisconnectContextPinNet:
+	case EMessageType::EMessageTypeUpdateNetlist:
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+/**
+ * Constructor of empty log without journal.
+ */
+CommandLog::CommandLog():
+		mSerdes(0),
+		mEntriesVec(),
+		mJournalEntriesNum(0),
+		mJournalFileName(),
+		mJournalFile() {}
+
+/**
+ * Adds entry at the end of the log, or writes it only in open journal.
+ * Journal is flushed, so entry is on disk when method returns.
+ * @param inEntry entry to add
+ * @return operation success
+ */
+bool CommandLog::appendEntry(CommandLogEntry&& inEntry) {
+	if(!isJournalOpen()) {
+		mEntriesVec.push_back(std::move(inEntry));
+		return true;
+	}
+
+	writeEntry(mJournalFile, inEntry);
+	mJournalFile.flush();
+	if(!mJournalFile)
+		return false;
+
+	mJournalEntriesNum++;
+	return true;
+}
+
+/**
+ * Adds all commands of other log at the end of this one.
+ * @param inLog log to take commands from
+ * @return operation success
+ */
+bool CommandLog::appendLog(const CommandLog& inLog) {
+	bool ok = true;
+	for(const CommandLogEntry& entry : inLog.mEntriesVec) {
+		CommandLogEntry entryCopy = entry;
+		ok &= appendEntry(std::move(entryCopy));
+	}
+
+	return ok;
+}
+
+/**
+ * Removes all commands from the log, open journal is emptied too.
+ */
+void CommandLog::clear() {
+	mEntriesVec.clear();
+	mJournalEntriesNum = 0;
+	if(isJournalOpen())
+		rewriteJournal();
+}
+
+/**
+ * Returns amount of logged commands, including the ones in open journal.
+ * @return amount of commands
+ */
+std::size_t CommandLog::size() const {
+	return mEntriesVec.size() + mJournalEntriesNum;
+}
+
+/**
+ * Returns logged commands in order of execution.
+ * Commands of open journal aren't kept in memory, so they aren't returned.
+ * @return log entries
+ */
+const std::vector<CommandLogEntry>& CommandLog::getEntries() const {
+	return mEntriesVec;
+}
+
+/**
+ * Drops commands that don't affect final state.
+ * Commands of libraries before the last libraries clear
+ * and design commands before the last netlist blocks clear are dropped,
+ * last clear commands are kept.
+ * Arc delays overwritten later for the same edge are dropped too.
+ * Commands of open journal are read from the file,
+ * then journal is rewritten with the compacted log.
+ * @return operation success
+ */
+bool CommandLog::compact() {
+	if(isJournalOpen() && !loadJournalEntries())
+		return false;
+
+	std::size_t lastClearLibsIdx = 0;
+	std::size_t lastClearDesignIdx = 0;
+	for(std::size_t entryIdx = 0; entryIdx < mEntriesVec.size(); entryIdx++) {
+		if(mEntriesVec[entryIdx].mMesgType == EMessageType::EMessageTypeClearLibs)
+			lastClearLibsIdx = entryIdx;
+		if(mEntriesVec[entryIdx].mMesgType == EMessageType::EMessageTypeClearNetlistBlocks)
+			lastClearDesignIdx = entryIdx;
+	}
+
+	std::size_t keptNum = 0;
+	for(std::size_t entryIdx = 0; entryIdx < mEntriesVec.size(); entryIdx++) {
+		ECommandLogPart part = getCommandLogPart(mEntriesVec[entryIdx].mMesgType);
+		if((part == eCommandLogPartLibs && entryIdx < lastClearLibsIdx) ||
+				(part == eCommandLogPartDesign && entryIdx < lastClearDesignIdx))
+			continue;
+
+		if(keptNum != entryIdx)
+			mEntriesVec[keptNum] = std::move(mEntriesVec[entryIdx]);
+		keptNum++;
+	}
+
+	mEntriesVec.resize(keptNum);
+
+	dropSupersededArcsDelays();
+
+	if(isJournalOpen())
+		return rewriteJournal();
+	return true;
+}
+
+/**
+ * Drops arc delays that are set again later for the same edge and delay kind.
+ * Goes from the end of the log and remembers edges with min and max delays set.
+ * Min-max arc is kept while any of it's applied delays isn't set later.
+ * Commands that change timing graph reset remembered edges.
+ * Command is re-serialized if some of it's arcs are dropped,
+ * and is dropped itself if none are left.
+ */
+void CommandLog::dropSupersededArcsDelays() {
+	std::unordered_set<uint32_t> minEdgeIdsUSet;
+	std::unordered_set<uint32_t> maxEdgeIdsUSet;
+	std::vector<bool> dropEntriesVec(mEntriesVec.size(), false);
+
+	CommandSetArcsDelays command;
+	CommandSetArcsMinMaxDelays minMaxCommand;
+	for(std::size_t entryIdx = mEntriesVec.size(); entryIdx-- > 0; ) {
+		CommandLogEntry& entry = mEntriesVec[entryIdx];
+		if(isGraphChanging(entry.mMesgType)) {
+			minEdgeIdsUSet.clear();
+			maxEdgeIdsUSet.clear();
+			continue;
+		}
+
+		if(entry.mMesgType == EMessageType::EMessageTypeSetArcsMinMaxDelays) {
+			DataBlock data = {entry.mDataVec.data(), entry.mDataVec.size()};
+			if(!mSerdes.deserializeMessage(minMaxCommand, data))
+				continue;
+
+			std::vector<ArcDelayData>& arcDelaysVec = minMaxCommand.mArcDelaysVec;
+			std::size_t keptNum = 0;
+			for(std::size_t arcIdx = 0; arcIdx < arcDelaysVec.size(); arcIdx++) {
+				uint32_t edgeId = arcDelaysVec[arcIdx].mEdgeId;
+				bool minNeeded = minMaxCommand.mMin && !minEdgeIdsUSet.count(edgeId);
+				bool maxNeeded = minMaxCommand.mMax && !maxEdgeIdsUSet.count(edgeId);
+				if(!minNeeded && !maxNeeded)
+					continue;
+
+				arcDelaysVec[keptNum++] = arcDelaysVec[arcIdx];
+			}
+
+			bool changed = keptNum != arcDelaysVec.size();
+			arcDelaysVec.resize(keptNum);
+
+			for(const ArcDelayData& arcDelay : arcDelaysVec) {
+				if(minMaxCommand.mMin)
+					minEdgeIdsUSet.insert(arcDelay.mEdgeId);
+				if(minMaxCommand.mMax)
+					maxEdgeIdsUSet.insert(arcDelay.mEdgeId);
+			}
+
+			if(keptNum == 0) {
+				dropEntriesVec[entryIdx] = true;
+			} else if(changed) {
+				data = mSerdes.serializeMessage(minMaxCommand);
+				if(data.mDataPtr)
+					entry.mDataVec.assign(
+							data.mDataPtr, data.mDataPtr + data.mBytesNum);
+			}
+			continue;
+		}
+
+		if(entry.mMesgType != EMessageType::EMessageTypeSetArcsDelay)
+			continue;
+
+		DataBlock data = {entry.mDataVec.data(), entry.mDataVec.size()};
+		if(!mSerdes.deserializeMessage(command, data) ||
+				command.mEdgeIdsVec.size() != command.mDelayValuesVec.size())
+			continue;
+
+		std::size_t keptNum = 0;
+		for(std::size_t arcIdx = 0; arcIdx < command.mEdgeIdsVec.size(); arcIdx++) {
+			uint32_t edgeId = command.mEdgeIdsVec[arcIdx];
+			bool minNeeded = command.mMin && !minEdgeIdsUSet.count(edgeId);
+			bool maxNeeded = command.mMax && !maxEdgeIdsUSet.count(edgeId);
+			if(!minNeeded && !maxNeeded)
+				continue;
+
+			command.mEdgeIdsVec[keptNum] = edgeId;
+			command.mDelayValuesVec[keptNum] = command.mDelayValuesVec[arcIdx];
+			keptNum++;
+		}
+
+		bool changed = keptNum != command.mEdgeIdsVec.size();
+		command.mEdgeIdsVec.resize(keptNum);
+		command.mDelayValuesVec.resize(keptNum);
+
+		for(uint32_t edgeId : command.mEdgeIdsVec) {
+			if(command.mMin)
+				minEdgeIdsUSet.insert(edgeId);
+			if(command.mMax)
+				maxEdgeIdsUSet.insert(edgeId);
+		}
+
+		if(keptNum == 0) {
+			dropEntriesVec[entryIdx] = true;
+		} else if(changed) {
+			data = mSerdes.serializeMessage(command);
+			if(data.mDataPtr)
+				entry.mDataVec.assign(
+						data.mDataPtr, data.mDataPtr + data.mBytesNum);
+		}
+	}
+
+	std::size_t keptNum = 0;
+	for(std::size_t entryIdx = 0; entryIdx < mEntriesVec.size(); entryIdx++) {
+		if(dropEntriesVec[entryIdx])
+			continue;
+
+		if(keptNum != entryIdx)
+			mEntriesVec[keptNum] = std::move(mEntriesVec[entryIdx]);
+		keptNum++;
+	}
+
+	mEntriesVec.resize(keptNum);
+}
+
+/**
+ * Writes single entry as command type, data size and data.
+ * @param outStream stream to write in
+ * @param inEntry entry to write
+ */
+void CommandLog::writeEntry(
+		std::ostream& outStream,
+		const CommandLogEntry& inEntry) {
+	uint32_t mesgType = inEntry.mMesgType;
+	uint32_t reserved = 0;
+	uint64_t bytesNum = inEntry.mDataVec.size();
+	outStream.write(reinterpret_cast<const char*>(&mesgType), sizeof(mesgType));
+	outStream.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+	outStream.write(reinterpret_cast<const char*>(&bytesNum), sizeof(bytesNum));
+	outStream.write(reinterpret_cast<const char*>(inEntry.mDataVec.data()), bytesNum);
+}
+
+/**
+ * Writes the whole log.
+ * Header has magic, version and encoder ID, entries follow it up to the end,
+ * so journal can be appended without touching the header.
+ * @param outStream stream to write in
+ * @return operation success
+ */
+bool CommandLog::writeLog(std::ostream& outStream) const {
+	uint32_t encoderId = mSerdes.getEncoderId();
+	uint32_t reserved = 0;
+	outStream.write(cMagic, sizeof(cMagic));
+	outStream.write(reinterpret_cast<const char*>(&cVersion), sizeof(cVersion));
+	outStream.write(reinterpret_cast<const char*>(&encoderId), sizeof(encoderId));
+	outStream.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+
+	for(const CommandLogEntry& entry : mEntriesVec)
+		writeEntry(outStream, entry);
+
+	return bool(outStream);
+}
+
+/**
+ * Reads log written by \link writeLog and replaces current entries.
+ * Returns false and keeps current entries if header is invalid,
+ * has other encoder or has commands that aren't logged by this build.
+ * Entry cut at the end is ignored if it's allowed,
+ * it's left by a crash in the middle of journal write.
+ * @param inStream stream to read from
+ * @param inAllowCutTail flag to ignore incomplete last entry
+ * @return operation success
+ */
+bool CommandLog::readLog(
+		std::istream& inStream,
+		bool inAllowCutTail) {
+	char magic[sizeof(cMagic)] = {};
+	uint32_t version = 0;
+	uint32_t encoderId = 0;
+	uint32_t reserved = 0;
+	inStream.read(magic, sizeof(magic));
+	inStream.read(reinterpret_cast<char*>(&version), sizeof(version));
+	inStream.read(reinterpret_cast<char*>(&encoderId), sizeof(encoderId));
+	inStream.read(reinterpret_cast<char*>(&reserved), sizeof(reserved));
+	if(!inStream ||
+			std::memcmp(magic, cMagic, sizeof(cMagic)) != 0 ||
+			version != cVersion ||
+			encoderId != mSerdes.getEncoderId())
+		return false;
+
+	static constexpr MessageDispatchTable<ReplayFuncPtr> cReplayTable =
+			makeMessageDispatchTable<ReplayFuncPtr, ReplayThunk>(
+					LoggedCommandsList());
+
+	//entry sizes are checked against the rest of the stream before allocation
+	std::istream::pos_type entriesPos = inStream.tellg();
+	inStream.seekg(0, std::ios::end);
+	std::istream::pos_type endPos = inStream.tellg();
+	inStream.seekg(entriesPos);
+	if(!inStream ||
+			entriesPos == std::istream::pos_type(-1) ||
+			endPos == std::istream::pos_type(-1))
+		return false;
+
+	std::vector<CommandLogEntry> entriesVec;
+	while(inStream.peek() != std::istream::traits_type::eof()) {
+		uint32_t mesgType = 0;
+		uint64_t bytesNum = 0;
+		inStream.read(reinterpret_cast<char*>(&mesgType), sizeof(mesgType));
+		inStream.read(reinterpret_cast<char*>(&reserved), sizeof(reserved));
+		inStream.read(reinterpret_cast<char*>(&bytesNum), sizeof(bytesNum));
+		if(!inStream) {
+			if(!inAllowCutTail)
+				return false;
+			break;
+		}
+
+		if(mesgType >= cReplayTable.size() ||
+				!cReplayTable[mesgType])
+			return false;
+
+		if(bytesNum > uint64_t(endPos - inStream.tellg())) {
+			if(!inAllowCutTail)
+				return false;
+			break;
+		}
+
+		CommandLogEntry entry;
+		entry.mMesgType = EMessageType(mesgType);
+		entry.mDataVec.resize(bytesNum);
+		inStream.read(reinterpret_cast<char*>(entry.mDataVec.data()), bytesNum);
+		if(!inStream) {
+			if(!inAllowCutTail)
+				return false;
+			break;
+		}
+
+		entriesVec.push_back(std::move(entry));
+	}
+
+	mEntriesVec.swap(entriesVec);
+	return true;
+}
+
+/**
+ * Writes log file, overwrites existing one.
+ * @param inFileName log file name
+ * @return operation success
+ */
+bool CommandLog::save(const std::string& inFileName) const {
+	std::ofstream file(inFileName, std::ios::binary | std::ios::trunc);
+	if(!file)
+		return false;
+
+	return writeLog(file);
+}
+
+/**
+ * Reads log file written by \link save and replaces current log.
+ * Returns false and keeps current log if file can't be read or is invalid.
+ * @param inFileName log file name
+ * @return operation success
+ */
+bool CommandLog::load(const std::string& inFileName) {
+	std::ifstream file(inFileName, std::ios::binary);
+	if(!file)
+		return false;
+
+	return readLog(file, false);
+}
+
+/**
+ * Writes log in a string, layout is the same as in file.
+ * @param outData string to fill
+ * @return operation success
+ */
+bool CommandLog::saveToString(std::string& outData) const {
+	std::ostringstream stream(std::ios::binary);
+	if(!writeLog(stream))
+		return false;
+
+	outData = stream.str();
+	return true;
+}
+
+/**
+ * Reads log from a string written by \link saveToString and replaces current log.
+ * @param inData log data
+ * @return operation success
+ */
+bool CommandLog::loadFromString(const std::string& inData) {
+	std::istringstream stream(inData, std::ios::binary);
+	return readLog(stream, false);
+}
+
+/**
+ * Writes part of the log in a string, layout is the same as in file.
+ * Takes commands starting from given one while batch fits in given size,
+ * but at least one command is taken.
+ * Index is moved to the first command of the next batch.
+ * @param ioEntryIdx index of the first command of the batch
+ * @param inMaxBytes max size of the batch
+ * @param outData string to fill
+ * @return operation success
+ */
+bool CommandLog::saveBatchToString(
+		std::size_t& ioEntryIdx,
+		uint64_t inMaxBytes,
+		std::string& outData) const {
+	CommandLog batchLog;
+	uint64_t bytesNum = 0;
+	for(; ioEntryIdx < mEntriesVec.size(); ioEntryIdx++) {
+		const CommandLogEntry& entry = mEntriesVec[ioEntryIdx];
+		if(!batchLog.mEntriesVec.empty() &&
+				bytesNum + entry.mDataVec.size() > inMaxBytes)
+			break;
+
+		bytesNum += entry.mDataVec.size();
+		batchLog.mEntriesVec.push_back(entry);
+	}
+
+	return batchLog.saveToString(outData);
+}
+
+/**
+ * Opens journal file, then each appended command is written only in it.
+ * Commands of existing journal are taken in the log,
+ * otherwise the journal is started with current commands.
+ * Returns false and leaves journal closed if existing file is invalid
+ * or can't be written.
+ * @param inFileName journal file name
+ * @return operation success
+ */
+bool CommandLog::openJournal(const std::string& inFileName) {
+	closeJournal();
+
+	std::ifstream existingFile(inFileName, std::ios::binary);
+	if(existingFile &&
+			existingFile.peek() != std::istream::traits_type::eof() &&
+			!readLog(existingFile, true))
+		return false;
+	existingFile.close();
+
+	mJournalFileName = inFileName;
+	if(!rewriteJournal()) {
+		closeJournal();
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Closes journal file, commands written in it stay only in the file.
+ */
+void CommandLog::closeJournal() {
+	if(mJournalFile.is_open())
+		mJournalFile.close();
+	mJournalFile.clear();
+	mJournalFileName.clear();
+	mJournalEntriesNum = 0;
+}
+
+/**
+ * Checks that journal file is open.
+ * @return flag of open journal
+ */
+bool CommandLog::isJournalOpen() const {
+	return !mJournalFileName.empty() && mJournalFile.is_open();
+}
+
+/**
+ * Returns name of open journal file.
+ * @return file name, empty if journal isn't open
+ */
+const std::string& CommandLog::getJournalFileName() const {
+	return mJournalFileName;
+}
+
+/**
+ * Writes commands in memory in a temporary file, replaces journal with it
+ * and reopens journal for appending, then commands are kept only in the file.
+ * Old journal stays intact and commands stay in memory
+ * if temporary file fails to be written.
+ * @return operation success
+ */
+bool CommandLog::rewriteJournal() {
+	if(mJournalFile.is_open())
+		mJournalFile.close();
+	mJournalFile.clear();
+
+	std::string tmpFileName = mJournalFileName + ".tmp";
+	if(!save(tmpFileName) ||
+			std::rename(tmpFileName.c_str(), mJournalFileName.c_str()) != 0)
+		return false;
+
+	mJournalFile.open(mJournalFileName,
+			std::ios::binary | std::ios::app);
+	if(!mJournalFile)
+		return false;
+
+	mJournalEntriesNum = mEntriesVec.size();
+	mEntriesVec.clear();
+	mEntriesVec.shrink_to_fit();
+	return true;
+}
+
+/**
+ * Reads commands of open journal in memory.
+ * @return operation success
+ */
+bool CommandLog::loadJournalEntries() {
+	std::ifstream file(mJournalFileName, std::ios::binary);
+	if(!file || !readLog(file, true))
+		return false;
+
+	mJournalEntriesNum = 0;
+	return true;
+}
+
+/**
+ * Executes logged commands in order on given executor.
+ * Uses command type as an index in dispatch table of typed replay methods.
+ * Stops and returns false on the first failed command.
+ * Amount of started commands includes the failed one,
+ * since it may have changed executor's state too.
+ * @param ioExecutor commands executor
+ * @param outStartedNum amount of commands passed to executor
+ * @return success status
+ */
+bool CommandLog::replay(
+		IMessageExecutor& ioExecutor,
+		std::size_t& outStartedNum) {
+	static constexpr MessageDispatchTable<ReplayFuncPtr> cReplayTable =
+			makeMessageDispatchTable<ReplayFuncPtr, ReplayThunk>(
+					LoggedCommandsList());
+
+	outStartedNum = 0;
+	for(const CommandLogEntry& entry : mEntriesVec) {
+		if(entry.mMesgType >= cReplayTable.size() ||
+				!cReplayTable[entry.mMesgType])
+			return false;
+
+		DataBlock data = {
+			entry.mDataVec.data(),
+			entry.mDataVec.size()
+		};
+		outStartedNum++;
+		if(!(this->*cReplayTable[entry.mMesgType])(ioExecutor, data))
+			return false;
+	}
+
+	return true;
+}
+
+
+}
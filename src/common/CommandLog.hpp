@@ -0,0 +1,288 @@
+#ifndef SRC_COMMON_COMMANDLOG_HPP_
+#define SRC_COMMON_COMMANDLOG_HPP_
+
+
+#include "channel/Messages.hpp"
+#include "channel/MessageRegistry.hpp"
+#include "channel/FlatMessageSerdes.hpp"
+#include "IMessageExecutor.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+
+namespace stamask {
+
+
+/**
+ * Commands that change state of STA engine, so they are logged to replay.
+ * Queries, exit and checkpoint commands aren't logged.
+ * Cached liberty is logged as liberty stream with the text,
+ * so log is replayed on STA without the cache.
+ */
+typedef MessageTypeList<
+		CommandSetHierarhySeparator,
+
+		CommandReadLibertyFile,
+		CommandReadLibertyStream,
+		CommandClearLibs,
+
+		CommandReadVerilogFile,
+		CommandReadVerilogStream,
+		CommandLinkTop,
+		CommandClearNetlistBlocks,
+		CommandCreateNetlist,
+
+		CommandConnectContextPinNet,
+		CommandDisconnectContextPinNet,
+		CommandUpdateNetlist,
+
+		CommandReadSpefFile,
+		CommandReadSpefStream,
+		CommandSetGroupNetCap,
+
+		CommandReadSdfFile,
+		CommandReadSdfStream,
+		CommandSetArcsDelays,
+		CommandSetArcsMinMaxDelays,
+
+		CommandCreateClock,
+		CommandCreateGenClock,
+		CommandSetClockGroups,
+		CommandSetClockLatency,
+		CommandSetInterClockUncertainty,
+		CommandSetSingleClockUncertainty,
+		CommandSetSinglePinUncertainty,
+		CommandSetPortDelay,
+		CommandSetInPortTransition,
+		CommandSetPortPinLoad,
+		CommandSetFalsePath,
+		CommandSetMinMaxDelay,
+		CommandSetMulticyclePath,
+		CommandDisableSinglePinTiming,
+		CommandDisableInstTiming,
+		CommandSetGlobalTimingDerate>
+	LoggedCommandsList;
+
+
+/**
+ * Single serialized command of the log.
+ */
+struct CommandLogEntry {
+	EMessageType mMesgType = EMessageType::EMessageTypeNoMessage;
+	std::vector<uint8_t> mDataVec;
+};
+
+
+/**
+ * Log of commands that changed state of STA engine.
+ * Commands are kept serialized by flat serdes, that tolerates
+ * fields added by newer builds, so log files outlive a build.
+ * Log can be compacted, saved, loaded and replayed on an executor.
+ * Optional journal file gets each appended command right away,
+ * so log survives crash of the process that keeps it.
+ * Commands of open journal are kept only in the file,
+ * they are read back for compaction.
+ */
+class CommandLog {
+
+	/** method to replay command of one type */
+	typedef bool (CommandLog::*ReplayFuncPtr)(
+			IMessageExecutor&, DataBlock);
+
+	/** serdes of logged commands */
+	FlatMessageSerdes mSerdes;
+
+	/** logged commands in order of execution, empty while journal is open */
+	std::vector<CommandLogEntry> mEntriesVec;
+
+	/** amount of commands kept only in open journal */
+	std::size_t mJournalEntriesNum;
+
+	/** name of journal file, empty if journal isn't open */
+	std::string mJournalFileName;
+
+	/** journal file opened for appending */
+	std::ofstream mJournalFile;
+
+public:
+
+	/** magic bytes of log file */
+	static constexpr char cMagic[8] = {'S','T','L','K','C','L','O','G'};
+
+	/** version of file layout */
+	static constexpr uint32_t cVersion = 1;
+
+	CommandLog();
+
+	/**
+	 * Checks that commands of the type are logged.
+	 * @return flag that type is logged
+	 */
+	template<typename _MesgType>
+	static constexpr bool isLogged() {
+		return isLoggedType<_MesgType>(LoggedCommandsList());
+	}
+
+	template<typename _MesgType>
+	bool append(const _MesgType& inCommand);
+
+	bool appendLog(const CommandLog& inLog);
+
+	void clear();
+
+	std::size_t size() const;
+
+	const std::vector<CommandLogEntry>& getEntries() const;
+
+	bool compact();
+
+	bool save(const std::string& inFileName) const;
+
+	bool load(const std::string& inFileName);
+
+	bool saveToString(std::string& outData) const;
+
+	bool loadFromString(const std::string& inData);
+
+	bool saveBatchToString(
+			std::size_t& ioEntryIdx,
+			uint64_t inMaxBytes,
+			std::string& outData) const;
+
+	bool openJournal(const std::string& inFileName);
+
+	void closeJournal();
+
+	bool isJournalOpen() const;
+
+	const std::string& getJournalFileName() const;
+
+	bool replay(
+			IMessageExecutor& ioExecutor,
+			std::size_t& outStartedNum);
+
+protected:
+
+	bool appendEntry(CommandLogEntry&& inEntry);
+
+	bool writeLog(std::ostream& outStream) const;
+
+	bool readLog(
+			std::istream& inStream,
+			bool inAllowCutTail);
+
+	static void writeEntry(
+			std::ostream& outStream,
+			const CommandLogEntry& inEntry);
+
+	bool rewriteJournal();
+
+	bool loadJournalEntries();
+
+	void dropSupersededArcsDelays();
+
+	template<typename _MesgType, typename... _MesgTypes>
+	static constexpr bool isLoggedType(MessageTypeList<_MesgTypes...>) {
+		return (std::is_same<_MesgType, _MesgTypes>::value || ...);
+	}
+
+	template<typename _MesgType>
+	bool replayEntry(
+			IMessageExecutor& ioExecutor,
+			DataBlock inData);
+
+	/**
+	 * Provides replay method of command type for dispatch table.
+	 */
+	template <typename _MesgType>
+	struct ReplayThunk {
+		static constexpr ReplayFuncPtr get() {
+			return &CommandLog::replayEntry<_MesgType>;
+		}
+	};
+
+	template<typename _MesgType>
+	static bool executeLogged(
+			IMessageExecutor& ioExecutor,
+			const _MesgType& inCommand);
+
+};
+
+
+/**
+ * Serializes command and adds it at the end of the log.
+ * Returns false if command type isn't logged, fails to serialize it
+ * or fails to write it in open journal.
+ * @param inCommand executed command
+ * @return operation success
+ */
+template<typename _MesgType>
+bool CommandLog::append(const _MesgType& inCommand) {
+	if constexpr(!isLogged<_MesgType>()) {
+		return false;
+	} else {
+		DataBlock data = mSerdes.serializeMessage(inCommand);
+		if(!data.mDataPtr)
+			return false;
+
+		CommandLogEntry entry;
+		entry.mMesgType = _MesgType::cMesgType;
+		entry.mDataVec.assign(
+				data.mDataPtr, data.mDataPtr + data.mBytesNum);
+		return appendEntry(std::move(entry));
+	}
+}
+
+/**
+ * Deserializes command of the entry and executes it.
+ * @param ioExecutor commands executor
+ * @param inData serialized command
+ * @return execution success
+ */
+template<typename _MesgType>
+bool CommandLog::replayEntry(
+		IMessageExecutor& ioExecutor,
+		DataBlock inData) {
+	_MesgType command;
+	if(!mSerdes.deserializeMessage(command, inData))
+		return false;
+
+	return executeLogged(ioExecutor, command);
+}
+
+/**
+ * Executes logged command.
+ * @param ioExecutor commands executor
+ * @param inCommand command to execute
+ * @return execution success
+ */
+template<typename _MesgType>
+bool CommandLog::executeLogged(
+		IMessageExecutor& ioExecutor,
+		const _MesgType& inCommand) {
+	return ioExecutor.execute(inCommand);
+}
+
+/**
+ * Executes logged netlist update, graph changes aren't needed on replay.
+ * @param ioExecutor commands executor
+ * @param inCommand command to execute
+ * @return execution success
+ */
+template<>
+inline bool CommandLog::executeLogged<CommandUpdateNetlist>(
+		IMessageExecutor& ioExecutor,
+		const CommandUpdateNetlist& inCommand) {
+	GraphChangesData changes;
+	return ioExecutor.execute(inCommand, changes);
+}
+
+
+}
+
+
+#endif /* SRC_COMMON_COMMANDLOG_HPP_ */
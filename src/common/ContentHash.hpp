@@ -0,0 +1,177 @@
+#ifndef SRC_COMMON_CONTENTHASH_HPP_
+#define SRC_COMMON_CONTENTHASH_HPP_
+
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+
+namespace stamask {
+
+
+/** amount of hex digits in content hash */
+constexpr std::size_t cContentHashDigitsNum = 64;
+
+/** initial state of SHA-256 */
+constexpr uint32_t cSha256InitArr[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+	0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+/** round constants of SHA-256 */
+constexpr uint32_t cSha256RoundsArr[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+
+/**
+ * Rotates 32-bit word right.
+ * @param inWord word to rotate
+ * @param inBitsNum amount of bits, from 1 to 31
+ * @return rotated word
+ */
+inline uint32_t rotateHashWord(uint32_t inWord, unsigned inBitsNum) {
+	return (inWord >> inBitsNum) | (inWord << (32 - inBitsNum));
+}
+
+/**
+ * Mixes 64-byte block of data in SHA-256 state.
+ * @param ioStateArr hash state of 8 words
+ * @param inBlockPtr block to mix
+ */
+inline void mixContentHashBlock(
+		uint32_t* ioStateArr,
+		const unsigned char* inBlockPtr) {
+	uint32_t wordsArr[64];
+	for(unsigned i = 0; i < 16; i++)
+		wordsArr[i] = (uint32_t(inBlockPtr[4*i]) << 24) |
+				(uint32_t(inBlockPtr[4*i + 1]) << 16) |
+				(uint32_t(inBlockPtr[4*i + 2]) << 8) |
+				uint32_t(inBlockPtr[4*i + 3]);
+	for(unsigned i = 16; i < 64; i++) {
+		uint32_t sigma0 = rotateHashWord(wordsArr[i - 15], 7) ^
+				rotateHashWord(wordsArr[i - 15], 18) ^ (wordsArr[i - 15] >> 3);
+		uint32_t sigma1 = rotateHashWord(wordsArr[i - 2], 17) ^
+				rotateHashWord(wordsArr[i - 2], 19) ^ (wordsArr[i - 2] >> 10);
+		wordsArr[i] = wordsArr[i - 16] + sigma0 + wordsArr[i - 7] + sigma1;
+	}
+
+	uint32_t a = ioStateArr[0], b = ioStateArr[1], c = ioStateArr[2], d = ioStateArr[3];
+	uint32_t e = ioStateArr[4], f = ioStateArr[5], g = ioStateArr[6], h = ioStateArr[7];
+	for(unsigned i = 0; i < 64; i++) {
+		uint32_t sum1 = rotateHashWord(e, 6) ^ rotateHashWord(e, 11) ^ rotateHashWord(e, 25);
+		uint32_t choice = (e & f) ^ (~e & g);
+		uint32_t temp1 = h + sum1 + choice + cSha256RoundsArr[i] + wordsArr[i];
+		uint32_t sum0 = rotateHashWord(a, 2) ^ rotateHashWord(a, 13) ^ rotateHashWord(a, 22);
+		uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+		uint32_t temp2 = sum0 + majority;
+
+		h = g;
+		g = f;
+		f = e;
+		e = d + temp1;
+		d = c;
+		c = b;
+		b = a;
+		a = temp1 + temp2;
+	}
+
+	ioStateArr[0] += a;
+	ioStateArr[1] += b;
+	ioStateArr[2] += c;
+	ioStateArr[3] += d;
+	ioStateArr[4] += e;
+	ioStateArr[5] += f;
+	ioStateArr[6] += g;
+	ioStateArr[7] += h;
+}
+
+/**
+ * Returns SHA-256 hash of data to identify files and streams by content.
+ * Hash doesn't depend on byte order and it's collisions aren't practical,
+ * so text stored under the hash is used without comparing the text.
+ * @param inDataPtr data to hash
+ * @param inBytesNum size of data
+ * @return content hash as 64 lowercase hex digits, never empty
+ */
+inline std::string hashContent(const char* inDataPtr, std::size_t inBytesNum) {
+	uint32_t stateArr[8];
+	std::memcpy(stateArr, cSha256InitArr, sizeof(stateArr));
+
+	const unsigned char* dataPtr = reinterpret_cast<const unsigned char*>(inDataPtr);
+	std::size_t blocksBytes = inBytesNum - inBytesNum % 64;
+	for(std::size_t offset = 0; offset < blocksBytes; offset += 64)
+		mixContentHashBlock(stateArr, dataPtr + offset);
+
+	//tail is padded with one bit, zeroes and size in bits
+	unsigned char tailArr[128] = {};
+	std::size_t tailBytes = inBytesNum - blocksBytes;
+	if(tailBytes)
+		std::memcpy(tailArr, dataPtr + blocksBytes, tailBytes);
+	tailArr[tailBytes] = 0x80;
+
+	std::size_t tailBlocksNum = tailBytes < 56 ? 1 : 2;
+	uint64_t bitsNum = uint64_t(inBytesNum) * 8;
+	for(unsigned i = 0; i < 8; i++)
+		tailArr[tailBlocksNum*64 - 1 - i] = static_cast<unsigned char>(bitsNum >> (8*i));
+	for(std::size_t blockIdx = 0; blockIdx < tailBlocksNum; blockIdx++)
+		mixContentHashBlock(stateArr, tailArr + blockIdx*64);
+
+	static constexpr char cHexDigitsArr[] = "0123456789abcdef";
+	std::string hash(cContentHashDigitsNum, '0');
+	for(unsigned wordIdx = 0; wordIdx < 8; wordIdx++) {
+		for(unsigned digitIdx = 0; digitIdx < 8; digitIdx++)
+			hash[wordIdx*8 + digitIdx] =
+					cHexDigitsArr[(stateArr[wordIdx] >> (28 - 4*digitIdx)) & 0xf];
+	}
+	return hash;
+}
+
+/**
+ * Returns SHA-256 hash of string content.
+ * @param inData string to hash
+ * @return content hash as 64 lowercase hex digits, never empty
+ */
+inline std::string hashContent(const std::string& inData) {
+	return hashContent(inData.data(), inData.size());
+}
+
+/**
+ * Checks that string has form of content hash,
+ * so it's safe to use it in file names.
+ * @param inHash hash to check
+ * @return flag of valid hash
+ */
+inline bool isContentHash(const std::string& inHash) {
+	if(inHash.size() != cContentHashDigitsNum)
+		return false;
+
+	for(char digit : inHash) {
+		if(!((digit >= '0' && digit <= '9') || (digit >= 'a' && digit <= 'f')))
+			return false;
+	}
+	return true;
+}
+
+
+}
+
+
+#endif /* SRC_COMMON_CONTENTHASH_HPP_ */
@@ -1,116 +1,257 @@
-#ifndef SRC_COMMON_IMESSAGEEXECUTOR_HPP_
-#define SRC_COMMON_IMESSAGEEXECUTOR_HPP_
-
-
-#include "channel/Messages.hpp"
-
-
-namespace stamask {
-
-
-/**
- * Interface to handle commands on client or server side.
- */
-class IMessageExecutor {
-
-public:
-	virtual ~IMessageExecutor() {}
-
-	virtual std::string getExecMessage() const = 0;
-
-	virtual bool execute(
-			const CommandSetHierarhySeparator& inCommand) = 0;
-	virtual bool execute(
-			const CommandExit& inCommand) = 0;
-	virtual bool execute(
-			const CommandPing& inCommand) = 0;
-	virtual bool execute(
-			const CommandReadLibertyFile& inCommand) = 0;
-	virtual bool execute(
-			const CommandReadLibertyStream& inCommand) = 0;
-	virtual bool execute(
-			const CommandClearLibs& inCommand) = 0;
-	virtual bool execute(
-			const CommandReadVerilogFile& inCommand) = 0;
-	virtual bool execute(
-			const CommandReadVerilogStream& inCommand) = 0;
-	virtual bool execute(
-			const CommandLinkTop& inCommand) = 0;
-	virtual bool execute(
-			const CommandClearNetlistBlocks& inCommand) = 0;
-	virtual bool execute(
-			const CommandCreateNetlist& inCommand) = 0;
-	virtual bool execute(
-			const CommandGetGraphData& inCommand,
-			std::vector<VertexIdData>& outVertexIdToDataVec,
-			std::vector<EdgeIdData>& outEdgeIdToDataVec) = 0;
-	virtual bool execute(
-			const CommandGetGraphSlacksData& inCommand,
-			std::vector<NodeTimingData>& outNodeTimingsVec) = 0;
-	virtual bool execute(
-			const CommandSetArcsDelays& inCommand) = 0;
-	virtual bool execute(
-			const CommandConnectContextPinNet& inCommand) = 0;
-	virtual bool execute(
-			const CommandDisconnectContextPinNet& inCommand) = 0;
-	virtual bool execute(
-			const CommandReadSpefFile& inCommand) = 0;
-	virtual bool execute(
-			const CommandReadSpefStream& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetGroupNetCap& inCommand) = 0;
-	virtual bool execute(
-			const CommandReadSdfFile& inCommand) = 0;
-	virtual bool execute(
-			const CommandWriteSdfFile& inCommand) = 0;
-	virtual bool execute(
-			const CommandReadSdfStream& inCommand) = 0;
-	virtual bool execute(
-			const CommandCreateClock& inCommand) = 0;
-	virtual bool execute(
-			const CommandCreateGenClock& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetClockGroups& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetClockLatency& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetInterClockUncertainty& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetSingleClockUncertainty& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetSinglePinUncertainty& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetPortPinLoad& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetPortDelay& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetInPortTransition& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetFalsePath& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetMinMaxDelay& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetMulticyclePath& inCommand) = 0;
-	virtual bool execute(
-			const CommandDisableSinglePinTiming& inCommand) = 0;
-	virtual bool execute(
-			const CommandDisableInstTiming& inCommand) = 0;
-	virtual bool execute(
-			const CommandSetGlobalTimingDerate& inCommand) = 0;
-	virtual bool execute(
-			const CommandReportTiming& inCommand,
-			std::string& outReportStr) = 0;
-	virtual bool execute(
-			const CommandGetDesignStats& inCommand,
-			float& outMinWNS,
-			float& outMaxWNS,
-			float& outMinTNS,
-			float& outMaxTNS) = 0;
-
-};
-
-}
-
-
-
-#endif /* SRC_COMMON_IMESSAGEEXECUTOR_HPP_ */
+#ifndef SRC_COMMON_IMESSAGEEXECUTOR_HPP_
+#define SRC_COMMON_IMESSAGEEXECUTOR_HPP_
+
+
+#include "channel/Messages.hpp"
+#include "ArcDelays.hpp"
+#include "NodeTimingCalc.hpp"
+
+
+namespace stamask {
+
+
+/**
+ * Interface to handle commands on client or server side.
+ * Commands added after the first release fail by default,
+ * so existing executors keep compiling.
+ */
+class IMessageExecutor {
+
+public:
+	virtual ~IMessageExecutor() {}
+
+	virtual std::string getExecMessage() const = 0;
+
+	/**
+	 * Checks that executor saves and restores it's state by itself.
+	 * Otherwise checkpoint is restored by replaying the command log.
+	 * @return flag of native checkpoint support
+	 */
+	virtual bool hasNativeCheckpoint() const {
+		return false;
+	}
+
+	/**
+	 * Checks that executor keeps parsed libraries by content hash,
+	 * see execute of CommandReadCachedLiberty.
+	 * @return flag of liberty cache support
+	 */
+	virtual bool hasLibertyCache() const {
+		return false;
+	}
+
+	virtual bool execute(
+			const CommandSetHierarhySeparator& inCommand) = 0;
+	virtual bool execute(
+			const CommandExit& inCommand) = 0;
+	virtual bool execute(
+			const CommandPing& inCommand) = 0;
+	virtual bool execute(
+			const CommandReadLibertyFile& inCommand) = 0;
+	virtual bool execute(
+			const CommandReadLibertyStream& inCommand) = 0;
+	virtual bool execute(
+			const CommandReadCachedLiberty& /*inCommand*/) {
+		return false;
+	}
+	virtual bool execute(
+			const CommandClearLibs& inCommand) = 0;
+	virtual bool execute(
+			const CommandReadVerilogFile& inCommand) = 0;
+	virtual bool execute(
+			const CommandReadVerilogStream& inCommand) = 0;
+	virtual bool execute(
+			const CommandLinkTop& inCommand) = 0;
+	virtual bool execute(
+			const CommandClearNetlistBlocks& inCommand) = 0;
+	virtual bool execute(
+			const CommandCreateNetlist& inCommand) = 0;
+	virtual bool execute(
+			const CommandGetGraphData& inCommand,
+			std::vector<VertexIdData>& outVertexIdToDataVec,
+			std::vector<EdgeIdData>& outEdgeIdToDataVec) = 0;
+	virtual bool execute(
+			const CommandGetGraphFingerprint& /*inCommand*/,
+			GraphFingerprintData& /*outFingerprint*/) {
+		return false;
+	}
+	virtual bool execute(
+			const CommandGetGraphSlacksData& inCommand,
+			std::vector<NodeTimingData>& outNodeTimingsVec) = 0;
+
+	/**
+	 * Aggregates endpoint slack summary of the design.
+	 * By default gets node timing data and aggregates it,
+	 * executor that keeps timing data may aggregate it in place
+	 * without copying the whole data.
+	 * Histogram options are checked before the call.
+	 * @param inCommand command with histogram options
+	 * @param outSummary summary to fill
+	 * @return success status
+	 */
+	virtual bool execute(
+			const CommandGetTimingSummary& inCommand,
+			TimingSummaryData& outSummary) {
+		std::vector<NodeTimingData> nodeTimingsVec;
+		return execute(CommandGetGraphSlacksData(), nodeTimingsVec) &&
+				calcTimingSummary(nodeTimingsVec, inCommand, outSummary);
+	}
+
+	/**
+	 * Selects timing data of a subset of nodes in the order of vertex IDs.
+	 * By default gets node timing data of all nodes and selects the subset,
+	 * executor that keeps timing data may copy only selected nodes.
+	 * @param inCommand command with subset options
+	 * @param inConeVec cone flags of given vertices indexed by vertex ID,
+	 * empty if no cone is requested
+	 * @param outNodeTimingsVec selected timing data to fill
+	 * @return success status
+	 */
+	virtual bool execute(
+			const CommandGetGraphSlacksSubset& inCommand,
+			const std::vector<bool>& inConeVec,
+			std::vector<NodeTimingData>& outNodeTimingsVec) {
+		std::vector<NodeTimingData> nodeTimingsVec;
+		return execute(CommandGetGraphSlacksData(), nodeTimingsVec) &&
+				selectNodeTimingsSubset(
+					nodeTimingsVec, inCommand, inConeVec, outNodeTimingsVec);
+	}
+
+	/**
+	 * Calculates quantized criticality factors of all nodes.
+	 * By default gets node timing data and calculates factors from it,
+	 * executor that keeps timing data may calculate them in place.
+	 * Amount of bits is checked before the call.
+	 * @param inCommand command with modes and bits of factors
+	 * @param outFactors quantized factors to fill
+	 * @return success status
+	 */
+	virtual bool execute(
+			const CommandGetCritFactors& inCommand,
+			CritFactorsData& outFactors) {
+		std::vector<NodeTimingData> nodeTimingsVec;
+		return execute(CommandGetGraphSlacksData(), nodeTimingsVec) &&
+				calcQuantizedCritFactors(nodeTimingsVec, inCommand, outFactors);
+	}
+
+	/**
+	 * Packs timing data of all nodes.
+	 * By default gets node timing data and packs it,
+	 * executor that keeps timing data may pack it in place.
+	 * @param inCommand command to execute
+	 * @param outPackedTimings packed timings to fill
+	 * @return success status
+	 */
+	virtual bool execute(
+			const CommandGetPackedGraphSlacks& /*inCommand*/,
+			PackedNodeTimingsData& outPackedTimings) {
+		std::vector<NodeTimingData> nodeTimingsVec;
+		if(!execute(CommandGetGraphSlacksData(), nodeTimingsVec))
+			return false;
+
+		packNodeTimings(nodeTimingsVec, outPackedTimings);
+		return true;
+	}
+	virtual bool execute(
+			const CommandSetArcsDelays& inCommand) = 0;
+
+	/**
+	 * Sets min and max delays of several edges.
+	 * By default dedups arcs and executes them as arcs delays commands,
+	 * executor with native support may apply them at once.
+	 * @param inCommand command to execute
+	 * @return success status
+	 */
+	virtual bool execute(
+			const CommandSetArcsMinMaxDelays& inCommand) {
+		CommandSetArcsDelays minCommand;
+		CommandSetArcsDelays maxCommand;
+		splitArcsMinMaxDelays(inCommand, minCommand, maxCommand);
+
+		return (minCommand.mEdgeIdsVec.empty() || execute(minCommand)) &&
+				(maxCommand.mEdgeIdsVec.empty() || execute(maxCommand));
+	}
+
+	virtual bool execute(
+			const CommandConnectContextPinNet& inCommand) = 0;
+	virtual bool execute(
+			const CommandDisconnectContextPinNet& inCommand) = 0;
+	virtual bool execute(
+			const CommandUpdateNetlist& /*inCommand*/,
+			GraphChangesData& /*outChanges*/) {
+		return false;
+	}
+	virtual bool execute(
+			const CommandReadSpefFile& inCommand) = 0;
+	virtual bool execute(
+			const CommandReadSpefStream& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetGroupNetCap& inCommand) = 0;
+	virtual bool execute(
+			const CommandReadSdfFile& inCommand) = 0;
+	virtual bool execute(
+			const CommandWriteSdfFile& inCommand) = 0;
+	virtual bool execute(
+			const CommandSaveCheckpoint& /*inCommand*/) {
+		return false;
+	}
+	virtual bool execute(
+			const CommandLoadCheckpoint& /*inCommand*/) {
+		return false;
+	}
+	virtual bool execute(
+			const CommandReadSdfStream& inCommand) = 0;
+	virtual bool execute(
+			const CommandCreateClock& inCommand) = 0;
+	virtual bool execute(
+			const CommandCreateGenClock& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetClockGroups& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetClockLatency& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetInterClockUncertainty& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetSingleClockUncertainty& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetSinglePinUncertainty& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetPortPinLoad& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetPortDelay& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetInPortTransition& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetFalsePath& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetMinMaxDelay& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetMulticyclePath& inCommand) = 0;
+	virtual bool execute(
+			const CommandDisableSinglePinTiming& inCommand) = 0;
+	virtual bool execute(
+			const CommandDisableInstTiming& inCommand) = 0;
+	virtual bool execute(
+			const CommandSetGlobalTimingDerate& inCommand) = 0;
+	virtual bool execute(
+			const CommandReportTiming& inCommand,
+			std::string& outReportStr) = 0;
+	virtual bool execute(
+			const CommandGetTimingPaths& /*inCommand*/,
+			TimingPathsData& /*outPaths*/) {
+		return false;
+	}
+	virtual bool execute(
+			const CommandGetDesignStats& inCommand,
+			float& outMinWNS,
+			float& outMaxWNS,
+			float& outMinTNS,
+			float& outMaxTNS) = 0;
+
+};
+
+}
+
+
+
+#endif /* SRC_COMMON_IMESSAGEEXECUTOR_HPP_ */
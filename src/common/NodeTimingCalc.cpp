@@ -0,0 +1,636 @@
+
+#include "NodeTimingCalc.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+namespace stamask {
+
+
+/** fields of node timing data in order of packed value columns */
+static float NodeTimingData::* const cPackedNodeValueFields[ePackedNodeValuesNum] = {
+	&NodeTimingData::mMinWorstSlackRat,
+	&NodeTimingData::mMinWorstSlackAat,
+	&NodeTimingData::mMaxWorstSlackRat,
+	&NodeTimingData::mMaxWorstSlackAat,
+	&NodeTimingData::mMaxPathRat,
+	&NodeTimingData::mMinPathRat
+};
+
+/** decoded values of unset codes, the same as defaults of node timing data */
+constexpr float cPackedNodeLowValue = -1e30;
+constexpr float cPackedNodeHighValue = 1e30;
+
+
+/**
+ * Fills worst min/max RATs and slacks for clocks mentioned in node timings.
+ * Resizes output vectors depending on clock index.
+ * @param inNodeTimingData nodes timing data
+ * @param outClockMinWorstRatVec worst min RATs for clocks
+ * @param outClockMaxWorstRatVec worst max RATs for clocks
+ * @param outClockMinWorstSlackVec worst min slacks for clocks
+ * @param outClockMaxWorstSlackVec worst max slacks for clocks
+ * @return success flag
+ */
+bool collectClockWorstTimings(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		std::vector<float>& outClockMinWorstRatVec,
+		std::vector<float>& outClockMaxWorstRatVec,
+		std::vector<float>& outClockMinWorstSlackVec,
+		std::vector<float>& outClockMaxWorstSlackVec) {
+	outClockMinWorstRatVec.clear();
+	outClockMaxWorstRatVec.clear();
+	outClockMinWorstSlackVec.clear();
+	outClockMaxWorstSlackVec.clear();
+
+	float minSlack = 0;
+	float maxSlack = 0;
+	float minRat = 0;
+	float maxRat = 0;
+
+	for(const NodeTimingData& data : inNodeTimingData) {
+		if(!data.mHasTiming || data.mClkIdx < 0)
+			continue;
+
+		if(data.mNonData)
+			continue;
+
+		if(data.mClkIdx >= outClockMinWorstRatVec.size()) {
+			outClockMinWorstRatVec.resize(data.mClkIdx+1, 0);
+			outClockMaxWorstRatVec.resize(data.mClkIdx+1, 0);
+			outClockMinWorstSlackVec.resize(data.mClkIdx+1, 0);
+			outClockMaxWorstSlackVec.resize(data.mClkIdx+1, 0);
+		}
+
+		minSlack = getNodeTimingSlack(data, true);
+		maxSlack = getNodeTimingSlack(data, false);
+		minRat = data.mMinWorstSlackAat;
+		maxRat = data.mMaxWorstSlackRat;
+
+		if(minSlack < outClockMinWorstSlackVec[data.mClkIdx])
+			outClockMinWorstSlackVec[data.mClkIdx] = minSlack;
+		if(maxSlack < outClockMaxWorstSlackVec[data.mClkIdx])
+			outClockMaxWorstSlackVec[data.mClkIdx] = maxSlack;
+
+		if(minRat > outClockMinWorstRatVec[data.mClkIdx])
+			outClockMinWorstRatVec[data.mClkIdx] = minRat;
+		if(maxRat > outClockMaxWorstRatVec[data.mClkIdx])
+			outClockMaxWorstRatVec[data.mClkIdx] = maxRat;
+	}
+
+	return true;
+}
+
+/**
+ * Calculates criticalness factors for all nodes based on their timing data.
+ * Node slack is shifted by worst slack of it's clock and divided by worst RAT,
+ * nodes without timing get 0 and non-data nodes get max criticality.
+ * @param inNodeTimingData nodes timing data
+ * @param outNodeCritFactorsVec nodes criticalness factors to set
+ * @param inWorstRatPerClockVec worst RATs for clocks
+ * @param inWorstSlackPerClockVec worst slacks for clocks
+ * @param inMinConstraint min-constraint flag
+ * @return success flag
+ */
+bool calcNodeTimingCritFactors(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		std::vector<float>& outNodeCritFactorsVec,
+		const std::vector<float>& inWorstRatPerClockVec,
+		const std::vector<float>& inWorstSlackPerClockVec,
+		bool inMinConstraint) {
+	float nodeSlack = 0;
+	float worstRat = 0;
+	float worstSlack = 0;
+	float criticality = 0;
+	int clkIdx = 0;
+
+	outNodeCritFactorsVec.clear();
+	outNodeCritFactorsVec.resize(inNodeTimingData.size(), 0);
+
+	for(size_t nIdx = 0; nIdx < inNodeTimingData.size(); nIdx++) {
+		if(!inNodeTimingData[nIdx].mHasTiming)
+			continue;
+
+		//clocks and other control signals have max criticality
+		if(inNodeTimingData[nIdx].mNonData) {
+			outNodeCritFactorsVec[nIdx] = 1;
+			continue;
+		}
+
+		clkIdx = inNodeTimingData[nIdx].mClkIdx;
+		if(clkIdx < 0 ||
+				clkIdx >= inWorstRatPerClockVec.size() ||
+				clkIdx >= inWorstSlackPerClockVec.size())
+			continue;
+
+		nodeSlack = getNodeTimingSlack(inNodeTimingData[nIdx], inMinConstraint);
+		worstRat = inWorstRatPerClockVec[clkIdx];
+		worstSlack = inWorstSlackPerClockVec[clkIdx];
+
+		if(worstSlack < 0)
+			worstSlack *= -1;
+
+		nodeSlack += worstSlack;
+		worstRat += worstSlack;
+
+		if(nodeSlack > worstRat)
+			worstRat = nodeSlack;
+
+		criticality = 1 - nodeSlack/worstRat;
+		if(criticality < 0)
+			criticality = 0;
+		if(criticality > 1)
+			criticality = 1;
+
+		outNodeCritFactorsVec[nIdx] = criticality;
+	}
+
+	return true;
+}
+
+/**
+ * Calculates min and max criticalness factors for all nodes,
+ * collects worst timings of clocks first.
+ * @param inNodeTimingData nodes timing data
+ * @param outNodeMinCritFactorsVec nodes min-constraint factors to set
+ * @param outNodeMaxCritFactorsVec nodes max-constraint factors to set
+ * @return success flag
+ */
+bool calcNodeTimingCritFactors(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		std::vector<float>& outNodeMinCritFactorsVec,
+		std::vector<float>& outNodeMaxCritFactorsVec) {
+	std::vector<float> clockMinWorstRatVec;
+	std::vector<float> clockMaxWorstRatVec;
+	std::vector<float> clockMinWorstSlackVec;
+	std::vector<float> clockMaxWorstSlackVec;
+
+	return collectClockWorstTimings(inNodeTimingData,
+				clockMinWorstRatVec, clockMaxWorstRatVec,
+				clockMinWorstSlackVec, clockMaxWorstSlackVec) &&
+		calcNodeTimingCritFactors(
+			inNodeTimingData, outNodeMinCritFactorsVec,
+			clockMinWorstRatVec, clockMinWorstSlackVec, true) &&
+		calcNodeTimingCritFactors(
+			inNodeTimingData, outNodeMaxCritFactorsVec,
+			clockMaxWorstRatVec, clockMaxWorstSlackVec, false);
+}
+
+/**
+ * Selects timing data of a subset of nodes in the order of vertex IDs.
+ * All nodes are taken if the command has no vertex IDs,
+ * otherwise given vertices and vertices of their cone are taken.
+ * Nodes are filtered by criticality factor if it's set in the command.
+ * @param inNodeTimingData nodes timing data
+ * @param inCommand command with subset options
+ * @param inConeVec cone flags indexed by vertex ID, may be empty
+ * @param outNodeTimingsVec selected timing data to fill
+ * @return success flag
+ */
+bool selectNodeTimingsSubset(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		const CommandGetGraphSlacksSubset& inCommand,
+		const std::vector<bool>& inConeVec,
+		std::vector<NodeTimingData>& outNodeTimingsVec) {
+	outNodeTimingsVec.clear();
+
+	std::vector<bool> selectedVec(
+			inNodeTimingData.size(), inCommand.mVertexIdsVec.empty());
+	for(size_t nodeIdx = 0; nodeIdx < inConeVec.size() &&
+			nodeIdx < selectedVec.size(); nodeIdx++) {
+		if(inConeVec[nodeIdx])
+			selectedVec[nodeIdx] = true;
+	}
+	for(uint32_t vertexId : inCommand.mVertexIdsVec) {
+		if(vertexId < selectedVec.size())
+			selectedVec[vertexId] = true;
+	}
+
+	std::vector<float> minCritFactorsVec;
+	std::vector<float> maxCritFactorsVec;
+	bool critFiltered = inCommand.mMinCritFactor > 0;
+	if(critFiltered && !calcNodeTimingCritFactors(
+			inNodeTimingData, minCritFactorsVec, maxCritFactorsVec))
+		return false;
+
+	for(size_t nodeIdx = 0; nodeIdx < inNodeTimingData.size(); nodeIdx++) {
+		if(!selectedVec[nodeIdx])
+			continue;
+
+		if(critFiltered &&
+				!(inCommand.mMin && minCritFactorsVec[nodeIdx] >= inCommand.mMinCritFactor) &&
+				!(inCommand.mMax && maxCritFactorsVec[nodeIdx] >= inCommand.mMinCritFactor))
+			continue;
+
+		outNodeTimingsVec.push_back(inNodeTimingData[nodeIdx]);
+	}
+
+	return true;
+}
+
+/**
+ * Checks options of criticality factors command.
+ * Factors must have 8 or 16 bits.
+ * @param inCommand command with bits of factors
+ * @return validity flag
+ */
+bool isCritFactorsCommandValid(
+		const CommandGetCritFactors& inCommand) {
+	return inCommand.mFactorBits == 8 || inCommand.mFactorBits == 16;
+}
+
+/**
+ * Calculates criticality factors of all nodes and quantizes them.
+ * Fails if amount of bits isn't 8 or 16.
+ * @param inNodeTimingData nodes timing data
+ * @param inCommand command with modes and bits of factors
+ * @param outFactors quantized factors to fill
+ * @return success flag
+ */
+bool calcQuantizedCritFactors(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		const CommandGetCritFactors& inCommand,
+		CritFactorsData& outFactors) {
+	outFactors = CritFactorsData();
+	outFactors.mFactorBits = inCommand.mFactorBits;
+
+	if(!isCritFactorsCommandValid(inCommand))
+		return false;
+
+	std::vector<float> minCritFactorsVec;
+	std::vector<float> maxCritFactorsVec;
+	if(!calcNodeTimingCritFactors(
+			inNodeTimingData, minCritFactorsVec, maxCritFactorsVec))
+		return false;
+
+	if(inCommand.mFactorBits == 8) {
+		if(inCommand.mMin)
+			quantizeCritFactors(minCritFactorsVec, outFactors.mMinFactors8Vec);
+		if(inCommand.mMax)
+			quantizeCritFactors(maxCritFactorsVec, outFactors.mMaxFactors8Vec);
+	} else {
+		if(inCommand.mMin)
+			quantizeCritFactors(minCritFactorsVec, outFactors.mMinFactors16Vec);
+		if(inCommand.mMax)
+			quantizeCritFactors(maxCritFactorsVec, outFactors.mMaxFactors16Vec);
+	}
+
+	return true;
+}
+
+/**
+ * Converts quantized criticality factors of both modes back to floats.
+ * Factors of not requested mode are left empty.
+ * @param inFactors quantized factors
+ * @param outNodeMinCritFactorsVec min-constraint factors to fill
+ * @param outNodeMaxCritFactorsVec max-constraint factors to fill
+ * @return success flag, false on unknown amount of bits
+ */
+bool dequantizeCritFactors(
+		const CritFactorsData& inFactors,
+		std::vector<float>& outNodeMinCritFactorsVec,
+		std::vector<float>& outNodeMaxCritFactorsVec) {
+	if(inFactors.mFactorBits == 8) {
+		dequantizeCritFactors(inFactors.mMinFactors8Vec, outNodeMinCritFactorsVec);
+		dequantizeCritFactors(inFactors.mMaxFactors8Vec, outNodeMaxCritFactorsVec);
+		return true;
+	}
+
+	if(inFactors.mFactorBits == 16) {
+		dequantizeCritFactors(inFactors.mMinFactors16Vec, outNodeMinCritFactorsVec);
+		dequantizeCritFactors(inFactors.mMaxFactors16Vec, outNodeMaxCritFactorsVec);
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * Packs timing data of nodes, timing values are reduced to 16-bit codes.
+ * Offset and scale are taken from the range of set values,
+ * values beyond unset bound keep only their sign.
+ * @param inNodeTimingData nodes timing data
+ * @param outPackedTimings packed timings to fill
+ */
+void packNodeTimings(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		PackedNodeTimingsData& outPackedTimings) {
+	size_t nodesNum = inNodeTimingData.size();
+
+	float minValue = std::numeric_limits<float>::max();
+	float maxValue = std::numeric_limits<float>::lowest();
+	for(const NodeTimingData& data : inNodeTimingData) {
+		for(float NodeTimingData::* field : cPackedNodeValueFields) {
+			if(!isNodeTimingSlackSet(data.*field))
+				continue;
+			minValue = std::min(minValue, data.*field);
+			maxValue = std::max(maxValue, data.*field);
+		}
+	}
+
+	outPackedTimings.mOffset = 0;
+	outPackedTimings.mScale = 1;
+	if(minValue <= maxValue) {
+		outPackedTimings.mOffset = 0.5 * (double(minValue) + maxValue);
+		outPackedTimings.mScale =
+				(double(maxValue) - minValue) / (2.0 * cPackedNodeValueMaxCode);
+	}
+	if(!(outPackedTimings.mScale > 0))
+		outPackedTimings.mScale = 1;
+
+	outPackedTimings.mNodesVec.resize(nodesNum);
+	for(size_t nodeIdx = 0; nodeIdx < nodesNum; nodeIdx++) {
+		const NodeTimingData& data = inNodeTimingData[nodeIdx];
+		PackedNodeData& packedData = outPackedTimings.mNodesVec[nodeIdx];
+		packedData.mNodeId = data.mNodeId;
+		packedData.mEndPointIdx = data.mEndPointIdx;
+		packedData.mClkIdx = data.mClkIdx;
+		packedData.mFlags =
+				(data.mIsEndPoint ? ePackedNodeEndPoint : 0) |
+				(data.mHasTiming ? ePackedNodeHasTiming : 0) |
+				(data.mNonData ? ePackedNodeNonData : 0) |
+				(data.mHasEndMaxPathRat ? ePackedNodeHasEndMaxPathRat : 0) |
+				(data.mHasEndMinPathRat ? ePackedNodeHasEndMinPathRat : 0);
+	}
+
+	double invScale = 1.0 / outPackedTimings.mScale;
+	outPackedTimings.mValuesVec.resize(nodesNum * ePackedNodeValuesNum);
+	for(size_t column = 0; column < ePackedNodeValuesNum; column++) {
+		float NodeTimingData::* field = cPackedNodeValueFields[column];
+		int16_t* codesPtr = outPackedTimings.mValuesVec.data() + column * nodesNum;
+
+		for(size_t nodeIdx = 0; nodeIdx < nodesNum; nodeIdx++) {
+			float value = inNodeTimingData[nodeIdx].*field;
+			if(value >= cNodeTimingUnsetSlack) {
+				codesPtr[nodeIdx] = std::numeric_limits<int16_t>::max();
+			} else if(!(value > -cNodeTimingUnsetSlack)) {
+				codesPtr[nodeIdx] = std::numeric_limits<int16_t>::min();
+			} else {
+				long code = std::lround((value - outPackedTimings.mOffset) * invScale);
+				codesPtr[nodeIdx] = std::max<long>(-cPackedNodeValueMaxCode,
+						std::min<long>(cPackedNodeValueMaxCode, code));
+			}
+		}
+	}
+}
+
+/**
+ * Unpacks timing data of nodes, decodes value columns one by one.
+ * Fails if values don't match amount of nodes.
+ * @param inPackedTimings packed timings
+ * @param outNodeTimingData nodes timing data to fill
+ * @return success flag
+ */
+bool unpackNodeTimings(
+		const PackedNodeTimingsData& inPackedTimings,
+		std::vector<NodeTimingData>& outNodeTimingData) {
+	size_t nodesNum = inPackedTimings.mNodesVec.size();
+	if(inPackedTimings.mValuesVec.size() != nodesNum * ePackedNodeValuesNum)
+		return false;
+
+	outNodeTimingData.resize(nodesNum);
+	for(size_t nodeIdx = 0; nodeIdx < nodesNum; nodeIdx++) {
+		const PackedNodeData& packedData = inPackedTimings.mNodesVec[nodeIdx];
+		NodeTimingData& data = outNodeTimingData[nodeIdx];
+		data.mNodeId = packedData.mNodeId;
+		data.mEndPointIdx = packedData.mEndPointIdx;
+		data.mClkIdx = packedData.mClkIdx;
+		data.mIsEndPoint = packedData.mFlags & ePackedNodeEndPoint;
+		data.mHasTiming = packedData.mFlags & ePackedNodeHasTiming;
+		data.mNonData = packedData.mFlags & ePackedNodeNonData;
+		data.mHasEndMaxPathRat = packedData.mFlags & ePackedNodeHasEndMaxPathRat;
+		data.mHasEndMinPathRat = packedData.mFlags & ePackedNodeHasEndMinPathRat;
+	}
+
+	std::vector<float> valuesVec(nodesNum);
+	for(size_t column = 0; column < ePackedNodeValuesNum; column++) {
+		decodePackedNodeValues(
+				inPackedTimings.mValuesVec.data() + column * nodesNum, nodesNum,
+				inPackedTimings.mOffset, inPackedTimings.mScale,
+				valuesVec.data());
+
+		float NodeTimingData::* field = cPackedNodeValueFields[column];
+		for(size_t nodeIdx = 0; nodeIdx < nodesNum; nodeIdx++)
+			outNodeTimingData[nodeIdx].*field = valuesVec[nodeIdx];
+	}
+
+	return true;
+}
+
+/**
+ * Decodes column of packed timing values, min and max codes become unset values.
+ * Takes 8 codes per step with SSE2 if it's available.
+ * @param inCodesPtr codes to decode
+ * @param inCodesNum amount of codes
+ * @param inOffset offset of values
+ * @param inScale scale of codes
+ * @param outValuesPtr values to fill
+ */
+void decodePackedNodeValues(
+		const int16_t* inCodesPtr,
+		size_t inCodesNum,
+		float inOffset,
+		float inScale,
+		float* outValuesPtr) {
+	size_t codeIdx = 0;
+
+#if defined(__SSE2__)
+	const __m128 offsetVec = _mm_set1_ps(inOffset);
+	const __m128 scaleVec = _mm_set1_ps(inScale);
+	const __m128 lowValueVec = _mm_set1_ps(cPackedNodeLowValue);
+	const __m128 highValueVec = _mm_set1_ps(cPackedNodeHighValue);
+	const __m128i lowCodeVec = _mm_set1_epi32(std::numeric_limits<int16_t>::min());
+	const __m128i highCodeVec = _mm_set1_epi32(std::numeric_limits<int16_t>::max());
+
+	for(; codeIdx + 8 <= inCodesNum; codeIdx += 8) {
+		__m128i codesVec = _mm_loadu_si128(
+				reinterpret_cast<const __m128i*>(inCodesPtr + codeIdx));
+
+		//sign-extending halves of codes to 32 bits
+		__m128i halvesVec[2] = {
+				_mm_srai_epi32(_mm_unpacklo_epi16(codesVec, codesVec), 16),
+				_mm_srai_epi32(_mm_unpackhi_epi16(codesVec, codesVec), 16)};
+
+		for(size_t half = 0; half < 2; half++) {
+			__m128 valuesVec = _mm_add_ps(offsetVec,
+					_mm_mul_ps(_mm_cvtepi32_ps(halvesVec[half]), scaleVec));
+
+			__m128 lowMaskVec = _mm_castsi128_ps(
+					_mm_cmpeq_epi32(halvesVec[half], lowCodeVec));
+			__m128 highMaskVec = _mm_castsi128_ps(
+					_mm_cmpeq_epi32(halvesVec[half], highCodeVec));
+
+			valuesVec = _mm_or_ps(
+					_mm_andnot_ps(_mm_or_ps(lowMaskVec, highMaskVec), valuesVec),
+					_mm_or_ps(
+						_mm_and_ps(lowMaskVec, lowValueVec),
+						_mm_and_ps(highMaskVec, highValueVec)));
+
+			_mm_storeu_ps(outValuesPtr + codeIdx + half * 4, valuesVec);
+		}
+	}
+#endif
+
+	for(; codeIdx < inCodesNum; codeIdx++) {
+		int16_t code = inCodesPtr[codeIdx];
+		if(code == std::numeric_limits<int16_t>::min())
+			outValuesPtr[codeIdx] = cPackedNodeLowValue;
+		else if(code == std::numeric_limits<int16_t>::max())
+			outValuesPtr[codeIdx] = cPackedNodeHighValue;
+		else
+			outValuesPtr[codeIdx] = inOffset + code * inScale;
+	}
+}
+
+/**
+ * Adds endpoint slack to summary of clock or design.
+ * @param inSlack endpoint slack
+ * @param inMinConstraint flag of min-constraint
+ * @param ioSummary summary to update
+ */
+static void addSummarySlack(
+		float inSlack,
+		bool inMinConstraint,
+		ClockTimingSummaryData& ioSummary) {
+	if(inSlack >= 0)
+		return;
+
+	if(inMinConstraint) {
+		ioSummary.mMinFailingNum++;
+		ioSummary.mMinTNS += inSlack;
+		ioSummary.mMinWNS = std::min(ioSummary.mMinWNS, inSlack);
+		return;
+	}
+
+	ioSummary.mMaxFailingNum++;
+	ioSummary.mMaxTNS += inSlack;
+	ioSummary.mMaxWNS = std::min(ioSummary.mMaxWNS, inSlack);
+}
+
+/**
+ * Adds endpoint slack to histogram,
+ * slacks out of the range go to the first and the last bins.
+ * @param inSlack endpoint slack
+ * @param inCommand command with histogram range
+ * @param ioHistVec histogram to update
+ */
+static void addHistogramSlack(
+		float inSlack,
+		const CommandGetTimingSummary& inCommand,
+		std::vector<uint32_t>& ioHistVec) {
+	if(ioHistVec.empty())
+		return;
+
+	float binPos = (inSlack - inCommand.mHistMinSlack) /
+			(inCommand.mHistMaxSlack - inCommand.mHistMinSlack) *
+			ioHistVec.size();
+
+	size_t binIdx = 0;
+	if(binPos >= ioHistVec.size())
+		binIdx = ioHistVec.size() - 1;
+	else if(binPos > 0)
+		binIdx = static_cast<size_t>(binPos);
+
+	ioHistVec[binIdx]++;
+}
+
+/**
+ * Checks histogram options of timing summary command.
+ * Range must be non-empty if bins are requested, amount of bins is limited.
+ * @param inCommand command with histogram options
+ * @return validity flag
+ */
+bool isTimingSummaryCommandValid(
+		const CommandGetTimingSummary& inCommand) {
+	if(inCommand.mHistBinsNum > cMaxTimingSummaryBinsNum)
+		return false;
+
+	return inCommand.mHistBinsNum == 0 ||
+			inCommand.mHistMaxSlack > inCommand.mHistMinSlack;
+}
+
+/**
+ * Aggregates endpoint slacks of node timing data into summary.
+ * Collects WNS/TNS and failing endpoints of design and of each clock,
+ * fills fixed-bin slack histograms of endpoints.
+ * Non-data nodes and unconstrained slacks are skipped.
+ * Fails on invalid histogram range or too many bins.
+ * @param inNodeTimingData nodes timing data
+ * @param inCommand command with histogram options
+ * @param outSummary summary to fill
+ * @return success flag
+ */
+bool calcTimingSummary(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		const CommandGetTimingSummary& inCommand,
+		TimingSummaryData& outSummary) {
+	outSummary = TimingSummaryData();
+
+	if(!isTimingSummaryCommandValid(inCommand))
+		return false;
+
+	outSummary.mHistMinSlack = inCommand.mHistMinSlack;
+	outSummary.mHistMaxSlack = inCommand.mHistMaxSlack;
+	outSummary.mMinHistogramVec.resize(inCommand.mHistBinsNum, 0);
+	outSummary.mMaxHistogramVec.resize(inCommand.mHistBinsNum, 0);
+
+	std::vector<ClockTimingSummaryData> clocksVec;
+	float minSlack = 0;
+	float maxSlack = 0;
+
+	for(const NodeTimingData& data : inNodeTimingData) {
+		if(!data.mIsEndPoint || !data.mHasTiming || data.mNonData)
+			continue;
+
+		minSlack = getNodeTimingSlack(data, true);
+		maxSlack = getNodeTimingSlack(data, false);
+
+		bool minSet = isNodeTimingSlackSet(minSlack);
+		bool maxSet = isNodeTimingSlackSet(maxSlack);
+		if(!minSet && !maxSet)
+			continue;
+
+		ClockTimingSummaryData* clockPtr = nullptr;
+		if(data.mClkIdx >= 0) {
+			if(static_cast<size_t>(data.mClkIdx) >= clocksVec.size())
+				clocksVec.resize(data.mClkIdx+1);
+			clockPtr = &clocksVec[data.mClkIdx];
+			clockPtr->mEndPointsNum++;
+		}
+		outSummary.mDesign.mEndPointsNum++;
+
+		if(minSet) {
+			addSummarySlack(minSlack, true, outSummary.mDesign);
+			if(clockPtr)
+				addSummarySlack(minSlack, true, *clockPtr);
+			addHistogramSlack(minSlack, inCommand, outSummary.mMinHistogramVec);
+		}
+
+		if(maxSet) {
+			addSummarySlack(maxSlack, false, outSummary.mDesign);
+			if(clockPtr)
+				addSummarySlack(maxSlack, false, *clockPtr);
+			addHistogramSlack(maxSlack, inCommand, outSummary.mMaxHistogramVec);
+		}
+	}
+
+	//keeping only clocks that have endpoints
+	for(size_t clkIdx = 0; clkIdx < clocksVec.size(); clkIdx++) {
+		if(!clocksVec[clkIdx].mEndPointsNum)
+			continue;
+
+		clocksVec[clkIdx].mClkIdx = clkIdx;
+		outSummary.mClocksVec.push_back(clocksVec[clkIdx]);
+	}
+
+	return true;
+}
+
+
+}
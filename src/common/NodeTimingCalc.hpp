@@ -0,0 +1,155 @@
+#ifndef SRC_COMMON_NODETIMINGCALC_HPP_
+#define SRC_COMMON_NODETIMINGCALC_HPP_
+
+
+#include "channel/Messages.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace stamask {
+
+
+/** slacks beyond this value come from unset RAT/AAT of node timing data */
+constexpr float cNodeTimingUnsetSlack = 1e29;
+
+/** max absolute code of set value in packed node timings */
+constexpr int16_t cPackedNodeValueMaxCode = 32766;
+
+/** max amount of slack histogram bins, keeps timing summary small */
+constexpr uint32_t cMaxTimingSummaryBinsNum = 1024;
+
+
+/**
+ * Returns slack of node timing data, hold slack for min-constraint.
+ * @param inData timing data of the node
+ * @param inMinConstraint flag of min-constraint
+ * @return node slack
+ */
+inline float getNodeTimingSlack(
+		const NodeTimingData& inData,
+		bool inMinConstraint) {
+	if(inMinConstraint)
+		return inData.mMinWorstSlackAat - inData.mMinWorstSlackRat;
+
+	return inData.mMaxWorstSlackRat - inData.mMaxWorstSlackAat;
+}
+
+/**
+ * Checks that slack isn't derived from unset RAT/AAT.
+ * @param inSlack slack value
+ * @return flag of constrained slack
+ */
+inline bool isNodeTimingSlackSet(float inSlack) {
+	return inSlack < cNodeTimingUnsetSlack &&
+			inSlack > -cNodeTimingUnsetSlack;
+}
+
+bool collectClockWorstTimings(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		std::vector<float>& outClockMinWorstRatVec,
+		std::vector<float>& outClockMaxWorstRatVec,
+		std::vector<float>& outClockMinWorstSlackVec,
+		std::vector<float>& outClockMaxWorstSlackVec);
+
+bool calcNodeTimingCritFactors(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		std::vector<float>& outNodeCritFactorsVec,
+		const std::vector<float>& inWorstRatPerClockVec,
+		const std::vector<float>& inWorstSlackPerClockVec,
+		bool inMinConstraint);
+
+bool calcNodeTimingCritFactors(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		std::vector<float>& outNodeMinCritFactorsVec,
+		std::vector<float>& outNodeMaxCritFactorsVec);
+
+/**
+ * Converts criticality factors in [0, 1] to fixed-point numbers.
+ * Factor 1 becomes the max value of fixed-point type.
+ * @param inFactorsVec factors to convert
+ * @param outFixedVec fixed-point factors to fill
+ */
+template<typename _FixedType>
+void quantizeCritFactors(
+		const std::vector<float>& inFactorsVec,
+		std::vector<_FixedType>& outFixedVec) {
+	constexpr float cMaxFixed = std::numeric_limits<_FixedType>::max();
+
+	outFixedVec.resize(inFactorsVec.size());
+	for(size_t nodeIdx = 0; nodeIdx < inFactorsVec.size(); nodeIdx++) {
+		float factor = inFactorsVec[nodeIdx];
+		if(!(factor > 0))
+			factor = 0;
+		if(factor > 1)
+			factor = 1;
+		outFixedVec[nodeIdx] = std::lround(factor * cMaxFixed);
+	}
+}
+
+/**
+ * Converts fixed-point criticality factors back to floats.
+ * @param inFixedVec fixed-point factors to convert
+ * @param outFactorsVec factors to fill
+ */
+template<typename _FixedType>
+void dequantizeCritFactors(
+		const std::vector<_FixedType>& inFixedVec,
+		std::vector<float>& outFactorsVec) {
+	constexpr float cFixedScale = 1.0f / std::numeric_limits<_FixedType>::max();
+
+	outFactorsVec.resize(inFixedVec.size());
+	for(size_t nodeIdx = 0; nodeIdx < inFixedVec.size(); nodeIdx++)
+		outFactorsVec[nodeIdx] = inFixedVec[nodeIdx] * cFixedScale;
+}
+
+bool selectNodeTimingsSubset(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		const CommandGetGraphSlacksSubset& inCommand,
+		const std::vector<bool>& inConeVec,
+		std::vector<NodeTimingData>& outNodeTimingsVec);
+
+bool isCritFactorsCommandValid(
+		const CommandGetCritFactors& inCommand);
+
+bool calcQuantizedCritFactors(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		const CommandGetCritFactors& inCommand,
+		CritFactorsData& outFactors);
+
+bool dequantizeCritFactors(
+		const CritFactorsData& inFactors,
+		std::vector<float>& outNodeMinCritFactorsVec,
+		std::vector<float>& outNodeMaxCritFactorsVec);
+
+void packNodeTimings(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		PackedNodeTimingsData& outPackedTimings);
+
+bool unpackNodeTimings(
+		const PackedNodeTimingsData& inPackedTimings,
+		std::vector<NodeTimingData>& outNodeTimingData);
+
+void decodePackedNodeValues(
+		const int16_t* inCodesPtr,
+		size_t inCodesNum,
+		float inOffset,
+		float inScale,
+		float* outValuesPtr);
+
+bool isTimingSummaryCommandValid(
+		const CommandGetTimingSummary& inCommand);
+
+bool calcTimingSummary(
+		const std::vector<NodeTimingData>& inNodeTimingData,
+		const CommandGetTimingSummary& inCommand,
+		TimingSummaryData& outSummary);
+
+
+}
+
+
+#endif /* SRC_COMMON_NODETIMINGCALC_HPP_ */
@@ -0,0 +1,124 @@
+#ifndef SRC_COMMON_TIMINGDATA_HPP_
+#define SRC_COMMON_TIMINGDATA_HPP_
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace stamask {
+
+/**
+ * Min and max delays of graph edge.
+ */
+struct ArcDelayData {
+	uint32_t mEdgeId = -1;
+	float mMinDelay = 0; //caution! in seconds!
+	float mMaxDelay = 0;
+};
+
+/**
+ * Timing data of graph's node.
+ * Edge timing may be derived from data of two vertices.
+ */
+struct NodeTimingData {
+	uint32_t mNodeId = -1;
+	bool mIsEndPoint = false;
+
+	//flag to mark nodes that have no constraints
+	bool mHasTiming = false;
+
+	/** flag that path belongs to non-data paths */
+	bool mNonData = false;
+
+	//for min-max slacks of both setup and hold analysis, rise/fall doesn't matter
+	float mMinWorstSlackRat = -1e30;
+	float mMinWorstSlackAat = 1e30;
+	float mMaxWorstSlackRat = 1e30;
+	float mMaxWorstSlackAat = -1e30;
+
+	//flag to mark RAT of path endpoint, useful to calculate criticalness
+	bool mHasEndMaxPathRat = false;
+	float mMaxPathRat = 0;
+
+	bool mHasEndMinPathRat = false;
+	float mMinPathRat = 0;
+
+	//need this to convert slacks into critical factors based on RATs of their own endpoints
+	uint32_t mEndPointIdx = -1;
+
+	int mClkIdx = 0;
+};
+
+/**
+ * Stage of timing path, vertex ID is the one of graph mapping.
+ */
+struct TimingPathStageData {
+	uint32_t mVertexId = -1;
+	float mArrival = 0;
+	float mRequired = 0;
+	float mSlack = 0;
+};
+
+/**
+ * Timing path, it's stages are a range in stages array of paths data.
+ * Clock indices are the same as in node timing data.
+ */
+struct TimingPathData {
+	uint32_t mGroupIdx = 0;
+	uint32_t mStartVertexId = -1;
+	uint32_t mEndVertexId = -1;
+	uint32_t mFirstStageIdx = 0;
+	uint32_t mStagesNum = 0;
+	int mLaunchClkIdx = 0;
+	int mCaptureClkIdx = 0;
+	bool mMin = false;
+	float mArrival = 0;
+	float mRequired = 0;
+	float mSlack = 0;
+};
+
+/**
+ * Critical timing paths, ordered by group and then by slack.
+ */
+struct TimingPathsData {
+	std::vector<std::string> mGroupNamesVec;
+	std::vector<TimingPathData> mPathsVec;
+	std::vector<TimingPathStageData> mStagesVec;
+};
+
+/**
+ * Endpoint slack stats of a clock, clock index is the same as in node timing data.
+ * WNS is zero if no endpoint fails, TNS sums negative slacks.
+ */
+struct ClockTimingSummaryData {
+	int mClkIdx = -1;
+	uint32_t mEndPointsNum = 0;
+	uint32_t mMinFailingNum = 0;
+	uint32_t mMaxFailingNum = 0;
+	float mMinWNS = 0;
+	float mMaxWNS = 0;
+	float mMinTNS = 0;
+	float mMaxTNS = 0;
+};
+
+/**
+ * Endpoint slack summary of the design.
+ * Contains only clocks that have endpoints,
+ * histograms count endpoints per slack bin.
+ */
+struct TimingSummaryData {
+	ClockTimingSummaryData mDesign;
+	std::vector<ClockTimingSummaryData> mClocksVec;
+	float mHistMinSlack = 0;
+	float mHistMaxSlack = 0;
+	std::vector<uint32_t> mMinHistogramVec;
+	std::vector<uint32_t> mMaxHistogramVec;
+};
+
+
+}
+
+
+#endif /* SRC_COMMON_TIMINGDATA_HPP_ */
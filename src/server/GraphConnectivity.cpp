@@ -0,0 +1,201 @@
+
+#include "GraphConnectivity.hpp"
+
+#include <utility>
+
+
+namespace stamask {
+
+
+/**
+ * Constructor of empty connectivity.
+ */
+GraphConnectivity::GraphConnectivity():
+		mFingerprint(),
+		mBuilt(false),
+		mFanOutOffsetsVec(),
+		mFanOutVertexIdsVec(),
+		mFanInOffsetsVec(),
+		mFanInVertexIdsVec() {}
+
+/**
+ * Checks that lists were built for the graph with the same fingerprint.
+ * @param inFingerprint fingerprint of current graph
+ * @return flag of actual lists
+ */
+bool GraphConnectivity::isBuiltFor(
+		const GraphFingerprintData& inFingerprint) const {
+	return mBuilt &&
+			mFingerprint.mGraphGeneration == inFingerprint.mGraphGeneration &&
+			mFingerprint.mGraphHash == inFingerprint.mGraphHash &&
+			mFingerprint.mVerticesNum == inFingerprint.mVerticesNum &&
+			mFingerprint.mEdgesNum == inFingerprint.mEdgesNum;
+}
+
+/**
+ * Builds fan-in and fan-out lists from edges mapping.
+ * Skips holes of the mapping and edges of unknown vertices.
+ * @param inFingerprint fingerprint of the graph
+ * @param inVerticesNum amount of vertex IDs
+ * @param inEdgeIdToDataVec edges mapping, index is an edge ID
+ */
+void GraphConnectivity::build(
+		const GraphFingerprintData& inFingerprint,
+		uint32_t inVerticesNum,
+		const std::vector<EdgeIdData>& inEdgeIdToDataVec) {
+	fillAdjacency(inVerticesNum, inEdgeIdToDataVec, true,
+			mFanOutOffsetsVec, mFanOutVertexIdsVec);
+	fillAdjacency(inVerticesNum, inEdgeIdToDataVec, false,
+			mFanInOffsetsVec, mFanInVertexIdsVec);
+	mFingerprint = inFingerprint;
+	mBuilt = true;
+}
+
+/**
+ * Drops all lists.
+ */
+void GraphConnectivity::clear() {
+	mFingerprint = GraphFingerprintData();
+	mBuilt = false;
+	mFanOutOffsetsVec.clear();
+	mFanOutVertexIdsVec.clear();
+	mFanInOffsetsVec.clear();
+	mFanInVertexIdsVec.clear();
+}
+
+/**
+ * Returns amount of vertex IDs covered by the lists.
+ * @return amount of vertex IDs
+ */
+uint32_t GraphConnectivity::getVerticesNum() const {
+	if(mFanOutOffsetsVec.empty())
+		return 0;
+	return mFanOutOffsetsVec.size() - 1;
+}
+
+/**
+ * Marks given vertices and their fan-in/fan-out cones as selected.
+ * Cones are walked up to given depth in edges, zero depth skips the cone.
+ * Vertices out of the graph are ignored.
+ * @param inVertexIdsVec IDs of cone roots
+ * @param inFanInDepth depth of fan-in cone
+ * @param inFanOutDepth depth of fan-out cone
+ * @param ioSelectedVec selection flags indexed by vertex ID, resized to the graph
+ */
+void GraphConnectivity::collectCone(
+		const std::vector<uint32_t>& inVertexIdsVec,
+		uint32_t inFanInDepth,
+		uint32_t inFanOutDepth,
+		std::vector<bool>& ioSelectedVec) const {
+	ioSelectedVec.resize(getVerticesNum(), false);
+
+	for(uint32_t vertexId : inVertexIdsVec) {
+		if(vertexId < ioSelectedVec.size())
+			ioSelectedVec[vertexId] = true;
+	}
+
+	walkCone(inVertexIdsVec, inFanInDepth,
+			mFanInOffsetsVec, mFanInVertexIdsVec, ioSelectedVec);
+	walkCone(inVertexIdsVec, inFanOutDepth,
+			mFanOutOffsetsVec, mFanOutVertexIdsVec, ioSelectedVec);
+}
+
+/**
+ * Fills adjacency lists of one direction in compressed form.
+ * @param inVerticesNum amount of vertex IDs
+ * @param inEdgeIdToDataVec edges mapping
+ * @param inFanOut flag to fill fan-out lists, otherwise fan-in
+ * @param outOffsetsVec ranges of vertices' lists, one extra at the end
+ * @param outVertexIdsVec adjacent vertices of all lists
+ */
+void GraphConnectivity::fillAdjacency(
+		uint32_t inVerticesNum,
+		const std::vector<EdgeIdData>& inEdgeIdToDataVec,
+		bool inFanOut,
+		std::vector<uint32_t>& outOffsetsVec,
+		std::vector<uint32_t>& outVertexIdsVec) {
+	outOffsetsVec.assign(inVerticesNum + 1, 0);
+	outVertexIdsVec.clear();
+
+	//counting edges of each vertex first, then placing them in their ranges
+	for(size_t edgeId = 0; edgeId < inEdgeIdToDataVec.size(); edgeId++) {
+		const EdgeIdData& edge = inEdgeIdToDataVec[edgeId];
+		if(edge.mEdgeId != edgeId ||
+				edge.mFromVertexId >= inVerticesNum ||
+				edge.mToVertexId >= inVerticesNum)
+			continue;
+
+		outOffsetsVec[(inFanOut ? edge.mFromVertexId : edge.mToVertexId) + 1]++;
+	}
+
+	for(uint32_t vertexId = 0; vertexId < inVerticesNum; vertexId++)
+		outOffsetsVec[vertexId + 1] += outOffsetsVec[vertexId];
+
+	outVertexIdsVec.resize(outOffsetsVec[inVerticesNum]);
+	std::vector<uint32_t> fillOffsetsVec(
+			outOffsetsVec.begin(), outOffsetsVec.end() - 1);
+
+	for(size_t edgeId = 0; edgeId < inEdgeIdToDataVec.size(); edgeId++) {
+		const EdgeIdData& edge = inEdgeIdToDataVec[edgeId];
+		if(edge.mEdgeId != edgeId ||
+				edge.mFromVertexId >= inVerticesNum ||
+				edge.mToVertexId >= inVerticesNum)
+			continue;
+
+		if(inFanOut)
+			outVertexIdsVec[fillOffsetsVec[edge.mFromVertexId]++] = edge.mToVertexId;
+		else
+			outVertexIdsVec[fillOffsetsVec[edge.mToVertexId]++] = edge.mFromVertexId;
+	}
+}
+
+/**
+ * Walks cone of one direction level by level and marks reached vertices.
+ * Each vertex is expanded once, at the depth it's reached first.
+ * @param inVertexIdsVec IDs of cone roots
+ * @param inDepth max depth of the cone in edges
+ * @param inOffsetsVec ranges of vertices' lists
+ * @param inAdjVertexIdsVec adjacent vertices of all lists
+ * @param ioSelectedVec selection flags indexed by vertex ID
+ */
+void GraphConnectivity::walkCone(
+		const std::vector<uint32_t>& inVertexIdsVec,
+		uint32_t inDepth,
+		const std::vector<uint32_t>& inOffsetsVec,
+		const std::vector<uint32_t>& inAdjVertexIdsVec,
+		std::vector<bool>& ioSelectedVec) {
+	if(!inDepth || inOffsetsVec.empty())
+		return;
+
+	uint32_t verticesNum = inOffsetsVec.size() - 1;
+	std::vector<bool> visitedVec(verticesNum, false);
+	std::vector<uint32_t> levelVec;
+	std::vector<uint32_t> nextLevelVec;
+
+	for(uint32_t vertexId : inVertexIdsVec) {
+		if(vertexId >= verticesNum || visitedVec[vertexId])
+			continue;
+		visitedVec[vertexId] = true;
+		levelVec.push_back(vertexId);
+	}
+
+	for(uint32_t depth = 0; depth < inDepth && !levelVec.empty(); depth++) {
+		nextLevelVec.clear();
+		for(uint32_t vertexId : levelVec) {
+			for(uint32_t adjIdx = inOffsetsVec[vertexId];
+					adjIdx < inOffsetsVec[vertexId + 1]; adjIdx++) {
+				uint32_t adjVertexId = inAdjVertexIdsVec[adjIdx];
+				if(visitedVec[adjVertexId])
+					continue;
+
+				visitedVec[adjVertexId] = true;
+				ioSelectedVec[adjVertexId] = true;
+				nextLevelVec.push_back(adjVertexId);
+			}
+		}
+		std::swap(levelVec, nextLevelVec);
+	}
+}
+
+
+}
@@ -0,0 +1,78 @@
+#ifndef SRC_SERVER_GRAPHCONNECTIVITY_HPP_
+#define SRC_SERVER_GRAPHCONNECTIVITY_HPP_
+
+
+#include "channel/Messages.hpp"
+
+#include <cstdint>
+#include <vector>
+
+
+namespace stamask {
+
+
+/**
+ * Fan-in and fan-out lists of timing graph vertices built from edges mapping.
+ * Keeps fingerprint of the graph it was built for,
+ * so it's rebuilt only after the graph changes.
+ */
+class GraphConnectivity {
+
+	/** fingerprint of the graph lists were built for */
+	GraphFingerprintData mFingerprint;
+
+	/** flag that lists were built */
+	bool mBuilt;
+
+	/** range of vertex's fan-out in fan-out vertices, indexed by vertex ID */
+	std::vector<uint32_t> mFanOutOffsetsVec;
+	std::vector<uint32_t> mFanOutVertexIdsVec;
+
+	/** range of vertex's fan-in in fan-in vertices, indexed by vertex ID */
+	std::vector<uint32_t> mFanInOffsetsVec;
+	std::vector<uint32_t> mFanInVertexIdsVec;
+
+public:
+
+	GraphConnectivity();
+
+	bool isBuiltFor(const GraphFingerprintData& inFingerprint) const;
+
+	void build(
+			const GraphFingerprintData& inFingerprint,
+			uint32_t inVerticesNum,
+			const std::vector<EdgeIdData>& inEdgeIdToDataVec);
+
+	void clear();
+
+	uint32_t getVerticesNum() const;
+
+	void collectCone(
+			const std::vector<uint32_t>& inVertexIdsVec,
+			uint32_t inFanInDepth,
+			uint32_t inFanOutDepth,
+			std::vector<bool>& ioSelectedVec) const;
+
+protected:
+
+	static void fillAdjacency(
+			uint32_t inVerticesNum,
+			const std::vector<EdgeIdData>& inEdgeIdToDataVec,
+			bool inFanOut,
+			std::vector<uint32_t>& outOffsetsVec,
+			std::vector<uint32_t>& outVertexIdsVec);
+
+	static void walkCone(
+			const std::vector<uint32_t>& inVertexIdsVec,
+			uint32_t inDepth,
+			const std::vector<uint32_t>& inOffsetsVec,
+			const std::vector<uint32_t>& inAdjVertexIdsVec,
+			std::vector<bool>& ioSelectedVec);
+
+};
+
+
+}
+
+
+#endif /* SRC_SERVER_GRAPHCONNECTIVITY_HPP_ */
@@ -1,341 +1,871 @@
-
-#include "server/StaServerIpcProtocol.hpp"
-
-#include <iostream>
-
-namespace stamask {
-
-
-/**
- * Initializes channel and commands handler.
- * Doesn't throw anything if nullptr is passed.
- * @param inChannelPtr channel to send/receive messages
- * @param inStaHandlerPtr commands executor
- */
-StaServerIpcProtocol::StaServerIpcProtocol(
-		IpcChannel* inChannelPtr,
-		IMessageExecutor* inStaHandlerPtr):
-			mChannelPtr(inChannelPtr),
-			mStaHandlerPtr(inStaHandlerPtr) {}
-
-/**
- * Deletes channel and executor if they aren't nullptr
- */
-StaServerIpcProtocol::~StaServerIpcProtocol() {
-	if(mChannelPtr)
-		delete mChannelPtr;
-
-	if(mStaHandlerPtr)
-		delete mStaHandlerPtr;
-}
-
-/**
- * Runs cycle to wait for command and execute it.
- * Executes exit command and returns when exit command arrives.
- * Does nothing and returns false if channel or handler is nullptr.
- * If unsupported command arrives, then sends unsupported status response.
- * @return success flag
- */
-bool StaServerIpcProtocol::runCycle() {
-	if(!mChannelPtr || !mStaHandlerPtr)
-		return false;
-
-	bool toExit = false;
-	bool handledCommand = false;
-
-	while(!toExit) {
-		handledCommand = true;
-		mChannelPtr->waitMessageArrival();
-
-		switch(mChannelPtr->peekMessageType()) {
-			case EMessageType::EMessageTypeExit:
-				handleMessageWithStatus<CommandExit>();
-				toExit = true;
-				break;
-			case EMessageType::EMessageTypePing:
-				handleMessageWithStatus<CommandPing>();
-				break;
-			case EMessageType::EMessageTypeSetHierSeparator:
-				handleMessageWithStatus<CommandSetHierarhySeparator>();
-				break;
-			case EMessageType::EMessageTypeReadLibFile:
-				handleMessageWithStatus<CommandReadLibertyFile>();
-				break;
-			case EMessageType::EMessageTypeReadLibStream:
-				handleMessageWithStatus<CommandReadLibertyStream>();
-				break;
-			case EMessageType::EMessageTypeClearLibs:
-				handleMessageWithStatus<CommandClearLibs>();
-				break;
-			case EMessageType::EMessageTypeReadVerilogFile:
-				handleMessageWithStatus<CommandReadVerilogFile>();
-				break;
-			case EMessageType::EMessageTypeReadVerilogStream:
-				handleMessageWithStatus<CommandReadVerilogStream>();
-				break;
-			case EMessageType::EMessageTypeLinkTop:
-				handleMessageWithStatus<CommandLinkTop>();
-				break;
-			case EMessageType::EMessageTypeClearNetlistBlocks:
-				handleMessageWithStatus<CommandClearNetlistBlocks>();
-				break;
-			case EMessageType::EMessageTypeCreateNetlist:
-				handleMessageWithStatus<CommandCreateNetlist>();
-				break;
-			case EMessageType::EMessageTypeGetGraphData:
-				handleGetGraphData();
-				break;
-			case EMessageType::EMessageTypeGetGraphSlacksData:
-				handleGetGraphSlacksData();
-				break;
-			case EMessageType::EMessageTypeConnectContextPinNet:
-				handleMessageWithStatus<CommandConnectContextPinNet>();
-				break;
-			case EMessageType::EMessageTypeDisconnectContextPinNet:
-				handleMessageWithStatus<CommandDisconnectContextPinNet>();
-				break;
-			case EMessageType::EMessageTypeReadSpefFile:
-				handleMessageWithStatus<CommandReadSpefFile>();
-				break;
-			case EMessageType::EMessageTypeReadSpefStream:
-				handleMessageWithStatus<CommandReadSpefStream>();
-				break;
-			case EMessageType::EMessageTypeSetGroupNetLumpCap:
-				handleMessageWithStatus<CommandSetGroupNetCap>();
-				break;
-			case EMessageType::EMessageTypeReadSdfFile:
-				handleMessageWithStatus<CommandReadSdfFile>();
-				break;
-			case EMessageType::EMessageTypeWriteSdfFile:
-				handleMessageWithStatus<CommandWriteSdfFile>();
-				break;
-			case EMessageType::EMessageTypeReadSdfStream:
-				handleMessageWithStatus<CommandReadSdfStream>();
-				break;
-			case EMessageType::EMessageTypeSetArcsDelay:
-				handleMessageWithStatus<CommandSetArcsDelays>();
-				break;
-			case EMessageType::EMessageTypeCreateClock:
-				handleMessageWithStatus<CommandCreateClock>();
-				break;
-			case EMessageType::EMessageTypeCreateGeneratedClock:
-				handleMessageWithStatus<CommandCreateGenClock>();
-				break;
-			case EMessageType::EMessageTypeSetClockGroups:
-				handleMessageWithStatus<CommandSetClockGroups>();
-				break;
-			case EMessageType::EMessageTypeSetClockLatency:
-				handleMessageWithStatus<CommandSetClockLatency>();
-				break;
-			case EMessageType::EMessageTypeSetInterClockUncertainty:
-				handleMessageWithStatus<CommandSetInterClockUncertainty>();
-				break;
-			case EMessageType::EMessageTypeSetSingleClockUncertainty:
-				handleMessageWithStatus<CommandSetSingleClockUncertainty>();
-				break;
-			case EMessageType::EMessageTypeSetSinglePinUncertainty:
-				handleMessageWithStatus<CommandSetSinglePinUncertainty>();
-				break;
-			case EMessageType::EMessageTypeSetSinglePortDelay:
-				handleMessageWithStatus<CommandSetPortDelay>();
-				break;
-			case EMessageType::EMessageTypeSetInPortTransition:
-				handleMessageWithStatus<CommandSetInPortTransition>();
-				break;
-			case EMessageType::EMessageTypeSetPortPinLoad:
-				handleMessageWithStatus<CommandSetPortPinLoad>();
-				break;
-			case EMessageType::EMessageTypeSetFalsePath:
-				handleMessageWithStatus<CommandSetFalsePath>();
-				break;
-			case EMessageType::EMessageTypeSetMinMaxDelay:
-				handleMessageWithStatus<CommandSetMinMaxDelay>();
-				break;
-			case EMessageType::EMessageTypeSetMulticyclePath:
-				handleMessageWithStatus<CommandSetMulticyclePath>();
-				break;
-			case EMessageType::EMessageTypeDisableSinglePinTiming:
-				handleMessageWithStatus<CommandDisableSinglePinTiming>();
-				break;
-			case EMessageType::EMessageTypeDisableInstTiming:
-				handleMessageWithStatus<CommandDisableInstTiming>();
-				break;
-			case EMessageType::EMessageTypeSetGlobalTimingDerate:
-				handleMessageWithStatus<CommandSetGlobalTimingDerate>();
-				break;
-
-			case EMessageType::EMessageTypeReportTiming:
-				handleReportTiming();
-				break;
-			case EMessageType::EMessageTypeGetDesignStats:
-				handleGetDesignStats();
-				break;
-
-			default:
-				handledCommand = false;
-		}
-
-		if(handledCommand)
-			continue;
-
-		sendStatusResponse(
-				EMessageStatus::eMessageStatusUnsupported,
-				"unsupported command" + mChannelPtr->peekMessageType());
-	}
-
-	return true;
-}
-
-
-/**
- * Sends status response.
- * Returns true if message was successfully sent.
- * @param inStatus status to send
- * @param inMessage message to send
- * @return send success
- */
-bool StaServerIpcProtocol::sendStatusResponse(
-						EMessageStatus inStatus,
-						const std::string& inMessage) {
-	ResponseCommExecStatus response;
-	response.mExecStatus = inStatus;
-	response.mStr = inMessage;
-	return mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
-}
-
-/**
- * Handles command to report timing.
- * Operates like \link handleMessageWithStatus, but also sends out report string.
- * @return success status
- */
-bool StaServerIpcProtocol::handleReportTiming() {
-
-	CommandReportTiming command;
-	EMessageStatus status = EMessageStatus::eMessageStatusOk;
-
-	bool ok = true;
-	if(mChannelPtr->popMessage(command) !=
-			EMessageStatus::eMessageStatusOk) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	std::string reportStr;
-	if(ok && !mStaHandlerPtr->execute(command, reportStr)) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	ResponseCommExecStatus response;
-	response.mExecStatus = status;
-	if(status == EMessageStatus::eMessageStatusOk)
-		response.mStr = reportStr;
-
-	return mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
-}
-
-/**
- * Handles command to get design statistics.
- * Operates like \link handleMessageWithStatus, but also sends out report string.
- * @return success status
- */
-bool StaServerIpcProtocol::handleGetDesignStats() {
-
-	CommandGetDesignStats command;
-	EMessageStatus status = EMessageStatus::eMessageStatusOk;
-
-	bool ok = true;
-	if(mChannelPtr->popMessage(command) !=
-			EMessageStatus::eMessageStatusOk) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	std::string reportStr;
-	float minWNS = 0;
-	float maxWNS = 0;
-	float minTNS = 0;
-	float maxTNS = 0;
-
-	if(ok && !mStaHandlerPtr->execute(command,
-			minWNS, maxWNS, minTNS, maxTNS)) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	ResponseDesignStats response;
-	response.mMinTNS = minTNS;
-	response.mMaxTNS = maxTNS;
-	response.mMinWslack = minWNS;
-	response.mMaxWslack = maxWNS;
-
-	response.mExecStatus = status;
-	if(status == EMessageStatus::eMessageStatusOk)
-		response.mStr = reportStr;
-
-	return mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
-}
-
-
-/**
- * Handles command to return mapping of objects in the timing graph.
- * Operates like \link handleMessageWithStatus, but sends out acquired data.
- * @return success status
- */
-bool StaServerIpcProtocol::handleGetGraphData() {
-	CommandGetGraphData command;
-	EMessageStatus status = EMessageStatus::eMessageStatusOk;
-
-	bool ok = true;
-	if(mChannelPtr->popMessage(command) !=
-			EMessageStatus::eMessageStatusOk) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	ResponseGraphMap response;
-	if(ok && !mStaHandlerPtr->execute(
-			command, response.mVertexIdToDataVec,
-			response.mEdgeIdToDataVec)) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	response.mExecStatus = status;
-	ok &= mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
-	return ok;
-}
-
-
-/**
- * Handles command to return slacks of vertexes in the timing graph.
- * Operates like \link handleMessageWithStatus, but sends out acquired data.
- * @return success status
- */
-bool StaServerIpcProtocol::handleGetGraphSlacksData() {
-	CommandGetGraphSlacksData command;
-	EMessageStatus status = EMessageStatus::eMessageStatusOk;
-
-	bool ok = true;
-	if(mChannelPtr->popMessage(command) !=
-			EMessageStatus::eMessageStatusOk) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	ResponseGraphSlacks response;
-	if(ok && !mStaHandlerPtr->execute(
-			command, response.mNodeTimingsVec)) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	response.mExecStatus = status;
-	return ok && mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
-}
-
-
-
-}
-
-
+
+#include "server/StaServerIpcProtocol.hpp"
+#include "common/NodeTimingCalc.hpp"
+
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/exceptions.hpp>
+
+#include <iostream>
+#include <string>
+
+
+namespace bi = boost::interprocess;
+
+namespace stamask {
+
+
+/**
+ * Initializes channel and commands handler.
+ * Doesn't throw anything if nullptr is passed.
+ * @param inChannelPtr channel to send/receive messages
+ * @param inStaHandlerPtr commands executor
+ */
+StaServerIpcProtocol::StaServerIpcProtocol(
+		IpcChannel* inChannelPtr,
+		IMessageExecutor* inStaHandlerPtr):
+			mChannelPtr(inChannelPtr),
+			mStaHandlerPtr(inStaHandlerPtr),
+			mMessagePool(),
+			mCommandLog(),
+			mCommandLogEnabled(false),
+			mHasState(false),
+			mBlobStore(),
+			mConnectivity(),
+			mGraphCommandsNum(0) {}
+
+/**
+ * Deletes channel and executor if they aren't nullptr
+ */
+StaServerIpcProtocol::~StaServerIpcProtocol() {
+	if(mChannelPtr)
+		delete mChannelPtr;
+
+	if(mStaHandlerPtr)
+		delete mStaHandlerPtr;
+}
+
+/**
+ * Runs cycle to wait for command and execute it.
+ * Executes exit command and returns when exit command arrives.
+ * Does nothing and returns false if channel or handler is nullptr.
+ * Uses message type as an index in dispatch table of command handlers.
+ * If unsupported command arrives, then sends unsupported status response.
+ * Commands that may change the graph are counted before handling.
+ * Channel offers only the features that are enabled on the server.
+ * @return success flag
+ */
+bool StaServerIpcProtocol::runCycle() {
+	if(!mChannelPtr || !mStaHandlerPtr)
+		return false;
+
+	mChannelPtr->setOfferedFeatureFlags(getEnabledFeatureFlags());
+
+	static constexpr MessageDispatchTable<HandlerFuncPtr> cHandlersTable =
+			makeMessageDispatchTable<HandlerFuncPtr, HandlerThunk>(
+					CommandMessagesList());
+
+	bool toExit = false;
+	EMessageType mesgType = EMessageType::EMessageTypeNoMessage;
+
+	while(!toExit) {
+		mChannelPtr->waitMessageArrival();
+		mesgType = mChannelPtr->peekMessageType();
+
+		if(mesgType < cHandlersTable.size() &&
+				cHandlersTable[mesgType]) {
+			if(isGraphCommand(mesgType))
+				mGraphCommandsNum++;
+
+			(this->*cHandlersTable[mesgType])();
+			toExit = mesgType == EMessageType::EMessageTypeExit;
+			continue;
+		}
+
+		sendStatusResponse(
+				EMessageStatus::eMessageStatusUnsupported,
+				"unsupported command " + std::to_string(mesgType));
+	}
+
+	return true;
+}
+
+
+/**
+ * Enables or disables logging of executed commands, it's disabled by default.
+ * Log keeps every state change with streamed data of commands in memory,
+ * without it checkpoints work only with native support of the handler.
+ * @param inEnabled flag to log commands
+ */
+void StaServerIpcProtocol::setCommandLogEnabled(bool inEnabled) {
+	mCommandLogEnabled = inEnabled;
+}
+
+/**
+ * Returns log of executed commands.
+ * @return command log
+ */
+const CommandLog& StaServerIpcProtocol::getCommandLog() const {
+	return mCommandLog;
+}
+
+/**
+ * Returns channel features that server can use with current setup.
+ * Stored streams need blob store or executor's liberty cache,
+ * shared streams are always read.
+ * @return feature flags, see EChannelFeature
+ */
+uint32_t StaServerIpcProtocol::getEnabledFeatureFlags() const {
+	uint32_t featureFlags = eChannelFeatureSharedStreams;
+	if(mBlobStore.isEnabled() || mStaHandlerPtr->hasLibertyCache())
+		featureFlags |= eChannelFeatureStoredStreams;
+	return featureFlags;
+}
+
+/**
+ * Returns store of streamed texts to set it up.
+ * Store is disabled by default.
+ * @return blob store
+ */
+StreamBlobStore& StaServerIpcProtocol::getBlobStore() {
+	return mBlobStore;
+}
+
+/**
+ * Sends status response.
+ * Reuses pooled response instance.
+ * Returns true if message was successfully sent.
+ * @param inStatus status to send
+ * @param inMessage message to send
+ * @return send success
+ */
+bool StaServerIpcProtocol::sendStatusResponse(
+						EMessageStatus inStatus,
+						const std::string& inMessage) {
+	ResponseCommExecStatus& response =
+			mMessagePool.acquire<ResponseCommExecStatus>();
+	response.mExecStatus = inStatus;
+	response.mStr = inMessage;
+	return mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+}
+
+/**
+ * Handles command to report timing.
+ * Operates like \link handleMessageWithStatus, but also sends out report string.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleReportTiming() {
+
+	CommandReportTiming command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	std::string reportStr;
+	if(ok && !mStaHandlerPtr->execute(command, reportStr)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseCommExecStatus response;
+	response.mExecStatus = status;
+	if(status == EMessageStatus::eMessageStatusOk)
+		response.mStr = reportStr;
+
+	return mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+}
+
+/**
+ * Handles command to get design statistics.
+ * Operates like \link handleMessageWithStatus, but also sends out report string.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleGetDesignStats() {
+
+	CommandGetDesignStats command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	std::string reportStr;
+	float minWNS = 0;
+	float maxWNS = 0;
+	float minTNS = 0;
+	float maxTNS = 0;
+
+	if(ok && !mStaHandlerPtr->execute(command,
+			minWNS, maxWNS, minTNS, maxTNS)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseDesignStats response;
+	response.mMinTNS = minTNS;
+	response.mMaxTNS = maxTNS;
+	response.mMinWslack = minWNS;
+	response.mMaxWslack = maxWNS;
+
+	response.mExecStatus = status;
+	if(status == EMessageStatus::eMessageStatusOk)
+		response.mStr = reportStr;
+
+	return mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+}
+
+/**
+ * Handles command to get critical timing paths.
+ * Operates like \link handleMessageWithStatus, but sends out acquired data.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleGetTimingPaths() {
+	CommandGetTimingPaths command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseTimingPaths response;
+	if(ok && !mStaHandlerPtr->execute(
+			command, response.mPaths)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	response.mExecStatus = status;
+	if(!ok)
+		response.mStr = mStaHandlerPtr->getExecMessage();
+
+	ok &= mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+	return ok;
+}
+
+/**
+ * Handles command to get endpoint slack summary.
+ * Handler aggregates it's timing data on server side,
+ * so only summary is sent back.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleGetTimingSummary() {
+	CommandGetTimingSummary command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseTimingSummary response;
+	if(ok && !isTimingSummaryCommandValid(command)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		response.mStr = "Invalid slack histogram options";
+		ok = false;
+	}
+
+	if(ok && !mStaHandlerPtr->execute(command, response.mSummary)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		response.mStr = mStaHandlerPtr->getExecMessage();
+		ok = false;
+	}
+
+	response.mExecStatus = status;
+	ok &= mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+	return ok;
+}
+
+
+/**
+ * Handles command to get timing data of a subset of graph nodes.
+ * Selects nodes from timing data of the handler on server side,
+ * so only selected records are sent back in the order of vertex IDs.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleGetGraphSlacksSubset() {
+	CommandGetGraphSlacksSubset command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseGraphSlacks response;
+	std::vector<bool> coneVec;
+	if(ok && !collectGraphSlacksCone(command, coneVec)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		response.mStr = "Failed to get connectivity of the graph";
+		ok = false;
+	}
+
+	if(ok && !mStaHandlerPtr->execute(
+			command, coneVec, response.mNodeTimingsVec)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		response.mStr = mStaHandlerPtr->getExecMessage();
+		ok = false;
+	}
+
+	response.mExecStatus = status;
+	ok &= mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+	return ok;
+}
+
+/**
+ * Handles command to get quantized criticality factors of all nodes.
+ * Factors are calculated from node timing data of the handler on server side,
+ * so only fixed-point arrays are sent back.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleGetCritFactors() {
+	CommandGetCritFactors command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseCritFactors response;
+	if(ok && !isCritFactorsCommandValid(command)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		response.mStr = "Criticality factors must have 8 or 16 bits";
+		ok = false;
+	}
+
+	if(ok && !mStaHandlerPtr->execute(command, response.mFactors)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		response.mStr = mStaHandlerPtr->getExecMessage();
+		ok = false;
+	}
+
+	response.mExecStatus = status;
+	ok &= mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+	return ok;
+}
+
+/**
+ * Handles command to get packed timing data of all nodes.
+ * Packs node timing data of the handler on server side.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleGetPackedGraphSlacks() {
+	CommandGetPackedGraphSlacks command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponsePackedGraphSlacks response;
+	if(ok && !mStaHandlerPtr->execute(command, response.mPackedTimings)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		response.mStr = mStaHandlerPtr->getExecMessage();
+		ok = false;
+	}
+
+	response.mExecStatus = status;
+	ok &= mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+	return ok;
+}
+
+/**
+ * Collects cone of given vertices of the subset.
+ * Cone is left empty if no vertices or depths are given,
+ * so connectivity of the graph is updated only if cones are needed.
+ * @param inCommand command with subset options
+ * @param outConeVec cone flags indexed by vertex ID
+ * @return success status
+ */
+bool StaServerIpcProtocol::collectGraphSlacksCone(
+		const CommandGetGraphSlacksSubset& inCommand,
+		std::vector<bool>& outConeVec) {
+	outConeVec.clear();
+
+	if(inCommand.mVertexIdsVec.empty() ||
+			(!inCommand.mFanInDepth && !inCommand.mFanOutDepth))
+		return true;
+
+	if(!updateConnectivity())
+		return false;
+
+	mConnectivity.collectCone(inCommand.mVertexIdsVec,
+			inCommand.mFanInDepth, inCommand.mFanOutDepth,
+			outConeVec);
+	return true;
+}
+
+/**
+ * Rebuilds connectivity of the graph if the graph changed since last build.
+ * For handler without fingerprint support the amount of handled
+ * graph commands is used as graph generation.
+ * @return success status
+ */
+bool StaServerIpcProtocol::updateConnectivity() {
+	GraphFingerprintData fingerprint;
+	if(!mStaHandlerPtr->execute(CommandGetGraphFingerprint(), fingerprint)) {
+		fingerprint = GraphFingerprintData();
+		fingerprint.mGraphGeneration = mGraphCommandsNum;
+	}
+
+	if(mConnectivity.isBuiltFor(fingerprint))
+		return true;
+
+	std::vector<VertexIdData> vertexIdToDataVec;
+	std::vector<EdgeIdData> edgeIdToDataVec;
+	if(!mStaHandlerPtr->execute(
+			CommandGetGraphData(), vertexIdToDataVec, edgeIdToDataVec)) {
+		mConnectivity.clear();
+		return false;
+	}
+
+	mConnectivity.build(fingerprint,
+			vertexIdToDataVec.size(), edgeIdToDataVec);
+	return true;
+}
+
+/**
+ * Checks that command may change structure of the timing graph.
+ * Stream commands in the blob store or shared memory are counted
+ * whatever their type is, since it's known only after popping them.
+ * @param inMesgType type of command
+ * @return flag of graph command
+ */
+bool StaServerIpcProtocol::isGraphCommand(EMessageType inMesgType) {
+	switch(inMesgType) {
+	case EMessageType::EMessageTypeReadLibFile:
+	case EMessageType::EMessageTypeReadLibStream:
+	case EMessageType::EMessageTypeReadCachedLib:
+	case EMessageType::EMessageTypeClearLibs:
+	case EMessageType::EMessageTypeReadVerilogFile:
+	case EMessageType::EMessageTypeReadVerilogStream:
+	case EMessageType::EMessageTypeLinkTop:
+	case EMessageType::EMessageTypeClearNetlistBlocks:
+	case EMessageType::EMessageTypeCreateNetlist:
+	case EMessageType::EMessageTypeConnectContextPinNet:
+	case EMessageType::EMessageTypeDisconnectContextPinNet:
+	case EMessageType::EMessageTypeUpdateNetlist:
+	case EMessageType::EMessageTypeLoadCheckpoint:
+	case EMessageType::EMessageTypeReplayCommandLog:
+	case EMessageType::EMessageTypeReadStoredStream:
+	case EMessageType::EMessageTypeReadSharedStream:
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+/**
+ * Handles command to return mapping of objects in the timing graph.
+ * Operates like \link handleMessageWithStatus, but sends out acquired data.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleGetGraphData() {
+	CommandGetGraphData command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseGraphMap response;
+	if(ok && !mStaHandlerPtr->execute(
+			command, response.mVertexIdToDataVec,
+			response.mEdgeIdToDataVec)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	response.mExecStatus = status;
+	ok &= mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+	return ok;
+}
+
+
+/**
+ * Handles command to apply netlist edits.
+ * Operates like \link handleMessageWithStatus, but sends out graph changes.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleUpdateNetlist() {
+	CommandUpdateNetlist command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseGraphChanges response;
+	if(ok && !mStaHandlerPtr->execute(
+			command, response.mChanges)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	//client doesn't wait for logging
+	response.mExecStatus = status;
+	bool sent = mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+	if(ok)
+		logCommand(command);
+
+	return ok && sent;
+}
+
+
+/**
+ * Handles command to return fingerprint of the timing graph.
+ * Operates like \link handleMessageWithStatus, but sends out acquired data.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleGetGraphFingerprint() {
+	CommandGetGraphFingerprint command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseGraphFingerprint response;
+	if(ok && !mStaHandlerPtr->execute(
+			command, response.mFingerprint)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	response.mExecStatus = status;
+	ok &= mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+	return ok;
+}
+
+
+/**
+ * Handles command to save checkpoint.
+ * Compacts command log and writes it in "<prefix>.cmdlog" file,
+ * then lets handler with native support save it's state as well.
+ * Sends failed response if command log is disabled and there's no native support.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleSaveCheckpoint() {
+	CommandSaveCheckpoint command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	if(ok && !mCommandLogEnabled && !mStaHandlerPtr->hasNativeCheckpoint()) {
+		sendStatusResponse(
+				EMessageStatus::eMessageStatusFailed,
+				"command log is disabled");
+		return false;
+	}
+
+	if(ok && mCommandLogEnabled)
+		ok = mCommandLog.compact() &&
+				mCommandLog.save(command.mStr + ".cmdlog");
+
+	if(ok && mStaHandlerPtr->hasNativeCheckpoint())
+		ok = mStaHandlerPtr->execute(command);
+
+	if(!ok)
+		status = EMessageStatus::eMessageStatusFailed;
+
+	ok &= sendStatusResponse(
+			status, mStaHandlerPtr->getExecMessage());
+	return ok;
+}
+
+/**
+ * Handles command to load checkpoint.
+ * Handler with native support restores state by itself,
+ * otherwise commands of "<prefix>.cmdlog" file are replayed on the handler.
+ * Commands are replayed only on fresh STA, failed response is sent
+ * if some command has already changed it's state.
+ * Loaded log replaces current one if logging is enabled,
+ * so the next checkpoint includes it.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleLoadCheckpoint() {
+	CommandLoadCheckpoint command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	bool native = mStaHandlerPtr->hasNativeCheckpoint();
+	if(ok && !native && mHasState) {
+		sendStatusResponse(
+				EMessageStatus::eMessageStatusFailed,
+				"checkpoint is loaded only in fresh STA");
+		return false;
+	}
+
+	bool hasLog = ok && (mCommandLogEnabled || !native) &&
+			mCommandLog.load(command.mStr + ".cmdlog");
+	std::size_t startedNum = 0;
+	if(ok && native)
+		ok = mStaHandlerPtr->execute(command);
+	else if(ok)
+		ok = hasLog && mCommandLog.replay(*mStaHandlerPtr, startedNum);
+
+	if(ok || startedNum)
+		mHasState = true;
+	if(!mCommandLogEnabled)
+		mCommandLog.clear();
+
+	if(!ok)
+		status = EMessageStatus::eMessageStatusFailed;
+
+	ok &= sendStatusResponse(
+			status, mStaHandlerPtr->getExecMessage());
+	return ok;
+}
+
+/**
+ * Handles command to replay batch of logged commands.
+ * Commands are executed in order until the first failure,
+ * executed batch is added in own command log.
+ * STA state is marked changed if any command was started,
+ * even if batch failed later.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleReplayCommandLog() {
+	CommandReplayCommandLog command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	CommandLog replayLog;
+	std::size_t startedNum = 0;
+	if(ok)
+		ok = replayLog.loadFromString(command.mStr) &&
+				replayLog.replay(*mStaHandlerPtr, startedNum);
+
+	if(startedNum)
+		mHasState = true;
+	if(ok && mCommandLogEnabled)
+		mCommandLog.appendLog(replayLog);
+
+	if(!ok)
+		status = EMessageStatus::eMessageStatusFailed;
+
+	ok &= sendStatusResponse(
+			status, mStaHandlerPtr->getExecMessage());
+	return ok;
+}
+
+/**
+ * Handles command to read liberty stream.
+ * Fills content hash of the text for executor to cache parsed library.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleReadLibertyStream() {
+	CommandReadLibertyStream command;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		sendStatusResponse(
+				EMessageStatus::eMessageStatusFailed,
+				"invalid command structure");
+		return false;
+	}
+
+	command.mContentHash = hashContent(command.mStr);
+	return executeStreamCommand(command);
+}
+
+/**
+ * Handles command to read cached liberty as stored liberty stream,
+ * so library is logged with it's text.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleReadCachedLiberty() {
+	CommandReadCachedLiberty command;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		sendStatusResponse(
+				EMessageStatus::eMessageStatusFailed,
+				"invalid command structure");
+		return false;
+	}
+
+	CommandReadStoredStream storedCommand;
+	storedCommand.mStreamMesgType = CommandReadLibertyStream::cMesgType;
+	storedCommand.mContentHash = command.mContentHash;
+	storedCommand.mBytesNum = command.mBytesNum;
+	return executeStoredStream<CommandReadLibertyStream>(storedCommand);
+}
+
+/**
+ * Handles command to execute stream command with stored text.
+ * Stream command type is used to pick the command to execute,
+ * unsupported status is sent for other types.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleReadStoredStream() {
+	CommandReadStoredStream command;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		sendStatusResponse(
+				EMessageStatus::eMessageStatusFailed,
+				"invalid command structure");
+		return false;
+	}
+
+	switch(command.mStreamMesgType) {
+	case EMessageType::EMessageTypeReadLibStream:
+		return executeStoredStream<CommandReadLibertyStream>(command);
+	case EMessageType::EMessageTypeReadVerilogStream:
+		return executeStoredStream<CommandReadVerilogStream>(command);
+	case EMessageType::EMessageTypeReadSpefStream:
+		return executeStoredStream<CommandReadSpefStream>(command);
+	case EMessageType::EMessageTypeReadSdfStream:
+		return executeStoredStream<CommandReadSdfStream>(command);
+	default:
+		sendStatusResponse(
+				EMessageStatus::eMessageStatusUnsupported,
+				"unsupported stream command " +
+						std::to_string(command.mStreamMesgType));
+		return false;
+	}
+}
+
+/**
+ * Handles command to execute stream command with text in shared memory.
+ * Stream command type is used to pick the command to execute,
+ * unsupported status is sent for other types.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleReadSharedStream() {
+	CommandReadSharedStream command;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		sendStatusResponse(
+				EMessageStatus::eMessageStatusFailed,
+				"invalid command structure");
+		return false;
+	}
+
+	switch(command.mStreamMesgType) {
+	case EMessageType::EMessageTypeReadLibStream:
+		return executeSharedStream<CommandReadLibertyStream>(command);
+	case EMessageType::EMessageTypeReadVerilogStream:
+		return executeSharedStream<CommandReadVerilogStream>(command);
+	case EMessageType::EMessageTypeReadSpefStream:
+		return executeSharedStream<CommandReadSpefStream>(command);
+	case EMessageType::EMessageTypeReadSdfStream:
+		return executeSharedStream<CommandReadSdfStream>(command);
+	default:
+		sendStatusResponse(
+				EMessageStatus::eMessageStatusUnsupported,
+				"unsupported stream command " +
+						std::to_string(command.mStreamMesgType));
+		return false;
+	}
+}
+
+/**
+ * Maps shared memory object read-only and copies text from it.
+ * Object is removed right after mapping, so it doesn't outlive
+ * the client that created it.
+ * Returns false if object can't be mapped or is smaller than the text.
+ * @param inShmName name of shared memory object
+ * @param inBytesNum size of the text
+ * @param outText text to fill
+ * @return operation success
+ */
+bool StaServerIpcProtocol::readSharedText(
+		const std::string& inShmName,
+		uint64_t inBytesNum,
+		std::string& outText) {
+	try {
+		bi::shared_memory_object shdMem(
+				bi::open_only, inShmName.c_str(), bi::read_only);
+		bi::mapped_region region(shdMem, bi::read_only);
+		bi::shared_memory_object::remove(inShmName.c_str());
+		if(region.get_size() < inBytesNum)
+			return false;
+
+		outText.assign(
+				static_cast<const char*>(region.get_address()), inBytesNum);
+	} catch(const bi::interprocess_exception&) {
+		return false;
+	}
+
+	return true;
+}
+
+
+/**
+ * Handles command to return slacks of vertexes in the timing graph.
+ * Operates like \link handleMessageWithStatus, but sends out acquired data.
+ * @return success status
+ */
+bool StaServerIpcProtocol::handleGetGraphSlacksData() {
+	CommandGetGraphSlacksData command;
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	ResponseGraphSlacks response;
+	if(ok && !mStaHandlerPtr->execute(
+			command, response.mNodeTimingsVec)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	response.mExecStatus = status;
+	return ok && mChannelPtr->send(response) == EMessageStatus::eMessageStatusOk;
+}
+
+
+
+}
+
+
@@ -1,90 +1,432 @@
-#ifndef SRC_SERVER_STASERVERIPCPROTOCOL_HPP_
-#define SRC_SERVER_STASERVERIPCPROTOCOL_HPP_
-
-
-#include "channel/Messages.hpp"
-#include "channel/IpcChannel.hpp"
-
-#include "IStaServerHandler.hpp"
-
-
-namespace stamask {
-
-
-/**
- * Runs commands cycle, takes care of message interchange
- * with server interface when executing STA commands.
- */
-class StaServerIpcProtocol {
-
-	/** channel to interchange messages */
-	IpcChannel* mChannelPtr;
-
-	/** commands executor */
-	IMessageExecutor* mStaHandlerPtr;
-
-public:
-
-	StaServerIpcProtocol(
-			IpcChannel* inChannelPtr,
-			IMessageExecutor* inStaHandlerPtr);
-
-	~StaServerIpcProtocol();
-
-	bool runCycle();
-
-protected:
-
-	bool sendStatusResponse(
-			EMessageStatus inStatus,
-			const std::string& inMessage);
-
-	template <typename _MessageType>
-	bool handleMessageWithStatus();
-
-	bool handleReportTiming();
-
-	bool handleGetDesignStats();
-
-	bool handleGetGraphData();
-
-	bool handleGetGraphSlacksData();
-
-};
-
-
-/**
- * Retrieves command data from channel, executes it and send status response.
- * Sends failed response if couldn't get message data.
- * Sends failed response if command execution returned false.
- * Returns false if fails on one of steps
- * @return success status
- */
-template <typename _MessageType>
-bool StaServerIpcProtocol::handleMessageWithStatus() {
-
-	_MessageType command;
-	EMessageStatus status = EMessageStatus::eMessageStatusOk;
-
-	bool ok = true;
-	if(mChannelPtr->popMessage(command) !=
-			EMessageStatus::eMessageStatusOk) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	if(ok && !mStaHandlerPtr->execute(command)) {
-		status = EMessageStatus::eMessageStatusFailed;
-		ok = false;
-	}
-
-	ok &= sendStatusResponse(
-			status, mStaHandlerPtr->getExecMessage());
-	return ok;
-}
-
-
-}
-
-
-#endif /* SRC_SERVER_STASERVERIPCPROTOCOL_HPP_ */
+#ifndef SRC_SERVER_STASERVERIPCPROTOCOL_HPP_
+#define SRC_SERVER_STASERVERIPCPROTOCOL_HPP_
+
+
+#include "channel/Messages.hpp"
+#include "channel/MessageRegistry.hpp"
+#include "channel/MessagePool.hpp"
+#include "channel/IpcChannel.hpp"
+
+#include "common/CommandLog.hpp"
+#include "common/ContentHash.hpp"
+
+#include "IStaServerHandler.hpp"
+#include "StreamBlobStore.hpp"
+#include "GraphConnectivity.hpp"
+
+
+namespace stamask {
+
+
+/**
+ * Runs commands cycle, takes care of message interchange
+ * with server interface when executing STA commands.
+ */
+class StaServerIpcProtocol {
+
+	/** method to handle command of one type */
+	typedef bool (StaServerIpcProtocol::*HandlerFuncPtr)();
+
+	/** channel to interchange messages */
+	IpcChannel* mChannelPtr;
+
+	/** commands executor */
+	IMessageExecutor* mStaHandlerPtr;
+
+	/** reusable instances of hot commands and responses */
+	HotMessagePool mMessagePool;
+
+	/** log of executed commands that changed STA state */
+	CommandLog mCommandLog;
+
+	/** flag to log executed commands, disabled by default */
+	bool mCommandLogEnabled;
+
+	/** flag that some command has changed STA state */
+	bool mHasState;
+
+	/** texts of executed stream commands */
+	StreamBlobStore mBlobStore;
+
+	/** fan-in/fan-out lists of the graph to select timing cones */
+	GraphConnectivity mConnectivity;
+
+	/** amount of handled commands that may change the graph structure */
+	uint64_t mGraphCommandsNum;
+
+public:
+
+	StaServerIpcProtocol(
+			IpcChannel* inChannelPtr,
+			IMessageExecutor* inStaHandlerPtr);
+
+	~StaServerIpcProtocol();
+
+	bool runCycle();
+
+	void setCommandLogEnabled(bool inEnabled);
+
+	const CommandLog& getCommandLog() const;
+
+	StreamBlobStore& getBlobStore();
+
+protected:
+
+	uint32_t getEnabledFeatureFlags() const;
+
+	bool sendStatusResponse(
+			EMessageStatus inStatus,
+			const std::string& inMessage);
+
+	template <typename _MessageType>
+	bool handleMessage();
+
+	template <typename _MessageType>
+	bool handleMessageWithStatus();
+
+	bool handleReportTiming();
+
+	bool handleGetDesignStats();
+
+	bool handleGetTimingPaths();
+
+	bool handleGetTimingSummary();
+
+	bool handleGetGraphSlacksSubset();
+
+	bool handleGetCritFactors();
+
+	bool handleGetPackedGraphSlacks();
+
+	bool collectGraphSlacksCone(
+			const CommandGetGraphSlacksSubset& inCommand,
+			std::vector<bool>& outConeVec);
+
+	bool updateConnectivity();
+
+	static bool isGraphCommand(EMessageType inMesgType);
+
+	bool handleGetGraphData();
+
+	bool handleUpdateNetlist();
+
+	bool handleGetGraphFingerprint();
+
+	bool handleSaveCheckpoint();
+
+	bool handleLoadCheckpoint();
+
+	bool handleReplayCommandLog();
+
+	bool handleReadLibertyStream();
+
+	bool handleReadCachedLiberty();
+
+	bool handleReadStoredStream();
+
+	template <typename _StreamCommand>
+	bool executeStoredStream(const CommandReadStoredStream& inCommand);
+
+	bool handleReadSharedStream();
+
+	static bool readSharedText(
+			const std::string& inShmName,
+			uint64_t inBytesNum,
+			std::string& outText);
+
+	template <typename _StreamCommand>
+	bool executeSharedStream(const CommandReadSharedStream& inCommand);
+
+	template <typename _StreamCommand>
+	bool executeStreamCommand(_StreamCommand& ioCommand);
+
+	template <typename _MessageType>
+	void storeStreamText(const _MessageType& inCommand);
+
+	template <typename _MessageType>
+	void logCommand(const _MessageType& inCommand);
+
+	bool handleGetGraphSlacksData();
+
+protected:
+
+	/**
+	 * Provides handler method of command type for dispatch table.
+	 */
+	template <typename _MessageType>
+	struct HandlerThunk {
+		static constexpr HandlerFuncPtr get() {
+			return &StaServerIpcProtocol::handleMessage<_MessageType>;
+		}
+	};
+
+};
+
+
+/**
+ * Handles command that needs only status response.
+ * Commands with data responses have specialized handlers.
+ * @return success status
+ */
+template <typename _MessageType>
+bool StaServerIpcProtocol::handleMessage() {
+	return handleMessageWithStatus<_MessageType>();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandReportTiming>() {
+	return handleReportTiming();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandGetDesignStats>() {
+	return handleGetDesignStats();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandGetGraphData>() {
+	return handleGetGraphData();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandUpdateNetlist>() {
+	return handleUpdateNetlist();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandGetGraphFingerprint>() {
+	return handleGetGraphFingerprint();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandSaveCheckpoint>() {
+	return handleSaveCheckpoint();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandLoadCheckpoint>() {
+	return handleLoadCheckpoint();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandReplayCommandLog>() {
+	return handleReplayCommandLog();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandReadLibertyStream>() {
+	return handleReadLibertyStream();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandReadCachedLiberty>() {
+	return handleReadCachedLiberty();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandReadStoredStream>() {
+	return handleReadStoredStream();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandReadSharedStream>() {
+	return handleReadSharedStream();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandGetTimingPaths>() {
+	return handleGetTimingPaths();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandGetTimingSummary>() {
+	return handleGetTimingSummary();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandGetGraphSlacksSubset>() {
+	return handleGetGraphSlacksSubset();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandGetCritFactors>() {
+	return handleGetCritFactors();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandGetPackedGraphSlacks>() {
+	return handleGetPackedGraphSlacks();
+}
+
+template <>
+inline bool StaServerIpcProtocol::handleMessage<CommandGetGraphSlacksData>() {
+	return handleGetGraphSlacksData();
+}
+
+
+/**
+ * Retrieves command data from channel, executes it and send status response.
+ * Successful command is logged after the response is sent.
+ * Sends failed response if couldn't get message data.
+ * Sends failed response if command execution returned false.
+ * Returns false if fails on one of steps
+ * @return success status
+ */
+template <typename _MessageType>
+bool StaServerIpcProtocol::handleMessageWithStatus() {
+
+	_MessageType localCommand;
+	_MessageType& command = mMessagePool.getOr(localCommand);
+	EMessageStatus status = EMessageStatus::eMessageStatusOk;
+
+	bool ok = true;
+	if(mChannelPtr->popMessage(command) !=
+			EMessageStatus::eMessageStatusOk) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	if(ok && !mStaHandlerPtr->execute(command)) {
+		status = EMessageStatus::eMessageStatusFailed;
+		ok = false;
+	}
+
+	//client doesn't wait for logging
+	bool sent = sendStatusResponse(
+			status, mStaHandlerPtr->getExecMessage());
+	if(ok) {
+		logCommand(command);
+		storeStreamText(command);
+	}
+
+	return ok && sent;
+}
+
+/**
+ * Executes stream command with text from the blob store.
+ * Liberty is first taken from executor's cache of parsed libraries,
+ * unless the command must be logged and the store doesn't have it's text.
+ * Sends not-found status if neither has it.
+ * @param inCommand command with key of the text
+ * @return success status
+ */
+template <typename _StreamCommand>
+bool StaServerIpcProtocol::executeStoredStream(
+		const CommandReadStoredStream& inCommand) {
+	_StreamCommand command;
+	bool hasText = mBlobStore.get(
+			inCommand.mContentHash, inCommand.mBytesNum, command.mStr);
+
+	if constexpr(std::is_same<_StreamCommand, CommandReadLibertyStream>::value) {
+		command.mContentHash = inCommand.mContentHash;
+
+		CommandReadCachedLiberty cachedCommand;
+		cachedCommand.mContentHash = inCommand.mContentHash;
+		cachedCommand.mBytesNum = inCommand.mBytesNum;
+		if((hasText || !mCommandLogEnabled) &&
+				mStaHandlerPtr->execute(cachedCommand)) {
+			bool sent = sendStatusResponse(
+					EMessageStatus::eMessageStatusOk,
+					mStaHandlerPtr->getExecMessage());
+			logCommand(command);
+			return sent;
+		}
+	}
+
+	if(!hasText)
+		return sendStatusResponse(
+				EMessageStatus::eMessageStatusNotFound,
+				"stream isn't stored");
+
+	return executeStreamCommand(command);
+}
+
+/**
+ * Executes stream command with text from shared memory object.
+ * Text is copied from mapped memory in the command once,
+ * without serialization and message block copies.
+ * Sends not found status if object can't be mapped or is too small,
+ * so client sends the text in the regular stream command.
+ * @param inCommand command with name of the object
+ * @return success status
+ */
+template <typename _StreamCommand>
+bool StaServerIpcProtocol::executeSharedStream(
+		const CommandReadSharedStream& inCommand) {
+	_StreamCommand command;
+	if(!readSharedText(inCommand.mShmName, inCommand.mBytesNum, command.mStr))
+		return sendStatusResponse(
+				EMessageStatus::eMessageStatusNotFound,
+				"failed to map shared stream " + inCommand.mShmName);
+
+	if constexpr(std::is_same<_StreamCommand, CommandReadLibertyStream>::value)
+		command.mContentHash = inCommand.mContentHash;
+
+	return executeStreamCommand(command);
+}
+
+/**
+ * Executes stream command built by the server, sends status response,
+ * then logs and stores the command on success.
+ * @param ioCommand stream command to execute
+ * @return success status
+ */
+template <typename _StreamCommand>
+bool StaServerIpcProtocol::executeStreamCommand(_StreamCommand& ioCommand) {
+	bool ok = mStaHandlerPtr->execute(ioCommand);
+	bool sent = sendStatusResponse(
+			ok ? EMessageStatus::eMessageStatusOk :
+					EMessageStatus::eMessageStatusFailed,
+			mStaHandlerPtr->getExecMessage());
+	if(ok) {
+		logCommand(ioCommand);
+		storeStreamText(ioCommand);
+	}
+
+	return ok && sent;
+}
+
+/**
+ * Keeps text of successfully executed stream command in the blob store,
+ * other commands are skipped at compile time.
+ * @param inCommand executed command
+ */
+template <typename _MessageType>
+void StaServerIpcProtocol::storeStreamText(const _MessageType& inCommand) {
+	if constexpr(std::is_same<_MessageType, CommandReadLibertyStream>::value ||
+			std::is_same<_MessageType, CommandReadVerilogStream>::value ||
+			std::is_same<_MessageType, CommandReadSpefStream>::value ||
+			std::is_same<_MessageType, CommandReadSdfStream>::value) {
+		if(!mBlobStore.isEnabled())
+			return;
+
+		std::string contentHash;
+		if constexpr(std::is_same<_MessageType, CommandReadLibertyStream>::value)
+			contentHash = inCommand.mContentHash;
+		if(contentHash.empty())
+			contentHash = hashContent(inCommand.mStr);
+
+		mBlobStore.put(contentHash, inCommand.mStr);
+	}
+}
+
+/**
+ * Notes that STA state has changed and adds successfully executed command
+ * in the log if logging is enabled.
+ * Commands that don't change STA state are skipped at compile time.
+ * @param inCommand executed command
+ */
+template <typename _MessageType>
+void StaServerIpcProtocol::logCommand(const _MessageType& inCommand) {
+	if constexpr(CommandLog::isLogged<_MessageType>()) {
+		mHasState = true;
+		if(mCommandLogEnabled)
+			mCommandLog.append(inCommand);
+	}
+}
+
+
+}
+
+
+#endif /* SRC_SERVER_STASERVERIPCPROTOCOL_HPP_ */
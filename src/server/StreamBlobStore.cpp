@@ -0,0 +1,212 @@
+
+#include "StreamBlobStore.hpp"
+#include "common/ContentHash.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+
+namespace stamask {
+
+
+/**
+ * Constructor of disabled store.
+ */
+StreamBlobStore::StreamBlobStore():
+		mDirName(),
+		mMemoryLimit(0),
+		mMemoryBytes(0),
+		mOrderList(),
+		mBlobsUMap() {}
+
+/**
+ * Sets directory to keep texts on disk, empty name disables disk store.
+ * Directory must exist, it may be shared by several servers.
+ * @param inDirName directory name
+ */
+void StreamBlobStore::setDirectory(const std::string& inDirName) {
+	mDirName = inDirName;
+}
+
+/**
+ * Sets max summary size of texts kept in memory.
+ * The least recently used texts are dropped to fit the limit.
+ * @param inBytesNum memory limit, zero disables memory store
+ */
+void StreamBlobStore::setMemoryLimit(std::size_t inBytesNum) {
+	mMemoryLimit = inBytesNum;
+	fitMemoryLimit(0);
+}
+
+/**
+ * Checks that store keeps texts in memory or on disk.
+ * @return flag of enabled store
+ */
+bool StreamBlobStore::isEnabled() const {
+	return mMemoryLimit > 0 || !mDirName.empty();
+}
+
+/**
+ * Finds text by content hash and size, looks in memory first.
+ * Text read from disk is checked against the hash and kept in memory.
+ * Malformed hash isn't looked up, since it's a part of file name.
+ * @param inContentHash content hash of the text
+ * @param inBytesNum size of the text
+ * @param outData text to fill
+ * @return flag that text was found
+ */
+bool StreamBlobStore::get(
+		const std::string& inContentHash,
+		uint64_t inBytesNum,
+		std::string& outData) {
+	if(!isContentHash(inContentHash))
+		return false;
+
+	BlobKey key(inContentHash, inBytesNum);
+	auto blobIt = mBlobsUMap.find(key);
+	if(blobIt != mBlobsUMap.end()) {
+		mOrderList.splice(mOrderList.end(), mOrderList, blobIt->second.mOrderIt);
+		outData = blobIt->second.mData;
+		return true;
+	}
+
+	if(mDirName.empty() ||
+			!readFile(key, outData) ||
+			outData.size() != inBytesNum ||
+			hashContent(outData) != inContentHash) {
+		outData.clear();
+		return false;
+	}
+
+	putInMemory(key, outData);
+	return true;
+}
+
+/**
+ * Keeps text in memory and on disk if store uses them.
+ * @param inContentHash content hash of the text
+ * @param inData text to keep
+ */
+void StreamBlobStore::put(
+		const std::string& inContentHash,
+		const std::string& inData) {
+	if(!isContentHash(inContentHash))
+		return;
+
+	BlobKey key(inContentHash, inData.size());
+	if(!mDirName.empty())
+		writeFile(key, inData);
+
+	putInMemory(key, inData);
+}
+
+/**
+ * Drops all texts from memory, files on disk are kept.
+ */
+void StreamBlobStore::clear() {
+	mBlobsUMap.clear();
+	mOrderList.clear();
+	mMemoryBytes = 0;
+}
+
+/**
+ * Returns name of text file in store directory.
+ * @param inKey text key
+ * @return file name
+ */
+std::string StreamBlobStore::getFileName(const BlobKey& inKey) const {
+	return mDirName + "/" + inKey.first + "-" +
+			std::to_string(inKey.second) + ".blob";
+}
+
+/**
+ * Reads text file from store directory.
+ * @param inKey text key
+ * @param outData text to fill
+ * @return operation success
+ */
+bool StreamBlobStore::readFile(
+		const BlobKey& inKey,
+		std::string& outData) const {
+	std::ifstream file(getFileName(inKey), std::ios::binary);
+	if(!file)
+		return false;
+
+	outData.assign(std::istreambuf_iterator<char>(file), {});
+	return !file.bad();
+}
+
+/**
+ * Writes text file in store directory, skips existing file.
+ * Writes uniquely named temporary file first,
+ * so other servers never read a partial text.
+ * @param inKey text key
+ * @param inData text to write
+ * @return operation success
+ */
+bool StreamBlobStore::writeFile(
+		const BlobKey& inKey,
+		const std::string& inData) const {
+	std::string fileName = getFileName(inKey);
+	if(std::ifstream(fileName, std::ios::binary))
+		return true;
+
+	std::string tmpFileName = fileName + ".tmp" +
+			std::to_string(std::random_device()());
+	{
+		std::ofstream file(tmpFileName, std::ios::binary | std::ios::trunc);
+		if(!file || !file.write(inData.data(), inData.size())) {
+			file.close();
+			std::remove(tmpFileName.c_str());
+			return false;
+		}
+	}
+
+	if(std::rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+		std::remove(tmpFileName.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Drops the least recently used texts from memory
+ * until there's place for given amount of bytes.
+ * @param inNeededBytes size of text to keep
+ */
+void StreamBlobStore::fitMemoryLimit(std::size_t inNeededBytes) {
+	while(!mOrderList.empty() &&
+			mMemoryBytes + inNeededBytes > mMemoryLimit) {
+		auto blobIt = mBlobsUMap.find(mOrderList.front());
+		mMemoryBytes -= blobIt->second.mData.size();
+		mBlobsUMap.erase(blobIt);
+		mOrderList.pop_front();
+	}
+}
+
+/**
+ * Keeps text in memory, text larger than the limit isn't kept.
+ * @param inKey text key
+ * @param inData text to keep
+ */
+void StreamBlobStore::putInMemory(
+		const BlobKey& inKey,
+		const std::string& inData) {
+	if(inData.size() > mMemoryLimit ||
+			mBlobsUMap.count(inKey))
+		return;
+
+	fitMemoryLimit(inData.size());
+
+	mOrderList.push_back(inKey);
+	MemoryBlob& blob = mBlobsUMap[inKey];
+	blob.mData = inData;
+	blob.mOrderIt = std::prev(mOrderList.end());
+	mMemoryBytes += inData.size();
+}
+
+
+}
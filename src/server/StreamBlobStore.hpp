@@ -0,0 +1,98 @@
+#ifndef SRC_SERVER_STREAMBLOBSTORE_HPP_
+#define SRC_SERVER_STREAMBLOBSTORE_HPP_
+
+
+#include <boost/functional/hash.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+
+namespace stamask {
+
+
+/**
+ * Store of streamed texts identified by SHA-256 content hash and size.
+ * Keeps recently used texts in memory up to the limit,
+ * optional directory keeps all of them on disk, possibly shared by servers.
+ * Store is disabled while memory limit is zero and directory isn't set.
+ */
+class StreamBlobStore {
+
+	/** content hash and size of a text */
+	typedef std::pair<std::string, uint64_t> BlobKey;
+
+	/** keys of texts in memory, the least recently used go first */
+	typedef std::list<BlobKey> BlobKeysList;
+
+	/** text in memory with it's place in usage order */
+	struct MemoryBlob {
+		std::string mData;
+		BlobKeysList::iterator mOrderIt;
+	};
+
+	/** directory of text files, empty if disk store isn't used */
+	std::string mDirName;
+
+	/** max summary size of texts in memory */
+	std::size_t mMemoryLimit;
+
+	/** summary size of texts in memory */
+	std::size_t mMemoryBytes;
+
+	/** keys of texts in memory in usage order */
+	BlobKeysList mOrderList;
+
+	/** texts in memory by key */
+	std::unordered_map<BlobKey, MemoryBlob, boost::hash<BlobKey>> mBlobsUMap;
+
+public:
+
+	StreamBlobStore();
+
+	void setDirectory(const std::string& inDirName);
+
+	void setMemoryLimit(std::size_t inBytesNum);
+
+	bool isEnabled() const;
+
+	bool get(
+			const std::string& inContentHash,
+			uint64_t inBytesNum,
+			std::string& outData);
+
+	void put(
+			const std::string& inContentHash,
+			const std::string& inData);
+
+	void clear();
+
+protected:
+
+	std::string getFileName(const BlobKey& inKey) const;
+
+	bool readFile(
+			const BlobKey& inKey,
+			std::string& outData) const;
+
+	bool writeFile(
+			const BlobKey& inKey,
+			const std::string& inData) const;
+
+	void fitMemoryLimit(std::size_t inNeededBytes);
+
+	void putInMemory(
+			const BlobKey& inKey,
+			const std::string& inData);
+
+};
+
+
+}
+
+
+#endif /* SRC_SERVER_STREAMBLOBSTORE_HPP_ */
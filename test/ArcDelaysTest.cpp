@@ -0,0 +1,79 @@
+#include "TestCheck.hpp"
+
+#include "common/ArcDelays.hpp"
+
+#include <cstdint>
+#include <vector>
+
+
+namespace stamask {
+
+
+/**
+ * Checks that dedup keeps the last delays of each edge
+ * and orders delays by edge ID.
+ */
+void checkDedupLastWins() {
+	std::vector<ArcDelayData> arcDelaysVec = {
+			{5, 1e-10f, 2e-10f},
+			{2, 3e-10f, 4e-10f},
+			{5, 5e-10f, 6e-10f},
+			{7, 7e-10f, 8e-10f},
+			{2, 9e-10f, 1e-9f},
+			{5, 1.1e-9f, 1.2e-9f}};
+	dedupArcDelays(arcDelaysVec);
+
+	STALINK_CHECK(arcDelaysVec.size() == 3);
+	if(arcDelaysVec.size() != 3)
+		return;
+
+	STALINK_CHECK(arcDelaysVec[0].mEdgeId == 2);
+	STALINK_CHECK(arcDelaysVec[0].mMinDelay == 9e-10f);
+	STALINK_CHECK(arcDelaysVec[0].mMaxDelay == 1e-9f);
+	STALINK_CHECK(arcDelaysVec[1].mEdgeId == 5);
+	STALINK_CHECK(arcDelaysVec[1].mMinDelay == 1.1e-9f);
+	STALINK_CHECK(arcDelaysVec[1].mMaxDelay == 1.2e-9f);
+	STALINK_CHECK(arcDelaysVec[2].mEdgeId == 7);
+	STALINK_CHECK(arcDelaysVec[2].mMinDelay == 7e-10f);
+}
+
+/**
+ * Checks that min-max command is split into min and max commands
+ * of deduplicated arcs, equal delays go in a single command.
+ */
+void checkSplitMinMax() {
+	CommandSetArcsMinMaxDelays command;
+	command.mArcDelaysVec = {
+			{4, 1e-10f, 2e-10f},
+			{1, 3e-10f, 3e-10f},
+			{4, 5e-10f, 6e-10f}};
+
+	CommandSetArcsDelays minCommand;
+	CommandSetArcsDelays maxCommand;
+	splitArcsMinMaxDelays(command, minCommand, maxCommand);
+
+	STALINK_CHECK(minCommand.mMin && !minCommand.mMax);
+	STALINK_CHECK(!maxCommand.mMin && maxCommand.mMax);
+	STALINK_CHECK((minCommand.mEdgeIdsVec == std::vector<uint32_t>{1, 4}));
+	STALINK_CHECK((minCommand.mDelayValuesVec == std::vector<float>{3e-10f, 5e-10f}));
+	STALINK_CHECK((maxCommand.mEdgeIdsVec == std::vector<uint32_t>{1, 4}));
+	STALINK_CHECK((maxCommand.mDelayValuesVec == std::vector<float>{3e-10f, 6e-10f}));
+
+	command.mArcDelaysVec = {{4, 1e-10f, 1e-10f}, {1, 3e-10f, 3e-10f}};
+	splitArcsMinMaxDelays(command, minCommand, maxCommand);
+
+	STALINK_CHECK(minCommand.mMin && minCommand.mMax);
+	STALINK_CHECK((minCommand.mEdgeIdsVec == std::vector<uint32_t>{1, 4}));
+	STALINK_CHECK(maxCommand.mEdgeIdsVec.empty());
+}
+
+
+}
+
+
+int main() {
+	stamask::checkDedupLastWins();
+	stamask::checkSplitMinMax();
+
+	return stamask::getFailedChecksNum() ? 1 : 0;
+}
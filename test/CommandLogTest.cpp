@@ -0,0 +1,226 @@
+#include "TestCheck.hpp"
+
+#include "common/CommandLog.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+namespace stamask {
+
+
+/**
+ * Returns types of log entries in order.
+ * @param inLog command log
+ * @return command types
+ */
+std::vector<EMessageType> getEntryTypes(const CommandLog& inLog) {
+	std::vector<EMessageType> typesVec;
+	for(const CommandLogEntry& entry : inLog.getEntries())
+		typesVec.push_back(entry.mMesgType);
+
+	return typesVec;
+}
+
+/**
+ * Makes arc delays command.
+ * @param inEdgeIdsVec edge IDs
+ * @param inDelaysVec delays of edges
+ * @return command
+ */
+CommandSetArcsDelays makeArcsDelays(
+		const std::vector<uint32_t>& inEdgeIdsVec,
+		const std::vector<float>& inDelaysVec) {
+	CommandSetArcsDelays command;
+	command.mEdgeIdsVec = inEdgeIdsVec;
+	command.mDelayValuesVec = inDelaysVec;
+	command.mMin = true;
+	command.mMax = true;
+	return command;
+}
+
+/**
+ * Checks that compaction drops commands before clears
+ * and arc delays set again later for the same edge.
+ */
+void checkCompaction() {
+	CommandLog log;
+
+	CommandReadLibertyFile libCommand;
+	libCommand.mStr = "old.lib";
+	STALINK_CHECK(log.append(libCommand));
+	STALINK_CHECK(log.append(CommandClearLibs()));
+	libCommand.mStr = "new.lib";
+	STALINK_CHECK(log.append(libCommand));
+
+	CommandReadVerilogFile verilogCommand;
+	verilogCommand.mStr = "top.v";
+	STALINK_CHECK(log.append(verilogCommand));
+	STALINK_CHECK(log.append(makeArcsDelays({1, 2}, {1.0f, 2.0f})));
+	STALINK_CHECK(log.append(makeArcsDelays({1}, {3.0f})));
+	STALINK_CHECK(log.append(makeArcsDelays({1}, {4.0f})));
+
+	STALINK_CHECK(!log.append(CommandPing()));
+	STALINK_CHECK(log.size() == 7);
+
+	STALINK_CHECK(log.compact());
+	STALINK_CHECK((getEntryTypes(log) == std::vector<EMessageType>{
+			EMessageType::EMessageTypeClearLibs,
+			EMessageType::EMessageTypeReadLibFile,
+			EMessageType::EMessageTypeReadVerilogFile,
+			EMessageType::EMessageTypeSetArcsDelay,
+			EMessageType::EMessageTypeSetArcsDelay}));
+
+	//the first delays command keeps only edge 2, the last one wins for edge 1
+	FlatMessageSerdes serdes(0);
+	CommandSetArcsDelays command;
+	const CommandLogEntry& firstEntry = log.getEntries()[3];
+	STALINK_CHECK(serdes.deserializeMessage(
+			command, {firstEntry.mDataVec.data(), firstEntry.mDataVec.size()}));
+	STALINK_CHECK((command.mEdgeIdsVec == std::vector<uint32_t>{2}));
+	STALINK_CHECK((command.mDelayValuesVec == std::vector<float>{2.0f}));
+
+	const CommandLogEntry& lastEntry = log.getEntries()[4];
+	STALINK_CHECK(serdes.deserializeMessage(
+			command, {lastEntry.mDataVec.data(), lastEntry.mDataVec.size()}));
+	STALINK_CHECK((command.mDelayValuesVec == std::vector<float>{4.0f}));
+
+	//netlist clear drops design commands, libraries stay
+	STALINK_CHECK(log.append(CommandClearNetlistBlocks()));
+	STALINK_CHECK(log.compact());
+	STALINK_CHECK((getEntryTypes(log) == std::vector<EMessageType>{
+			EMessageType::EMessageTypeClearLibs,
+			EMessageType::EMessageTypeReadLibFile,
+			EMessageType::EMessageTypeClearNetlistBlocks}));
+}
+
+/**
+ * Checks that log is saved and loaded with the same entries.
+ */
+void checkSaveLoad() {
+	const std::string fileName = "CommandLogTest.cmdlog";
+
+	CommandLog log;
+	CommandReadLibertyStream libCommand;
+	libCommand.mStr = "library(test) {}";
+	STALINK_CHECK(log.append(libCommand));
+	STALINK_CHECK(log.append(makeArcsDelays({5}, {1.5f})));
+	STALINK_CHECK(log.save(fileName));
+
+	CommandLog loadedLog;
+	STALINK_CHECK(loadedLog.load(fileName));
+	STALINK_CHECK(loadedLog.size() == log.size());
+	for(std::size_t entryIdx = 0;
+			entryIdx < log.size() && entryIdx < loadedLog.size(); entryIdx++) {
+		STALINK_CHECK(loadedLog.getEntries()[entryIdx].mMesgType ==
+				log.getEntries()[entryIdx].mMesgType);
+		STALINK_CHECK(loadedLog.getEntries()[entryIdx].mDataVec ==
+				log.getEntries()[entryIdx].mDataVec);
+	}
+
+	std::string data;
+	STALINK_CHECK(log.saveToString(data));
+	CommandLog stringLog;
+	STALINK_CHECK(stringLog.loadFromString(data));
+	STALINK_CHECK(stringLog.size() == log.size());
+
+	//log cut in the middle of an entry isn't loaded as a checkpoint
+	data.resize(data.size() - 2);
+	STALINK_CHECK(!stringLog.loadFromString(data));
+
+	std::remove(fileName.c_str());
+}
+
+/**
+ * Checks that journal keeps commands only in the file,
+ * compacts them there and survives an entry cut by a crash.
+ */
+void checkJournal() {
+	const std::string fileName = "CommandLogTest.journal";
+	std::remove(fileName.c_str());
+
+	CommandLog log;
+	CommandReadLibertyFile libCommand;
+	libCommand.mStr = "cells.lib";
+	STALINK_CHECK(log.append(libCommand));
+	STALINK_CHECK(log.openJournal(fileName));
+	STALINK_CHECK(log.size() == 1);
+	STALINK_CHECK(log.getEntries().empty());
+
+	STALINK_CHECK(log.append(makeArcsDelays({1}, {1.0f})));
+	STALINK_CHECK(log.append(makeArcsDelays({1}, {2.0f})));
+	STALINK_CHECK(log.size() == 3);
+	STALINK_CHECK(log.getEntries().empty());
+
+	STALINK_CHECK(log.compact());
+	STALINK_CHECK(log.size() == 2);
+	STALINK_CHECK(log.getEntries().empty());
+	log.closeJournal();
+
+	//entry header with size beyond the end of file is left by a crash
+	{
+		std::ofstream file(fileName, std::ios::binary | std::ios::app);
+		uint32_t mesgType = EMessageType::EMessageTypeReadLibFile;
+		uint32_t reserved = 0;
+		uint64_t bytesNum = uint64_t(1) << 60;
+		file.write(reinterpret_cast<const char*>(&mesgType), sizeof(mesgType));
+		file.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+		file.write(reinterpret_cast<const char*>(&bytesNum), sizeof(bytesNum));
+	}
+
+	CommandLog checkpointLog;
+	STALINK_CHECK(!checkpointLog.load(fileName));
+
+	CommandLog reopenedLog;
+	STALINK_CHECK(reopenedLog.openJournal(fileName));
+	STALINK_CHECK(reopenedLog.size() == 2);
+	reopenedLog.closeJournal();
+
+	STALINK_CHECK(checkpointLog.load(fileName));
+	STALINK_CHECK((getEntryTypes(checkpointLog) == std::vector<EMessageType>{
+			EMessageType::EMessageTypeReadLibFile,
+			EMessageType::EMessageTypeSetArcsDelay}));
+
+	std::remove(fileName.c_str());
+}
+
+/**
+ * Checks that log is split in batches of whole commands.
+ */
+void checkBatches() {
+	CommandLog log;
+	for(uint32_t edgeId = 0; edgeId < 3; edgeId++)
+		STALINK_CHECK(log.append(makeArcsDelays({edgeId}, {1.0f})));
+
+	std::size_t entryIdx = 0;
+	std::size_t batchesNum = 0;
+	std::string data;
+	while(entryIdx < log.size() && batchesNum < log.size()) {
+		STALINK_CHECK(log.saveBatchToString(entryIdx, 1, data));
+		batchesNum++;
+
+		CommandLog batchLog;
+		STALINK_CHECK(batchLog.loadFromString(data));
+		STALINK_CHECK(batchLog.size() == 1);
+	}
+	STALINK_CHECK(batchesNum == 3);
+
+	entryIdx = 0;
+	STALINK_CHECK(log.saveBatchToString(entryIdx, uint64_t(1) << 20, data));
+	STALINK_CHECK(entryIdx == 3);
+}
+
+
+}
+
+
+int main() {
+	stamask::checkCompaction();
+	stamask::checkSaveLoad();
+	stamask::checkJournal();
+	stamask::checkBatches();
+
+	return stamask::getFailedChecksNum() ? 1 : 0;
+}
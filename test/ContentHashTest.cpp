@@ -0,0 +1,46 @@
+#include "TestCheck.hpp"
+
+#include "common/ContentHash.hpp"
+
+#include <string>
+
+
+namespace stamask {
+
+
+/**
+ * Checks content hash against known SHA-256 digests,
+ * including texts with one and two padding blocks.
+ */
+void checkKnownDigests() {
+	STALINK_CHECK(hashContent("") ==
+			"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+	STALINK_CHECK(hashContent("abc") ==
+			"ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+	STALINK_CHECK(hashContent(
+			"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+			"248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+	STALINK_CHECK(hashContent(std::string(1000, 'a')) ==
+			"41edece42d63e8d9bf515a9ba6932e1c20cbc9f5a5d134645adb5db1b9737ea3");
+}
+
+/**
+ * Checks that only well-formed hashes are accepted as file name parts.
+ */
+void checkHashForm() {
+	STALINK_CHECK(isContentHash(hashContent("abc")));
+	STALINK_CHECK(!isContentHash(""));
+	STALINK_CHECK(!isContentHash(std::string(63, '0')));
+	STALINK_CHECK(!isContentHash("../" + std::string(61, '0')));
+}
+
+
+}
+
+
+int main() {
+	stamask::checkKnownDigests();
+	stamask::checkHashForm();
+
+	return stamask::getFailedChecksNum() ? 1 : 0;
+}
@@ -0,0 +1,163 @@
+#include "TestCheck.hpp"
+
+#include "channel/FlatMessageSerdes.hpp"
+#include "channel/MessagePool.hpp"
+#include "channel/YasMessageSerdes.hpp"
+
+#include <cstdint>
+#include <vector>
+
+
+namespace stamask {
+
+
+/**
+ * Serializes message with YAS encoder to compare contents of messages.
+ * @param ioSerdes YAS serdes
+ * @param inMessage message to encode
+ * @return encoded bytes
+ */
+std::vector<uint8_t> encodeYas(
+		YasMessageSerdes& ioSerdes,
+		const Message& inMessage) {
+	DataBlock data = ioSerdes.serializeMessage(inMessage);
+	if(!data.mDataPtr)
+		return {};
+
+	return std::vector<uint8_t>(data.mDataPtr, data.mDataPtr + data.mBytesNum);
+}
+
+/**
+ * Checks that message passes through encoders 41 and 42 unchanged.
+ * Decoded messages are compared by their encoding with encoder 41.
+ * @param inMessage message to check
+ */
+template<typename _MesgType>
+void checkRoundTrip(const _MesgType& inMessage) {
+	YasMessageSerdes yasSerdes;
+	FlatMessageSerdes flatSerdes;
+
+	std::vector<uint8_t> yasBytes = encodeYas(yasSerdes, inMessage);
+	STALINK_CHECK(!yasBytes.empty() || _MesgType::cMesgType == EMessageTypeNoMessage);
+
+	_MesgType yasMessage{};
+	STALINK_CHECK(yasSerdes.deserializeMessage(
+			yasMessage, {yasBytes.data(), yasBytes.size()}));
+	STALINK_CHECK(encodeYas(yasSerdes, yasMessage) == yasBytes);
+
+	DataBlock flatData = flatSerdes.serializeMessage(inMessage);
+	STALINK_CHECK(flatData.mDataPtr != nullptr);
+
+	_MesgType flatMessage{};
+	STALINK_CHECK(flatSerdes.deserializeMessage(flatMessage, flatData));
+	if(encodeYas(yasSerdes, flatMessage) != yasBytes) {
+		std::cerr << "message type " << _MesgType::cMesgType
+				<< " differs after encoder 42" << std::endl;
+		getFailedChecksNum()++;
+	}
+}
+
+/**
+ * Checks round-trips of default instances of all message types.
+ */
+template<typename... _MesgTypes>
+void checkDefaultRoundTrips(MessageTypeList<_MesgTypes...>) {
+	(checkRoundTrip(_MesgTypes{}), ...);
+}
+
+/**
+ * Checks round-trips of messages with nested structures and arrays.
+ */
+void checkFilledRoundTrips() {
+	CommandConnectContextPinNet connectCommand{};
+	connectCommand.mInstContextVec = {"top_inst", "sub_inst"};
+	connectCommand.mNetName = "n1";
+	connectCommand.mInstName = "u1";
+	connectCommand.mPinName = "A";
+	checkRoundTrip(connectCommand);
+
+	CommandSetGroupNetCap capCommand{};
+	capCommand.mNetAddrsVec.resize(2);
+	capCommand.mNetAddrsVec[0].mObjName = "n1";
+	capCommand.mNetAddrsVec[1].mInstContextVec = {"u2"};
+	capCommand.mNetAddrsVec[1].mObjName = "n2";
+	capCommand.mValuesVec = {1e-15f, 2.5e-15f};
+	checkRoundTrip(capCommand);
+
+	CommandSetArcsDelays delaysCommand{};
+	delaysCommand.mEdgeIdsVec = {3, 1, 7};
+	delaysCommand.mDelayValuesVec = {1e-10f, 2e-10f, 3e-10f};
+	delaysCommand.mMin = true;
+	delaysCommand.mMax = false;
+	checkRoundTrip(delaysCommand);
+
+	CommandSetArcsMinMaxDelays minMaxCommand{};
+	minMaxCommand.mArcDelaysVec.push_back({3, 1e-10f, 2e-10f});
+	minMaxCommand.mArcDelaysVec.push_back({1, 4e-10f, 4e-10f});
+	minMaxCommand.mMin = false;
+	minMaxCommand.mMax = true;
+	checkRoundTrip(minMaxCommand);
+
+	CommandCreateNetlist netlistCommand{};
+	netlistCommand.mBlockDataVec.resize(1);
+	BlockData& block = netlistCommand.mBlockDataVec[0];
+	block.mName = "top";
+	block.mTopFlag = true;
+	block.mLeafFlag = false;
+	block.mPortDataVec.push_back({"clk", true, false, false, 0, 0, {0}});
+	block.mInstDataVec.push_back({"u1", 1, {{"A", true, false, false, 0, 0, {0, 1}}}});
+	block.mNetNamesVec = {"clk", "n1"};
+	checkRoundTrip(netlistCommand);
+
+	ResponseGraphMap graphResponse{};
+	graphResponse.mExecStatus = eMessageStatusOk;
+	graphResponse.mVertexIdToDataVec.push_back({{"u1"}, "A", false, 0});
+	graphResponse.mVertexIdToDataVec.push_back({{"u1"}, "Y", true, 1});
+	graphResponse.mEdgeIdToDataVec.push_back({0, 1, 0});
+	checkRoundTrip(graphResponse);
+
+	ResponseGraphSlacks slacksResponse{};
+	slacksResponse.mExecStatus = eMessageStatusOk;
+	slacksResponse.mNodeTimingsVec.resize(3);
+	slacksResponse.mNodeTimingsVec[1].mNodeId = 1;
+	slacksResponse.mNodeTimingsVec[1].mHasTiming = true;
+	slacksResponse.mNodeTimingsVec[1].mMaxWorstSlackRat = 2e-9f;
+	slacksResponse.mNodeTimingsVec[1].mMaxWorstSlackAat = 1e-9f;
+	slacksResponse.mNodeTimingsVec[1].mClkIdx = 2;
+	checkRoundTrip(slacksResponse);
+}
+
+/**
+ * Checks that refilled pooled names keep their strings and drop extra elements.
+ */
+void checkPooledNames() {
+	HotMessagePool pool;
+	CommandSetGroupNetCap& command = pool.acquire<CommandSetGroupNetCap>();
+	size_t usedNum = 0;
+	for(const char* netName : {"net_with_a_long_name_0", "net_with_a_long_name_1"})
+		nextPooledElement(command.mNetAddrsVec, usedNum).mObjName.assign(netName);
+	trimPooledElements(command.mNetAddrsVec, usedNum);
+	const char* namePtr = command.mNetAddrsVec[0].mObjName.data();
+
+	CommandSetGroupNetCap& reusedCommand = pool.acquire<CommandSetGroupNetCap>();
+	usedNum = 0;
+	nextPooledElement(reusedCommand.mNetAddrsVec, usedNum).mObjName.assign(
+			"net_with_a_long_name_2");
+	trimPooledElements(reusedCommand.mNetAddrsVec, usedNum);
+
+	STALINK_CHECK(reusedCommand.mNetAddrsVec.size() == 1);
+	STALINK_CHECK(reusedCommand.mNetAddrsVec[0].mObjName == "net_with_a_long_name_2");
+	STALINK_CHECK(reusedCommand.mNetAddrsVec[0].mObjName.data() == namePtr);
+}
+
+
+}
+
+
+int main() {
+	stamask::checkDefaultRoundTrips(stamask::AllMessagesList());
+	stamask::checkFilledRoundTrips();
+	stamask::checkPooledNames();
+
+	return stamask::getFailedChecksNum() ? 1 : 0;
+}
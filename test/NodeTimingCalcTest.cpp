@@ -0,0 +1,181 @@
+#include "TestCheck.hpp"
+
+#include "channel/FlatMessageSerdes.hpp"
+#include "common/NodeTimingCalc.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+
+namespace stamask {
+
+
+/**
+ * Makes timing data of nodes with set and unset values.
+ * Amount of nodes isn't a multiple of 8 to cover the tail of vector decoding.
+ * @return nodes timing data
+ */
+std::vector<NodeTimingData> makeNodeTimings() {
+	std::vector<NodeTimingData> nodeTimingsVec(19);
+	for(size_t nodeIdx = 0; nodeIdx < nodeTimingsVec.size(); nodeIdx++) {
+		NodeTimingData& data = nodeTimingsVec[nodeIdx];
+		data.mNodeId = nodeIdx;
+		data.mClkIdx = int(nodeIdx % 3) - 1;
+		data.mIsEndPoint = nodeIdx % 2;
+		data.mNonData = nodeIdx % 5 == 0;
+
+		//every fourth node is left without timing
+		if(nodeIdx % 4 == 3)
+			continue;
+
+		data.mHasTiming = true;
+		data.mMaxWorstSlackRat = 2e-9f + nodeIdx * 1e-10f;
+		data.mMaxWorstSlackAat = 1e-9f - nodeIdx * 3e-11f;
+		data.mMinWorstSlackRat = 1e-10f;
+		data.mMinWorstSlackAat = 3e-10f + nodeIdx * 2e-11f;
+
+		if(data.mIsEndPoint) {
+			data.mEndPointIdx = nodeIdx / 2;
+			data.mHasEndMaxPathRat = true;
+			data.mMaxPathRat = data.mMaxWorstSlackRat;
+			data.mHasEndMinPathRat = true;
+			data.mMinPathRat = data.mMinWorstSlackRat;
+		}
+	}
+
+	return nodeTimingsVec;
+}
+
+/**
+ * Checks that value survived packing within half of packing step,
+ * unset values must stay unset with the same sign.
+ * @param inExpected original value
+ * @param inActual unpacked value
+ * @param inScale packing step
+ */
+void checkPackedValue(float inExpected, float inActual, float inScale) {
+	if(!isNodeTimingSlackSet(inExpected)) {
+		STALINK_CHECK(!isNodeTimingSlackSet(inActual));
+		STALINK_CHECK((inExpected > 0) == (inActual > 0));
+		return;
+	}
+
+	STALINK_CHECK(std::fabs(inExpected - inActual) <= 0.51 * inScale);
+}
+
+/**
+ * Checks that packed node timings pass through encoder 42 and unpack
+ * into the same flags and IDs, values are kept within packing precision.
+ */
+void checkPackedSlacksRoundTrip() {
+	std::vector<NodeTimingData> nodeTimingsVec = makeNodeTimings();
+
+	ResponsePackedGraphSlacks response;
+	response.mExecStatus = eMessageStatusOk;
+	packNodeTimings(nodeTimingsVec, response.mPackedTimings);
+	STALINK_CHECK(response.mPackedTimings.mScale > 0);
+
+	FlatMessageSerdes flatSerdes;
+	DataBlock data = flatSerdes.serializeMessage(response);
+	STALINK_CHECK(data.mDataPtr != nullptr);
+
+	ResponsePackedGraphSlacks decodedResponse;
+	STALINK_CHECK(flatSerdes.deserializeMessage(decodedResponse, data));
+
+	std::vector<NodeTimingData> unpackedVec;
+	STALINK_CHECK(unpackNodeTimings(decodedResponse.mPackedTimings, unpackedVec));
+	STALINK_CHECK(unpackedVec.size() == nodeTimingsVec.size());
+	if(unpackedVec.size() != nodeTimingsVec.size())
+		return;
+
+	float scale = decodedResponse.mPackedTimings.mScale;
+	for(size_t nodeIdx = 0; nodeIdx < nodeTimingsVec.size(); nodeIdx++) {
+		const NodeTimingData& expected = nodeTimingsVec[nodeIdx];
+		const NodeTimingData& actual = unpackedVec[nodeIdx];
+		STALINK_CHECK(actual.mNodeId == expected.mNodeId);
+		STALINK_CHECK(actual.mEndPointIdx == expected.mEndPointIdx);
+		STALINK_CHECK(actual.mClkIdx == expected.mClkIdx);
+		STALINK_CHECK(actual.mIsEndPoint == expected.mIsEndPoint);
+		STALINK_CHECK(actual.mHasTiming == expected.mHasTiming);
+		STALINK_CHECK(actual.mNonData == expected.mNonData);
+		STALINK_CHECK(actual.mHasEndMaxPathRat == expected.mHasEndMaxPathRat);
+		STALINK_CHECK(actual.mHasEndMinPathRat == expected.mHasEndMinPathRat);
+
+		checkPackedValue(expected.mMinWorstSlackRat, actual.mMinWorstSlackRat, scale);
+		checkPackedValue(expected.mMinWorstSlackAat, actual.mMinWorstSlackAat, scale);
+		checkPackedValue(expected.mMaxWorstSlackRat, actual.mMaxWorstSlackRat, scale);
+		checkPackedValue(expected.mMaxWorstSlackAat, actual.mMaxWorstSlackAat, scale);
+		checkPackedValue(expected.mMaxPathRat, actual.mMaxPathRat, scale);
+		checkPackedValue(expected.mMinPathRat, actual.mMinPathRat, scale);
+	}
+}
+
+/**
+ * Checks that packed timings with wrong amount of values aren't unpacked.
+ */
+void checkPackedSlacksMismatch() {
+	PackedNodeTimingsData packedTimings;
+	packNodeTimings(makeNodeTimings(), packedTimings);
+	packedTimings.mValuesVec.pop_back();
+
+	std::vector<NodeTimingData> unpackedVec;
+	STALINK_CHECK(!unpackNodeTimings(packedTimings, unpackedVec));
+}
+
+
+/**
+ * Checks selection of nodes subset by vertex IDs and cone flags.
+ * Out-of-range vertex IDs and cone flags are ignored.
+ */
+void checkNodeTimingsSubset() {
+	std::vector<NodeTimingData> nodeTimingsVec = makeNodeTimings();
+	std::vector<NodeTimingData> subsetVec;
+
+	CommandGetGraphSlacksSubset command;
+	STALINK_CHECK(selectNodeTimingsSubset(
+			nodeTimingsVec, command, {}, subsetVec));
+	STALINK_CHECK(subsetVec.size() == nodeTimingsVec.size());
+
+	command.mVertexIdsVec = {7, 2, 1000};
+	std::vector<bool> coneVec(nodeTimingsVec.size() + 5, false);
+	coneVec[3] = true;
+	coneVec[nodeTimingsVec.size() + 1] = true;
+	STALINK_CHECK(selectNodeTimingsSubset(
+			nodeTimingsVec, command, coneVec, subsetVec));
+	STALINK_CHECK(subsetVec.size() == 3);
+	if(subsetVec.size() == 3) {
+		STALINK_CHECK(subsetVec[0].mNodeId == 2);
+		STALINK_CHECK(subsetVec[1].mNodeId == 3);
+		STALINK_CHECK(subsetVec[2].mNodeId == 7);
+	}
+}
+
+/**
+ * Checks that criticality factors command accepts only 8 or 16 bits.
+ */
+void checkCritFactorsBits() {
+	CommandGetCritFactors command;
+	CritFactorsData factors;
+	command.mFactorBits = 12;
+	STALINK_CHECK(!isCritFactorsCommandValid(command));
+	STALINK_CHECK(!calcQuantizedCritFactors(makeNodeTimings(), command, factors));
+
+	command.mFactorBits = 16;
+	STALINK_CHECK(isCritFactorsCommandValid(command));
+	STALINK_CHECK(calcQuantizedCritFactors(makeNodeTimings(), command, factors));
+	STALINK_CHECK(factors.mMinFactors16Vec.size() == makeNodeTimings().size());
+}
+
+
+}
+
+
+int main() {
+	stamask::checkPackedSlacksRoundTrip();
+	stamask::checkPackedSlacksMismatch();
+	stamask::checkNodeTimingsSubset();
+	stamask::checkCritFactorsBits();
+
+	return stamask::getFailedChecksNum() ? 1 : 0;
+}
@@ -0,0 +1,38 @@
+#ifndef TEST_TESTCHECK_HPP_
+#define TEST_TESTCHECK_HPP_
+
+
+#include <iostream>
+
+
+namespace stamask {
+
+
+/**
+ * Returns counter of failed checks of the test executable.
+ * @return reference to the counter
+ */
+inline int& getFailedChecksNum() {
+	static int failedChecksNum = 0;
+	return failedChecksNum;
+}
+
+
+}
+
+
+/**
+ * Checks condition, prints it and counts failure if it doesn't hold.
+ * Test keeps going after failed check to report all of them.
+ */
+#define STALINK_CHECK(inCondition) \
+	do { \
+		if(!(inCondition)) { \
+			std::cerr << __FILE__ << ":" << __LINE__ \
+					<< ": check failed: " << #inCondition << std::endl; \
+			stamask::getFailedChecksNum()++; \
+		} \
+	} while(0)
+
+
+#endif /* TEST_TESTCHECK_HPP_ */
@@ -0,0 +1,405 @@
+#include "TestCheck.hpp"
+
+#include "client/StaClientBase.hpp"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+
+namespace stamask {
+
+
+/**
+ * Channel that answers every command at once and records sent commands.
+ * Commands of the failed type get failed status.
+ */
+class RecordingChannel : public IpcChannel {
+
+	/** types of sent commands, kept outside since protocol owns the channel */
+	std::vector<EMessageType>& mSentTypesVec;
+
+	/** type of commands that fail */
+	EMessageType& mFailedType;
+
+	/** status of the last sent command */
+	EMessageStatus mExecStatus;
+
+public:
+
+	RecordingChannel(
+			std::vector<EMessageType>& outSentTypesVec,
+			EMessageType& inFailedType):
+				mSentTypesVec(outSentTypesVec),
+				mFailedType(inFailedType),
+				mExecStatus(EMessageStatus::eMessageStatusOk) {}
+
+	virtual bool connect() {
+		return true;
+	}
+
+	virtual void disconnect() {}
+
+	virtual void waitMessageArrival() {}
+
+	virtual bool waitTimeOutMessageArrival(unsigned long inMsTimeout) {
+		return true;
+	}
+
+	virtual EMessageType peekMessageType() const {
+		return EMessageType::EMessageTypeExecutionStatus;
+	}
+
+	virtual EMessageStatus send(const Message& inMessage) {
+		mSentTypesVec.push_back(inMessage.getMesgType());
+		mExecStatus = inMessage.getMesgType() == mFailedType ?
+				EMessageStatus::eMessageStatusFailed :
+				EMessageStatus::eMessageStatusOk;
+		return EMessageStatus::eMessageStatusOk;
+	}
+
+	virtual EMessageStatus popMessage(Message& outResponse) {
+		ResponseCommExecStatus* responsePtr =
+				dynamic_cast<ResponseCommExecStatus*>(&outResponse);
+		if(!responsePtr)
+			return EMessageStatus::eMessageStatusFailed;
+
+		responsePtr->mExecStatus = mExecStatus;
+		return EMessageStatus::eMessageStatusOk;
+	}
+
+};
+
+/**
+ * Recording channel that answers graph and slacks commands
+ * with empty graph and timing of two nodes.
+ * Calls a hook when slacks are requested,
+ * like another thread calling the client during the load.
+ */
+class LoadHookChannel : public RecordingChannel {
+
+	/** hook called on send of slacks command, kept outside like sent types */
+	std::function<void()>& mSlacksHook;
+
+	/** type of response to the last sent command */
+	EMessageType mResponseType;
+
+public:
+
+	LoadHookChannel(
+			std::vector<EMessageType>& outSentTypesVec,
+			EMessageType& inFailedType,
+			std::function<void()>& inSlacksHook):
+				RecordingChannel(outSentTypesVec, inFailedType),
+				mSlacksHook(inSlacksHook),
+				mResponseType(EMessageType::EMessageTypeExecutionStatus) {}
+
+	virtual EMessageType peekMessageType() const {
+		return mResponseType;
+	}
+
+	virtual EMessageStatus send(const Message& inMessage) {
+		EMessageStatus status = RecordingChannel::send(inMessage);
+
+		mResponseType = EMessageType::EMessageTypeExecutionStatus;
+		if(inMessage.getMesgType() == EMessageType::EMessageTypeGetGraphData)
+			mResponseType = EMessageType::EMessageTypeGraphMap;
+
+		if(inMessage.getMesgType() == EMessageType::EMessageTypeGetGraphSlacksData) {
+			mResponseType = EMessageType::EMessageTypeGraphSlacks;
+			if(mSlacksHook)
+				mSlacksHook();
+		}
+		return status;
+	}
+
+	virtual EMessageStatus popMessage(Message& outResponse) {
+		ResponseGraphSlacks* slacksPtr = dynamic_cast<ResponseGraphSlacks*>(&outResponse);
+		if(slacksPtr)
+			slacksPtr->mNodeTimingsVec.resize(2);
+
+		return RecordingChannel::popMessage(outResponse);
+	}
+
+};
+
+
+/**
+ * Client over a netlist without any objects except named nets.
+ */
+class NetsOnlyClient : public StaClientBase {
+public:
+
+	virtual void printError(const std::string& inErrorStr) {}
+
+	virtual std::string getName(const GenericBlock* inBlockPtr) const {
+		return "top";
+	}
+	virtual std::string getName(const GenericInst* inInstPtr) const {
+		return "u1";
+	}
+	virtual std::string getName(const GenericNet* inNetPtr) const {
+		return "n1";
+	}
+	virtual std::string getName(const GenericPin* inPinPtr) const {
+		return "A";
+	}
+	virtual std::string getName(const GenericPort* inPortPtr) const {
+		return "clk";
+	}
+
+	virtual bool isInput(const GenericPort* inPortPtr) const {
+		return true;
+	}
+	virtual bool isOutput(const GenericPort* inPortPtr) const {
+		return false;
+	}
+	virtual bool isInput(const GenericPin* inPinPtr) const {
+		return true;
+	}
+	virtual bool isOutput(const GenericPin* inPinPtr) const {
+		return false;
+	}
+
+	virtual GenericInst* getParentInstance(const GenericPin* inPinPtr) const {
+		return nullptr;
+	}
+	virtual GenericInst* getParentInstance(const GenericInst* inInstPtr) const {
+		return nullptr;
+	}
+	virtual GenericInst* getParentInstance(const GenericNet* inNetPtr) const {
+		return nullptr;
+	}
+
+	virtual void getPorts(
+			const GenericBlock* inBlockPtr,
+			std::vector<GenericPort*>& outPortsVec) {}
+	virtual void getPorts(
+			const GenericInst* inInstPtr,
+			std::vector<GenericPin*>& outPinsVec) {}
+	virtual void getBlockNets(
+			const GenericInst* inParentInstPtr,
+			const GenericBlock* inBlockPtr,
+			std::vector<GenericNet*>& outNetsVec) {}
+	virtual void getBlockInsts(
+			const GenericInst* inParentInstPtr,
+			const GenericBlock* inBlockPtr,
+			std::vector<GenericInst*>& outInstsVec) {}
+
+	virtual bool isLeafBlock(const GenericBlock* inBlockPtr) const {
+		return true;
+	}
+	virtual GenericBlock* getMasterBlock(const GenericInst* inInstPtr) const {
+		return nullptr;
+	}
+	virtual GenericBlock* getParentBlock(const GenericInst* inInstPtr) const {
+		return nullptr;
+	}
+	virtual GenericBlock* getParentBlock(const GenericNet* inNetPtr) const {
+		return nullptr;
+	}
+
+	virtual void getInstPins(
+			const GenericInst* inInstPtr,
+			std::vector<GenericPin*>& outPinsVec) {}
+	virtual GenericPin* getPortPin(const GenericPort* inPortPtr) const {
+		return nullptr;
+	}
+
+	virtual bool isBus(const GenericPort* inPortPtr) const {
+		return false;
+	}
+	virtual bool isBit(const GenericPort* inPortPtr) const {
+		return false;
+	}
+	virtual GenericPort* getBit(
+			const GenericPort* inPortPtr,
+			uint32_t inBitIdx) const {
+		return nullptr;
+	}
+
+	virtual bool isBus(const GenericPin* inPinPtr) const {
+		return false;
+	}
+	virtual bool isBit(const GenericPin* inPinPtr) const {
+		return false;
+	}
+	virtual GenericPin* getBit(
+			const GenericPin* inPinPtr,
+			uint32_t inBitIdx) const {
+		return nullptr;
+	}
+
+	virtual bool isBus(const GenericNet* inNetPtr) const {
+		return false;
+	}
+
+	virtual GenericNet* getConnectedNet(const GenericPort* inPortPtr) const {
+		return nullptr;
+	}
+	virtual GenericNet* getConnectedNet(const GenericPin* inPinPtr) const {
+		return nullptr;
+	}
+
+	virtual bool hasGndSource(const GenericNet* inNetPtr) const {
+		return false;
+	}
+	virtual bool hasVddSource(const GenericNet* inNetPtr) const {
+		return false;
+	}
+
+	virtual uint32_t getBusRangeFrom(const GenericPort* inPortPtr) const {
+		return 0;
+	}
+	virtual uint32_t getBusRangeTo(const GenericPort* inPortPtr) const {
+		return 0;
+	}
+	virtual uint32_t getBusRangeFrom(const GenericPin* inPinPtr) const {
+		return 0;
+	}
+	virtual uint32_t getBusRangeTo(const GenericPin* inPinPtr) const {
+		return 0;
+	}
+
+};
+
+
+/**
+ * Checks that pending net cap is sent before the next state-changing
+ * command and isn't sent again afterwards.
+ */
+void checkFlushOrder() {
+	std::vector<EMessageType> sentTypesVec;
+	EMessageType failedType = EMessageType::EMessageTypeNoMessage;
+	GenericNet net;
+
+	NetsOnlyClient client;
+	client.setChannel(new RecordingChannel(sentTypesVec, failedType));
+	STALINK_CHECK(client.setWriteBack(true));
+
+	NetContextPath netPath;
+	netPath.mObjectPtr = &net;
+	STALINK_CHECK(client.setNetsLumpCap({netPath}, {1e-15f}));
+	STALINK_CHECK(sentTypesVec.empty());
+	STALINK_CHECK(client.hasPendingWriteBack());
+
+	STALINK_CHECK(client.createClock("clk", "", {}, false, 1e-9f, {0, 5e-10f}));
+	STALINK_CHECK((sentTypesVec == std::vector<EMessageType>{
+			EMessageType::EMessageTypeSetGroupNetLumpCap,
+			EMessageType::EMessageTypeCreateClock}));
+	STALINK_CHECK(!client.hasPendingWriteBack());
+
+	STALINK_CHECK(client.readVerilogFile("top.v"));
+	STALINK_CHECK(sentTypesVec.size() == 3);
+	STALINK_CHECK(sentTypesVec.back() == EMessageType::EMessageTypeReadVerilogFile);
+}
+
+/**
+ * Checks that failed flush keeps pending net cap and stops the command,
+ * then exit sends the net cap before exit command.
+ */
+void checkFailedFlush() {
+	std::vector<EMessageType> sentTypesVec;
+	EMessageType failedType = EMessageType::EMessageTypeSetGroupNetLumpCap;
+	GenericNet net;
+
+	NetsOnlyClient client;
+	client.setChannel(new RecordingChannel(sentTypesVec, failedType));
+	STALINK_CHECK(client.setWriteBack(true));
+
+	NetContextPath netPath;
+	netPath.mObjectPtr = &net;
+	STALINK_CHECK(client.setNetsLumpCap({netPath}, {1e-15f}));
+
+	STALINK_CHECK(!client.setGlobalTimingDerate(
+			true, false, false, true, false, false, true, true, true, 1.1f));
+	STALINK_CHECK((sentTypesVec == std::vector<EMessageType>{
+			EMessageType::EMessageTypeSetGroupNetLumpCap}));
+	STALINK_CHECK(client.hasPendingWriteBack());
+
+	failedType = EMessageType::EMessageTypeNoMessage;
+	STALINK_CHECK(client.exit());
+	STALINK_CHECK((sentTypesVec == std::vector<EMessageType>{
+			EMessageType::EMessageTypeSetGroupNetLumpCap,
+			EMessageType::EMessageTypeSetGroupNetLumpCap,
+			EMessageType::EMessageTypeExit}));
+	STALINK_CHECK(!client.hasPendingWriteBack());
+}
+
+/**
+ * Checks lazy invalidation with double-buffered timing.
+ * Timing stays readable after the change and during the next load,
+ * net cap set during the load keeps loaded timing stale
+ * until the load that flushes it.
+ */
+void checkLazyTimingLoad() {
+	std::vector<EMessageType> sentTypesVec;
+	EMessageType failedType = EMessageType::EMessageTypeNoMessage;
+	std::function<void()> slacksHook;
+	GenericBlock block;
+	GenericNet net;
+
+	NetsOnlyClient client;
+	client.setChannel(new LoadHookChannel(sentTypesVec, failedType, slacksHook));
+	STALINK_CHECK(client.setWriteBack(true));
+	client.setLazyTimingInvalidation(true);
+
+	STALINK_CHECK(client.loadNetlistGraph(&block));
+	STALINK_CHECK(client.loadNetlistSlacks());
+	STALINK_CHECK(client.hasTimings());
+	STALINK_CHECK(!client.isTimingStale());
+	STALINK_CHECK(client.getTimingGeneration() == 1);
+
+	NetContextPath netPath;
+	netPath.mObjectPtr = &net;
+	STALINK_CHECK(client.setNetsLumpCap({netPath}, {1e-15f}));
+	STALINK_CHECK(client.hasTimings());
+	STALINK_CHECK(client.isTimingStale());
+	STALINK_CHECK(client.getTimingGeneration() == 1);
+
+	//previous timing is read while the next one is loaded
+	uint64_t loadingGeneration = 0;
+	slacksHook = [&]() {
+		loadingGeneration = client.getTimingGeneration();
+		client.setNetsLumpCap({netPath}, {2e-15f});
+	};
+	sentTypesVec.clear();
+	STALINK_CHECK(client.loadNetlistSlacks());
+	STALINK_CHECK(loadingGeneration == 1);
+	STALINK_CHECK(client.getTimingGeneration() == 2);
+	STALINK_CHECK(client.isTimingStale());
+	STALINK_CHECK(client.hasPendingWriteBack());
+	STALINK_CHECK((sentTypesVec == std::vector<EMessageType>{
+			EMessageType::EMessageTypeSetGroupNetLumpCap,
+			EMessageType::EMessageTypeGetGraphSlacksData}));
+
+	slacksHook = nullptr;
+	sentTypesVec.clear();
+	STALINK_CHECK(client.loadNetlistSlacks());
+	STALINK_CHECK(client.getTimingGeneration() == 3);
+	STALINK_CHECK(!client.isTimingStale());
+	STALINK_CHECK(!client.hasPendingWriteBack());
+	STALINK_CHECK((sentTypesVec == std::vector<EMessageType>{
+			EMessageType::EMessageTypeSetGroupNetLumpCap,
+			EMessageType::EMessageTypeGetGraphSlacksData}));
+
+	//failed load keeps stale timing readable
+	failedType = EMessageType::EMessageTypeGetGraphSlacksData;
+	STALINK_CHECK(client.setNetsLumpCap({netPath}, {3e-15f}));
+	STALINK_CHECK(!client.loadNetlistSlacks());
+	STALINK_CHECK(client.hasTimings());
+	STALINK_CHECK(client.isTimingStale());
+	STALINK_CHECK(client.getTimingGeneration() == 3);
+}
+
+
+}
+
+
+int main() {
+	stamask::checkFlushOrder();
+	stamask::checkFailedFlush();
+	stamask::checkLazyTimingLoad();
+
+	return stamask::getFailedChecksNum() ? 1 : 0;
+}